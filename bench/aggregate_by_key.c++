@@ -0,0 +1,60 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/aggregate_by_key.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/aggregate_by_key.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 20;
+    std::uint32_t const distinct = 1 << 12;
+
+    std::vector<std::uint32_t> const& keys() {
+        static std::vector<std::uint32_t> v = [] {
+            std::vector<std::uint32_t> v(n);
+            std::uint32_t x = 1;
+            for(auto& k : v) {
+                x = x * 1664525u + 1013904223u;
+                k = (x >> 16) % distinct;
+            }
+            return v;
+        }();
+        return v;
+    }
+
+    struct identity {
+        std::uint32_t operator()(std::uint32_t k) const { return k; }
+    };
+    struct count_one {
+        std::uint64_t operator()(std::uint64_t n, std::uint32_t) const { return n + 1; }
+    };
+
+    bench::registration unordered_map { "aggregate_by_key", "std::unordered_map", n, n * sizeof(std::uint32_t), [] {
+        std::unordered_map<std::uint32_t, std::uint64_t> counts;
+        for(auto k : keys()) ++counts[k];
+        return std::uint64_t(counts.size());
+    }, bench::baseline };
+    bench::registration aggregate { "aggregate_by_key", "aggregate_by_key", n, n * sizeof(std::uint32_t), [] {
+        return std::uint64_t(seq::aggregate_by_key(seq::as_sequence(keys()), identity(), std::uint64_t(0), count_one()).size());
+    } };
+    bench::registration parallel { "aggregate_by_key", "aggregate_by_key parallel", n, n * sizeof(std::uint32_t), [] {
+        return std::uint64_t(seq::aggregate_by_key(seq::as_sequence(keys()), identity(), std::uint64_t(0), count_one(),
+                                                   std::plus<std::uint64_t>(), seq::parallel).size());
+    } };
+} // namespace
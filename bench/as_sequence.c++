@@ -0,0 +1,111 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/primitives/as_sequence.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/primitives.h++>
+#include <taussig/traits.h++>
+
+#include <wheels/optional.h++>
+
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 16;
+
+    std::vector<int> const& numbers() {
+        static std::vector<int> v(n, 3);
+        return v;
+    }
+    std::list<int> const& linked() {
+        static std::list<int> l(n, 3);
+        return l;
+    }
+    std::string const& text() {
+        static std::string s(n, 'x');
+        return s;
+    }
+
+    template <typename S>
+    std::uint64_t sum(S s) {
+        std::uint64_t total = 0;
+        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return total;
+    }
+
+    struct indexed : seq::true_sequence {
+        using value_type = int;
+        using reference = int const&;
+        explicit indexed(std::vector<int> const& v) : v(&v), i(0) {}
+        bool empty() const { return i == v->size(); }
+        void pop_front() { ++i; }
+        reference front() const { return (*v)[i]; }
+        std::vector<int> const* v;
+        std::size_t i;
+    };
+
+    bench::registration iterable_loop { "as_sequence/iterable", "loop", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto x : numbers()) total += x;
+        return total;
+    }, bench::baseline };
+    bench::registration iterable { "as_sequence/iterable", "taussig", n, n * sizeof(int), [] {
+        return sum(seq::as_sequence(numbers()));
+    } };
+
+    bench::registration pair_loop { "as_sequence/iterator_pair", "loop", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto it = linked().begin(); it != linked().end(); ++it) total += *it;
+        return total;
+    }, bench::baseline };
+    bench::registration pair { "as_sequence/iterator_pair", "taussig", n, n * sizeof(int), [] {
+        return sum(seq::as_sequence(std::make_pair(linked().begin(), linked().end())));
+    } };
+
+    bench::registration string_loop { "as_sequence/null_terminated", "loop", n, n, [] {
+        std::uint64_t total = 0;
+        for(auto p = text().c_str(); *p; ++p) total += *p;
+        return total;
+    }, bench::baseline };
+    bench::registration string { "as_sequence/null_terminated", "taussig", n, n, [] {
+        return sum(seq::as_sequence(text().c_str()));
+    } };
+
+    bench::registration true_sequence_loop { "as_sequence/true_sequence", "loop", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        auto const& v = numbers();
+        for(std::size_t i = 0; i < v.size(); ++i) total += v[i];
+        return total;
+    }, bench::baseline };
+    bench::registration true_sequence { "as_sequence/true_sequence", "taussig", n, n * sizeof(int), [] {
+        return sum(seq::as_sequence(indexed(numbers())));
+    } };
+
+    bench::registration optional_loop { "as_sequence/optional", "loop", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto x : numbers()) {
+            wheels::optional<int> o = x;
+            if(o) total += *o;
+        }
+        return total;
+    }, bench::baseline };
+    bench::registration optional { "as_sequence/optional", "taussig", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto x : numbers()) total += sum(seq::as_sequence(wheels::optional<int>(x)));
+        return total;
+    } };
+} // namespace
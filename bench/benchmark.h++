@@ -0,0 +1,77 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmark harness
+
+#ifndef TAUSSIG_BENCH_BENCHMARK_HPP
+#define TAUSSIG_BENCH_BENCHMARK_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <functional> // function
+#include <string>
+#include <vector>
+
+namespace bench {
+    //! {function}
+    //! *Effects*: forces `value` to be computed without letting the compiler see how it is used.
+    template <typename T>
+    void do_not_optimize(T const& value) {
+#if defined(__GNUC__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile T const* sink;
+        sink = &value;
+#endif
+    }
+
+    //! {tag}
+    //! Marks a benchmark as the hand-written baseline of its group.
+    struct baseline_tag {};
+    constexpr baseline_tag baseline {};
+
+    //! {class}
+    //! Marks a benchmark as a regression check: `bench --check` fails if it runs more than `ratio`
+    //! times slower than the baseline of its group.
+    struct max_ratio {
+        double ratio;
+    };
+
+    //! {class}
+    //! A registered benchmark. `run` performs one pass over `elements` elements spanning `bytes`
+    //! bytes and returns a checksum, which the runner consumes so the work cannot be discarded.
+    struct benchmark {
+        std::string group;
+        std::string name;
+        std::size_t elements;
+        std::size_t bytes;
+        std::function<std::uint64_t()> run;
+        bool is_baseline;
+        double max_ratio; // zero if unchecked
+    };
+
+    //! {function}
+    //! *Returns*: all benchmarks registered so far, in registration order.
+    std::vector<benchmark>& registry();
+
+    //! {class}
+    //! Registers a benchmark on construction; meant for namespace-scope objects.
+    struct registration {
+        registration(std::string group, std::string name, std::size_t elements, std::size_t bytes,
+                     std::function<std::uint64_t()> run);
+        registration(std::string group, std::string name, std::size_t elements, std::size_t bytes,
+                     std::function<std::uint64_t()> run, baseline_tag);
+        registration(std::string group, std::string name, std::size_t elements, std::size_t bytes,
+                     std::function<std::uint64_t()> run, max_ratio limit);
+    };
+} // namespace bench
+
+#endif // TAUSSIG_BENCH_BENCHMARK_HPP
@@ -0,0 +1,61 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/cdc_chunks.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/cdc_chunks.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <string>
+
+namespace {
+    std::size_t const n = 1 << 22;
+
+    std::string const& bytes() {
+        static std::string s = [] {
+            std::string s(n, '\0');
+            std::uint32_t seed = 1;
+            for(auto& c : s) {
+                seed = seed * 1664525u + 1013904223u;
+                c = static_cast<char>(seed >> 24);
+            }
+            return s;
+        }();
+        return s;
+    }
+
+    // a plain Gear chunker that hashes every byte and has a single mask
+    bench::registration loop { "cdc_chunks", "loop", n, n, [] {
+        auto const& s = bytes();
+        auto const g = seq::detail::gear();
+        auto const mask = seq::detail::gear_mask(13);
+        std::uint64_t h = 0;
+        std::uint64_t chunks = 0;
+        std::size_t length = 0;
+        for(auto c : s) {
+            h = (h << 1) + g[static_cast<unsigned char>(c)];
+            ++length;
+            if((length >= 2048 && !(h & mask)) || length == 65536) {
+                ++chunks;
+                length = 0;
+            }
+        }
+        return chunks + (length > 0);
+    }, bench::baseline };
+    bench::registration cdc { "cdc_chunks", "cdc_chunks", n, n, [] {
+        std::uint64_t chunks = 0;
+        for(auto s = seq::cdc_chunks(seq::as_sequence(bytes())); !seq::empty(s); seq::pop_front(s)) ++chunks;
+        return chunks;
+    }, bench::max_ratio{ 1.5 } };
+} // namespace
@@ -0,0 +1,183 @@
+#!/usr/bin/python
+
+# Taussig
+#
+# Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+#
+# To the extent possible under law, the author(s) have dedicated all copyright and related
+# and neighboring rights to this software to the public domain worldwide. This software is
+# distributed without any warranty.
+#
+# You should have received a copy of the CC0 Public Domain Dedication along with this software.
+# If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+# Codegen comparison for taussig pipelines
+#
+# Compiles bench/codegen/*.c++ to assembly and compares the inner loops of each
+# taussig_<name> function against its baseline_<name> counterpart. Normalized
+# listings can be dumped to a directory and diffed against later, to catch
+# inlining regressions after refactors.
+
+import argparse
+import difflib
+import os
+import re
+import subprocess
+import sys
+
+# --- util functions
+
+def get_sources(root):
+    for dir, dirs, files in os.walk(root):
+        for f in sorted(files):
+            if f.endswith('.c++'):
+                yield os.path.join(dir, f)
+
+def compile_to_asm(cxx, flags, fn):
+    cmd = [cxx] + flags + ['-S', '-o', '-', fn]
+    return subprocess.check_output(cmd).decode()
+
+def extract_functions(asm):
+    functions = {}
+    name = None
+    for line in asm.splitlines():
+        m = re.match(r'^((?:baseline|taussig)_\w+):', line)
+        if m:
+            name = m.group(1)
+            functions[name] = []
+            continue
+        if name is None:
+            continue
+        if re.match(r'^\s*\.size\s+' + name + r',', line) or re.match(r'^\s*\.cfi_endproc', line):
+            name = None
+            continue
+        functions[name].append(line)
+    return functions
+
+def normalize(lines):
+    """Strips directives and comments, and renames local labels by order of appearance."""
+    names = {}
+    def rename(m):
+        label = m.group(0)
+        if label not in names:
+            names[label] = 'L%d' % len(names)
+        return names[label]
+    result = []
+    for line in lines:
+        line = line.split('#')[0].rstrip()
+        stripped = line.strip()
+        if not stripped:
+            continue
+        if stripped.startswith('.') and not re.match(r'^\.L\w+:$', stripped):
+            continue
+        result.append(re.sub(r'\.L\w+', rename, stripped))
+    return result
+
+def is_label(line):
+    return line.endswith(':')
+
+def inner_loops(listing):
+    """Returns the bodies of the innermost loops in a listing, found as backward jumps to a label."""
+    positions = {}
+    spans = []
+    for i, line in enumerate(listing):
+        if is_label(line):
+            positions[line[:-1]] = i
+            continue
+        m = re.match(r'^j\w*\s+(L\d+)$', line)
+        if m and m.group(1) in positions:
+            spans.append((positions[m.group(1)], i))
+    innermost = [(b, e) for b, e in spans
+                 if not any((b, e) != (b2, e2) and b <= b2 and e2 <= e for b2, e2 in spans)]
+    return [[l for l in listing[b:e + 1] if not is_label(l)] for b, e in innermost]
+
+def tolerances(fn):
+    """Reads per-pipeline tolerances from `// codegen: <name> tolerates <ratio>` comments."""
+    result = {}
+    with open(fn) as f:
+        for line in f:
+            m = re.match(r'^\s*// codegen: (\w+) tolerates ([0-9.]+)', line)
+            if m:
+                result[m.group(1)] = float(m.group(2))
+    return result
+
+def instruction_count(listing):
+    return sum(1 for line in listing if not is_label(line))
+
+# --- main
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--cxx', default='g++', metavar='executable', help='compiler name to use (default: g++)')
+    parser.add_argument('--check', action='store_true', help='fail if a pipeline has a larger inner loop than its baseline')
+    parser.add_argument('--tolerance', type=float, default=0.1, metavar='ratio', help='default allowed relative growth of inner loops in --check mode (default: 0.1)')
+    parser.add_argument('--diff', action='store_true', help='print a diff of the inner loops of each pair')
+    parser.add_argument('--dump', metavar='dir', help='write normalized listings of all functions to dir')
+    parser.add_argument('--against', metavar='dir', help='diff the listings against a previous --dump')
+    parser.add_argument('--flags', nargs='*', default=[], metavar='flag', help='additional compiler flags')
+    parser.add_argument('filter', nargs='?', default='', help='only consider pairs whose name contains this')
+    args = parser.parse_args()
+
+    flags = ['-std=c++11', '-O3', '-Iinclude', '-isystem' + os.path.join('deps', 'wheels', 'include')] + args.flags
+    functions = {}
+    allowed = {}
+    for fn in get_sources(os.path.join('bench', 'codegen')):
+        allowed.update(tolerances(fn))
+        for name, lines in extract_functions(compile_to_asm(args.cxx, flags, fn)).items():
+            functions[name] = normalize(lines)
+
+    failed = []
+    pairs = sorted(n[len('taussig_'):] for n in functions if n.startswith('taussig_') and args.filter in n)
+    print('%-20s %10s %10s %12s %12s %s' % ('pipeline', 'baseline', 'taussig', 'loop (base)', 'loop (seq)', 'verdict'))
+    for name in pairs:
+        baseline = functions.get('baseline_' + name)
+        pipeline = functions['taussig_' + name]
+        if baseline is None:
+            print('%-20s missing baseline_%s' % (name, name))
+            failed.append(name)
+            continue
+        base_loops = sum(len(b) for b in inner_loops(baseline))
+        seq_loops = sum(len(b) for b in inner_loops(pipeline))
+        if baseline == pipeline:
+            verdict = 'identical'
+        elif seq_loops <= base_loops * (1 + allowed.get(name, args.tolerance)):
+            verdict = 'ok'
+        else:
+            verdict = 'PENALTY'
+            failed.append(name)
+        print('%-20s %10d %10d %12d %12d %s' % (name, instruction_count(baseline), instruction_count(pipeline),
+                                              base_loops, seq_loops, verdict))
+        if args.diff and baseline != pipeline:
+            base_body = [l for b in inner_loops(baseline) for l in b + ['']]
+            seq_body = [l for b in inner_loops(pipeline) for l in b + ['']]
+            for line in difflib.unified_diff(base_body, seq_body, 'baseline_' + name, 'taussig_' + name, lineterm=''):
+                print('    ' + line)
+
+    if args.dump:
+        if not os.path.isdir(args.dump):
+            os.makedirs(args.dump)
+        for name, listing in functions.items():
+            with open(os.path.join(args.dump, name + '.s'), 'w') as f:
+                f.write('\n'.join(listing) + '\n')
+
+    changed = []
+    if args.against:
+        for name in sorted(functions):
+            path = os.path.join(args.against, name + '.s')
+            if not os.path.exists(path) or args.filter not in name:
+                continue
+            with open(path) as f:
+                before = f.read().splitlines()
+            if before != functions[name]:
+                changed.append(name)
+                print('\n%s changed since %s:' % (name, args.against))
+                for line in difflib.unified_diff(before, functions[name], 'before', 'after', lineterm=''):
+                    print('    ' + line)
+
+    if args.check and failed:
+        print('\nabstraction penalty over tolerance in: %s' % ', '.join(failed))
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,93 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Inner loops for codegen comparison
+//
+// Each baseline_<name> function is a hand-written loop; taussig_<name> computes the same thing
+// with a taussig pipeline. bench/codegen.py compiles this file and compares the pairs.
+// A pair whose inner loop is known to be larger can raise its tolerance with a
+// `codegen: <name> tolerates <ratio>` comment, which should say why.
+
+#include <taussig/algorithms/map.h++>
+#include <taussig/algorithms/flatten.h++>
+#include <taussig/algorithms/equal.h++>
+#include <taussig/algorithms/count.h++>
+#include <taussig/primitives.h++>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+extern "C" {
+    long baseline_sum(int const* first, int const* last) {
+        long total = 0;
+        for(; first != last; ++first) total += *first;
+        return total;
+    }
+    long taussig_sum(int const* first, int const* last) {
+        long total = 0;
+        for(auto s = std::make_pair(first, last); !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return total;
+    }
+
+    long baseline_map(int const* first, int const* last) {
+        long total = 0;
+        for(; first != last; ++first) total += *first * 3 + 1;
+        return total;
+    }
+    long taussig_map(int const* first, int const* last) {
+        long total = 0;
+        auto s = seq::map([](int x) { return x * 3 + 1; }, std::make_pair(first, last));
+        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return total;
+    }
+
+    long baseline_map_map(int const* first, int const* last) {
+        long total = 0;
+        for(; first != last; ++first) total += (*first * 3) ^ 5;
+        return total;
+    }
+    long taussig_map_map(int const* first, int const* last) {
+        long total = 0;
+        auto inner = seq::map([](int x) { return x * 3; }, std::make_pair(first, last));
+        auto s = seq::map([](int x) { return x ^ 5; }, inner);
+        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return total;
+    }
+
+    // codegen: equal tolerates 0.5
+    // seq::equal cannot know both sequences have the same length, so it tests both ends
+    bool baseline_equal(int const* first, int const* last, int const* other) {
+        for(; first != last; ++first, ++other) {
+            if(*first != *other) return false;
+        }
+        return true;
+    }
+    bool taussig_equal(int const* first, int const* last, int const* other) {
+        return seq::equal(std::make_pair(first, last), std::make_pair(other, other + (last - first)));
+    }
+
+    // codegen: flatten tolerates 50
+    // seq::flatten holds the current inner sequence in an optional (here, a copy of each inner vector)
+    // and re-checks both levels on every pop_front; the tolerance only guards against it getting worse
+    long baseline_flatten(std::vector<std::vector<int>> const* v) {
+        long total = 0;
+        for(auto const& inner : *v) {
+            for(auto x : inner) total += x;
+        }
+        return total;
+    }
+    long taussig_flatten(std::vector<std::vector<int>> const* v) {
+        long total = 0;
+        for(auto s = seq::flatten(seq::as_sequence(*v)); !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return total;
+    }
+}
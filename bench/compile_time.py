@@ -0,0 +1,126 @@
+#!/usr/bin/python
+
+# Taussig
+#
+# Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+#
+# To the extent possible under law, the author(s) have dedicated all copyright and related
+# and neighboring rights to this software to the public domain worldwide. This software is
+# distributed without any warranty.
+#
+# You should have received a copy of the CC0 Public Domain Dedication along with this software.
+# If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+# Compile-time benchmarks for nested pipelines
+#
+# Generates translation units with pipelines of map, flat_map and flatten nested 1..N levels deep,
+# and reports how long each takes to compile and how much of it goes to template instantiation.
+# With clang that is the number of instantiations from -ftime-trace; with GCC it is the time and
+# memory -ftime-report attributes to template instantiation, as GCC does not count them.
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+# --- generation
+
+stages = [
+    'seq::map([](int x) {{ return x + {n}; }}, {s})',
+    'seq::flat_map([](int x) {{ return wheels::some(x * {n}); }}, {s})',
+    'seq::flatten(seq::map([](int x) {{ return wheels::some(x - {n}); }}, {s}))',
+]
+
+def pipeline(depth, index):
+    s = 'seq::as_sequence(v)'
+    for level in range(depth):
+        s = stages[(level + index) % len(stages)].format(n=level + 1, s=s)
+    return s
+
+def translation_unit(depth, copies):
+    lines = [
+        '#include <taussig/algorithms/map.h++>',
+        '#include <taussig/algorithms/flatten.h++>',
+        '#include <taussig/algorithms/flat_map.h++>',
+        '#include <taussig/primitives.h++>',
+        '#include <wheels/optional.h++>',
+        '#include <vector>',
+        '',
+        'long run(std::vector<int> const& v) {',
+        '    long total = 0;',
+    ]
+    for i in range(copies):
+        lines += [
+            '    {',
+            '        auto s = ' + pipeline(depth, i) + ';',
+            '        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s);',
+            '    }',
+        ]
+    lines += ['    return total;', '}', '']
+    return '\n'.join(lines)
+
+# --- measurement
+
+def is_clang(cxx):
+    try:
+        return 'clang' in subprocess.check_output([cxx, '--version']).decode()
+    except OSError:
+        return False
+
+def compile_once(cxx, flags, fn, obj):
+    start = time.time()
+    subprocess.check_call([cxx] + flags + ['-c', fn, '-o', obj])
+    return time.time() - start
+
+def instantiation_cost(cxx, clang, flags, fn, obj):
+    if clang:
+        subprocess.check_call([cxx] + flags + ['-ftime-trace', '-ftime-trace-granularity=0', '-c', fn, '-o', obj])
+        with open(os.path.splitext(obj)[0] + '.json') as f:
+            events = json.load(f)['traceEvents']
+        return '%d' % sum(1 for e in events if e.get('name', '').startswith('Instantiate'))
+    report = subprocess.check_output([cxx] + flags + ['-ftime-report', '-c', fn, '-o', obj],
+                                     stderr=subprocess.STDOUT).decode()
+    for line in report.splitlines():
+        if line.strip().startswith('template instantiation'):
+            # usr, sys, wall and memory, each followed by a percentage
+            fields = re.findall(r'([0-9.]+[kMG]?)\s*\(\s*\d+%\)', line)
+            if len(fields) >= 4:
+                return '%ss %s' % (fields[2], fields[3])
+    return '?'
+
+# --- main
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--cxx', default='g++', metavar='executable', help='compiler name to use (default: g++)')
+    parser.add_argument('--depth', type=int, default=12, metavar='n', help='deepest nesting to generate (default: 12)')
+    parser.add_argument('--copies', type=int, default=6, metavar='n', help='distinct pipelines per translation unit (default: 6)')
+    parser.add_argument('--repetitions', type=int, default=3, metavar='n', help='compilations per depth, best is kept (default: 3)')
+    parser.add_argument('--flags', nargs='*', default=[], metavar='flag', help='additional compiler flags')
+    args = parser.parse_args()
+
+    flags = ['-std=c++11', '-O2', '-Iinclude', '-isystem' + os.path.join('deps', 'wheels', 'include')] + args.flags
+    clang = is_clang(args.cxx)
+    tmp = tempfile.mkdtemp()
+    try:
+        print('%6s %12s %12s %20s' % ('depth', 'seconds', 's/pipeline', 'instantiations' if clang else 'instantiation cost'))
+        for depth in range(1, args.depth + 1):
+            fn = os.path.join(tmp, 'depth%d.c++' % depth)
+            obj = os.path.join(tmp, 'depth%d.o' % depth)
+            with open(fn, 'w') as f:
+                f.write(translation_unit(depth, args.copies))
+            seconds = min(compile_once(args.cxx, flags, fn, obj) for _ in range(args.repetitions))
+            cost = instantiation_cost(args.cxx, clang, flags, fn, obj)
+            print('%6d %12.3f %12.3f %20s' % (depth, seconds, seconds / args.copies, cost))
+            sys.stdout.flush()
+    finally:
+        shutil.rmtree(tmp)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,60 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/concat.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/concat.h++>
+#include <taussig/algorithms/flatten.h++>
+#include <taussig/algorithms/fold.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace {
+    std::size_t const part = 1 << 14;
+    std::size_t const n = 3 * part;
+
+    std::vector<int> const& numbers(int which) {
+        static std::vector<int> v[3] = { std::vector<int>(part, 1), std::vector<int>(part, 2), std::vector<int>(part, 3) };
+        return v[which];
+    }
+
+    bench::registration loop { "concat", "loop", n, n * sizeof(int), [] {
+        int total = 0;
+        for(int i = 0; i < 3; ++i) {
+            for(auto x : numbers(i)) total += x;
+        }
+        return std::uint64_t(total);
+    }, bench::baseline };
+    // every call picks the current segment, at about 5.5x the loop
+    bench::registration elements { "concat", "concat", n, n * sizeof(int), [] {
+        int total = 0;
+        auto s = seq::concat(seq::as_sequence(numbers(0)), seq::as_sequence(numbers(1)), seq::as_sequence(numbers(2)));
+        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return std::uint64_t(total);
+    }, bench::max_ratio{ 8 } };
+    bench::registration fold { "concat", "fold(concat)", n, n * sizeof(int), [] {
+        auto s = seq::concat(seq::as_sequence(numbers(0)), seq::as_sequence(numbers(1)), seq::as_sequence(numbers(2)));
+        return std::uint64_t(seq::fold(s, 0, std::plus<int>()));
+    }, bench::max_ratio{ 1.5 } };
+    bench::registration flatten { "concat", "flatten", n, n * sizeof(int), [] {
+        using view = std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator>;
+        std::vector<view> const views { seq::as_sequence(numbers(0)), seq::as_sequence(numbers(1)), seq::as_sequence(numbers(2)) };
+        int total = 0;
+        for(auto s = seq::flatten(seq::as_sequence(views)); !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return std::uint64_t(total);
+    } };
+} // namespace
@@ -0,0 +1,130 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Hardware performance counters
+
+#include "counters.h++"
+
+#if defined(__linux__)
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   include <cerrno>
+#   include <cstring> // memset, strerror
+#   include <cstdint> // uint64_t
+#endif
+
+namespace bench {
+    char const* event_name(event e) {
+        static char const* const names[event_count] = {
+            "cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses",
+        };
+        return names[e];
+    }
+
+#if defined(__linux__)
+    namespace {
+        perf_event_attr attributes(event e) {
+            perf_event_attr a;
+            std::memset(&a, 0, sizeof(a));
+            a.size = sizeof(a);
+            a.disabled = 1;
+            a.exclude_kernel = 1;
+            a.exclude_hv = 1;
+            a.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            switch(e) {
+            case cycles:
+                a.type = PERF_TYPE_HARDWARE;
+                a.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case instructions:
+                a.type = PERF_TYPE_HARDWARE;
+                a.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case branch_misses:
+                a.type = PERF_TYPE_HARDWARE;
+                a.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            case l1d_misses:
+                a.type = PERF_TYPE_HW_CACHE;
+                a.config = PERF_COUNT_HW_CACHE_L1D
+                         | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                         | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case llc_misses:
+                a.type = PERF_TYPE_HARDWARE;
+                a.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            default:
+                break;
+            }
+            return a;
+        }
+    } // namespace
+
+    counters::counters() {
+        for(int e = 0; e < event_count; ++e) {
+            auto a = attributes(event(e));
+            fds[e] = static_cast<int>(syscall(SYS_perf_event_open, &a, 0, -1, -1, 0));
+            values[e] = 0;
+            if(fds[e] < 0 && why.empty()) {
+                why = std::string(event_name(event(e))) + ": " + std::strerror(errno);
+                if(errno == EACCES || errno == EPERM) why += " (see /proc/sys/kernel/perf_event_paranoid)";
+            }
+        }
+    }
+    counters::~counters() {
+        for(auto fd : fds) {
+            if(fd >= 0) close(fd);
+        }
+    }
+
+    bool counters::available() const {
+        for(auto fd : fds) {
+            if(fd >= 0) return true;
+        }
+        return false;
+    }
+
+    void counters::start() {
+        for(auto fd : fds) {
+            if(fd < 0) continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    void counters::stop() {
+        for(auto fd : fds) {
+            if(fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for(int e = 0; e < event_count; ++e) {
+            values[e] = 0;
+            if(fds[e] < 0) continue;
+            std::uint64_t data[3]; // value, time enabled, time running
+            if(read(fds[e], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) continue;
+            // the kernel multiplexes events when there are more than counters
+            values[e] = double(data[0]) * double(data[1]) / double(data[2]);
+        }
+    }
+#else
+    counters::counters() : why("hardware counters are only supported on Linux") {
+        for(int e = 0; e < event_count; ++e) {
+            fds[e] = -1;
+            values[e] = 0;
+        }
+    }
+    counters::~counters() {}
+    bool counters::available() const { return false; }
+    void counters::start() {}
+    void counters::stop() {}
+#endif
+} // namespace bench
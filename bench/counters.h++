@@ -0,0 +1,78 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Hardware performance counters
+
+#ifndef TAUSSIG_BENCH_COUNTERS_HPP
+#define TAUSSIG_BENCH_COUNTERS_HPP
+
+#include <cstddef> // size_t
+#include <string>
+
+namespace bench {
+    //! {enum}
+    //! The hardware events the benchmarks can count.
+    enum event {
+        cycles,
+        instructions,
+        branch_misses,
+        l1d_misses,
+        llc_misses,
+        event_count
+    };
+
+    //! {function}
+    //! *Returns*: a short name for `e`.
+    char const* event_name(event e);
+
+    //! {class}
+    //! Counts hardware events for the calling thread with `perf_event_open`.
+    //! *Note*: events the machine or the permissions do not allow are left out; on systems other
+    //!         than Linux no event is ever available.
+    struct counters {
+        counters();
+        ~counters();
+        counters(counters const&) = delete;
+        counters& operator=(counters const&) = delete;
+
+        //! {function}
+        //! *Returns*: `true` if at least one event could be opened.
+        bool available() const;
+
+        //! {function}
+        //! *Returns*: why the events that are missing could not be opened.
+        std::string const& error() const { return why; }
+
+        //! {function}
+        //! *Returns*: `true` if `e` is being counted.
+        bool counts(event e) const { return fds[e] >= 0; }
+
+        //! {function}
+        //! *Effects*: resets and starts all counters.
+        void start();
+
+        //! {function}
+        //! *Effects*: stops all counters and reads them, scaling for any multiplexing.
+        void stop();
+
+        //! {function}
+        //! *Requires*: `counts(e)` and a `start()`/`stop()` pair has completed.
+        //! *Returns*: the number of `e` events counted.
+        double value(event e) const { return values[e]; }
+
+    private:
+        int fds[event_count];
+        double values[event_count];
+        std::string why;
+    };
+} // namespace bench
+
+#endif // TAUSSIG_BENCH_COUNTERS_HPP
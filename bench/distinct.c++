@@ -0,0 +1,62 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/distinct.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/distinct.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 20;
+    std::uint32_t const distinct = 1 << 16;
+
+    std::vector<std::uint32_t> const& values() {
+        static std::vector<std::uint32_t> v = [] {
+            std::vector<std::uint32_t> v(n);
+            std::uint32_t x = 1;
+            for(auto& k : v) {
+                x = x * 1664525u + 1013904223u;
+                k = (x >> 12) % distinct;
+            }
+            return v;
+        }();
+        return v;
+    }
+
+    template <typename S>
+    std::uint64_t sum(S s) {
+        std::uint64_t total = 0;
+        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return total;
+    }
+
+    bench::registration unordered_set { "distinct", "std::unordered_set", n, n * sizeof(std::uint32_t), [] {
+        std::unordered_set<std::uint32_t> seen;
+        std::uint64_t total = 0;
+        for(auto x : values()) {
+            if(seen.insert(x).second) total += x;
+        }
+        return total;
+    }, bench::baseline };
+    bench::registration exact { "distinct", "distinct", n, n * sizeof(std::uint32_t), [] {
+        return sum(seq::distinct(seq::as_sequence(values())));
+    } };
+    // two bytes per distinct value
+    bench::registration approximate { "distinct", "distinct approximate", n, n * sizeof(std::uint32_t), [] {
+        return sum(seq::distinct(seq::as_sequence(values()), seq::approximate(2 * distinct)));
+    } };
+} // namespace
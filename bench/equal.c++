@@ -0,0 +1,51 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/equal.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/equal.h++>
+#include <taussig/primitives.h++>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 16;
+
+    std::vector<int> const& first() {
+        static std::vector<int> v(n, 9);
+        return v;
+    }
+    std::vector<int> const& second() {
+        static std::vector<int> v(n, 9);
+        return v;
+    }
+
+    bench::registration loop { "equal", "loop", n, 2 * n * sizeof(int), [] {
+        auto const& a = first();
+        auto const& b = second();
+        if(a.size() != b.size()) return std::uint64_t(0);
+        for(std::size_t i = 0; i < a.size(); ++i) {
+            if(a[i] != b[i]) return std::uint64_t(0);
+        }
+        return std::uint64_t(1);
+    }, bench::baseline };
+    bench::registration std_equal { "equal", "std::equal", n, 2 * n * sizeof(int), [] {
+        return std::uint64_t(std::equal(first().begin(), first().end(), second().begin()));
+    } };
+    // seq::equal cannot assume equal lengths, so its loop tests both ends
+    bench::registration equal { "equal", "equal", n, 2 * n * sizeof(int), [] {
+        return std::uint64_t(seq::equal(seq::as_sequence(first()), seq::as_sequence(second())));
+    }, bench::max_ratio{ 3 } };
+} // namespace
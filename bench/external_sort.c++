@@ -0,0 +1,59 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/external_sort.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/external_sort.h++>
+#include <taussig/primitives.h++>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 20;
+
+    std::vector<std::uint32_t> const& values() {
+        static std::vector<std::uint32_t> v = [] {
+            std::vector<std::uint32_t> v(n);
+            std::uint32_t x = 1;
+            for(auto& e : v) {
+                x = x * 1664525u + 1013904223u;
+                e = x;
+            }
+            return v;
+        }();
+        return v;
+    }
+
+    template <typename S>
+    std::uint64_t checksum(S s) {
+        std::uint64_t total = 0, i = 0;
+        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s) * ++i;
+        return total;
+    }
+
+    bench::registration std_sort { "external_sort", "std::sort", n, n * sizeof(std::uint32_t), [] {
+        auto v = values();
+        std::sort(v.begin(), v.end());
+        return checksum(seq::as_sequence(v));
+    }, bench::baseline };
+    bench::registration in_memory { "external_sort", "external_sort in memory", n, n * sizeof(std::uint32_t), [] {
+        return checksum(seq::external_sort(seq::as_sequence(values()), std::less<std::uint32_t>(), n * sizeof(std::uint32_t)));
+    } };
+    // sixteen runs of 256KB, spilled to temporary files
+    bench::registration spilled { "external_sort", "external_sort 16 runs", n, n * sizeof(std::uint32_t), [] {
+        return checksum(seq::external_sort(seq::as_sequence(values()), std::less<std::uint32_t>(), n * sizeof(std::uint32_t) / 16));
+    } };
+} // namespace
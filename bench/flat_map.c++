@@ -0,0 +1,59 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/flat_map.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/flat_map.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace {
+    std::size_t const outer = 1 << 12;
+    std::size_t const inner = 16;
+    std::size_t const n = outer * inner;
+
+    std::vector<int> const& table() {
+        static std::vector<int> v(inner * 8, 7);
+        return v;
+    }
+    std::vector<int> const& keys() {
+        static std::vector<int> v = [] {
+            std::vector<int> v(outer);
+            for(std::size_t i = 0; i < outer; ++i) v[i] = int(i % 8);
+            return v;
+        }();
+        return v;
+    }
+
+    bench::registration loop { "flat_map", "loop", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto k : keys()) {
+            for(std::size_t i = 0; i < inner; ++i) total += table()[k * inner + i];
+        }
+        return total;
+    }, bench::baseline };
+    bench::registration flat_map { "flat_map", "flat_map", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        auto row = [](int k) {
+            auto first = table().data() + k * inner;
+            return std::make_pair(first, first + inner);
+        };
+        for(auto s = seq::flat_map(row, seq::as_sequence(keys())); !seq::empty(s); seq::pop_front(s)) {
+            total += seq::front(s);
+        }
+        return total;
+    } };
+} // namespace
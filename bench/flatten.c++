@@ -0,0 +1,47 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/flatten.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/flatten.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    std::size_t const outer = 1 << 10;
+    std::size_t const inner = 1 << 6;
+    std::size_t const n = outer * inner;
+
+    std::vector<std::vector<int>> const& nested() {
+        static std::vector<std::vector<int>> v(outer, std::vector<int>(inner, 5));
+        return v;
+    }
+
+    bench::registration loop { "flatten", "loop", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto const& v : nested()) {
+            for(auto x : v) total += x;
+        }
+        return total;
+    }, bench::baseline };
+    // known penalty: each inner vector is copied into the flattened sequence
+    bench::registration flatten { "flatten", "flatten", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto s = seq::flatten(seq::as_sequence(nested())); !seq::empty(s); seq::pop_front(s)) {
+            total += seq::front(s);
+        }
+        return total;
+    }, bench::max_ratio{ 15 } };
+} // namespace
@@ -0,0 +1,70 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/fold.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/fold.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 20;
+
+    std::vector<int> const& integers() {
+        static std::vector<int> v = [] {
+            std::vector<int> v(n);
+            for(std::size_t i = 0; i < n; ++i) v[i] = int(i % 1000);
+            return v;
+        }();
+        return v;
+    }
+    std::vector<double> const& reals() {
+        static std::vector<double> v = [] {
+            std::vector<double> v(n);
+            for(std::size_t i = 0; i < n; ++i) v[i] = double(i % 1000) / 7;
+            return v;
+        }();
+        return v;
+    }
+
+    bench::registration int_loop { "fold int", "loop", n, n * sizeof(int), [] {
+        int total = 0;
+        for(auto x : integers()) total += x;
+        return std::uint64_t(total);
+    }, bench::baseline };
+    bench::registration int_fold { "fold int", "fold", n, n * sizeof(int), [] {
+        return std::uint64_t(seq::fold(seq::as_sequence(integers()), 0, std::plus<int>()));
+    }, bench::max_ratio{ 1.5 } };
+    bench::registration int_parallel { "fold int", "reduce parallel", n, n * sizeof(int), [] {
+        return std::uint64_t(seq::reduce(seq::as_sequence(integers()), 0, std::plus<int>(), seq::parallel));
+    } };
+
+    // the plain loop cannot reassociate floating-point additions, so it does not vectorize
+    bench::registration real_loop { "fold double", "loop", n, n * sizeof(double), [] {
+        double total = 0;
+        for(auto x : reals()) total += x;
+        return std::uint64_t(total);
+    }, bench::baseline };
+    bench::registration real_fold { "fold double", "fold", n, n * sizeof(double), [] {
+        return std::uint64_t(seq::fold(seq::as_sequence(reals()), 0.0, std::plus<double>()));
+    } };
+    bench::registration real_reduce { "fold double", "reduce", n, n * sizeof(double), [] {
+        return std::uint64_t(seq::reduce(seq::as_sequence(reals()), 0.0, std::plus<double>()));
+    } };
+    bench::registration real_parallel { "fold double", "reduce parallel", n, n * sizeof(double), [] {
+        return std::uint64_t(seq::reduce(seq::as_sequence(reals()), 0.0, std::plus<double>(), seq::parallel));
+    } };
+} // namespace
@@ -0,0 +1,48 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/generate.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+
+#include <wheels/optional.h++>
+
+#include <cstdint>
+
+namespace {
+    std::size_t const n = 1 << 16;
+
+    bench::registration loop { "generate", "loop", n, n * sizeof(std::size_t), [] {
+        std::uint64_t total = 0;
+        std::size_t x = 1;
+        for(std::size_t i = 0; i < n; ++i) {
+            x = x * 6364136223846793005u + 1442695040888963407u;
+            total += x >> 33;
+        }
+        return total;
+    }, bench::baseline };
+    bench::registration generate { "generate", "generate", n, n * sizeof(std::size_t), [] {
+        std::uint64_t total = 0;
+        std::size_t i = 0, x = 1;
+        auto gen = [&]() -> wheels::optional<std::size_t> {
+            if(i++ == n) return wheels::none;
+            x = x * 6364136223846793005u + 1442695040888963407u;
+            return x >> 33;
+        };
+        for(auto s = seq::generate(gen); !seq::empty(s); seq::pop_front(s)) {
+            total += seq::front(s);
+        }
+        return total;
+    }, bench::max_ratio{ 1.5 } };
+} // namespace
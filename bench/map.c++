@@ -0,0 +1,54 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/map.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/map.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 16;
+
+    std::vector<int> const& numbers() {
+        static std::vector<int> v = [] {
+            std::vector<int> v(n);
+            for(std::size_t i = 0; i < n; ++i) v[i] = int(i % 1000);
+            return v;
+        }();
+        return v;
+    }
+
+    bench::registration loop { "map", "loop", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto x : numbers()) total += x * 3 + 1;
+        return total;
+    }, bench::baseline };
+    bench::registration single { "map", "map", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto s = seq::map([](int x) { return x * 3 + 1; }, seq::as_sequence(numbers())); !seq::empty(s); seq::pop_front(s)) {
+            total += seq::front(s);
+        }
+        return total;
+    }, bench::max_ratio{ 1.5 } };
+    bench::registration chained { "map", "map.map", n, n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        auto inner = seq::map([](int x) { return x * 3; }, seq::as_sequence(numbers()));
+        for(auto s = seq::map([](int x) { return x + 1; }, inner); !seq::empty(s); seq::pop_front(s)) {
+            total += seq::front(s);
+        }
+        return total;
+    }, bench::max_ratio{ 1.5 } };
+} // namespace
@@ -0,0 +1,47 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/interop/materialize.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/map.h++>
+#include <taussig/interop/materialize.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 16;
+
+    std::vector<int> const& numbers() {
+        static std::vector<int> v(n, 2);
+        return v;
+    }
+
+    bench::registration loop { "materialize", "loop", n, n * sizeof(int), [] {
+        std::vector<int> result;
+        result.reserve(numbers().size());
+        for(auto x : numbers()) result.push_back(x + 1);
+        return std::uint64_t(result.back());
+    }, bench::baseline };
+    bench::registration push_back { "materialize", "loop (no reserve)", n, n * sizeof(int), [] {
+        std::vector<int> result;
+        for(auto x : numbers()) result.push_back(x + 1);
+        return std::uint64_t(result.back());
+    } };
+    bench::registration materialize { "materialize", "materialize", n, n * sizeof(int), [] {
+        auto s = seq::map([](int x) { return x + 1; }, seq::as_sequence(numbers()));
+        auto result = seq::materialize<std::vector<int>>(s);
+        return std::uint64_t(result.back());
+    } };
+} // namespace
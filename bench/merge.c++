@@ -0,0 +1,87 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/merge.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/merge.h++>
+#include <taussig/primitives.h++>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 20;
+    std::size_t const k = 16;
+
+    std::vector<std::vector<std::uint32_t>> make_runs(std::size_t runs) {
+        std::vector<std::vector<std::uint32_t>> v(runs);
+        std::uint32_t x = 1;
+        for(std::size_t i = 0; i < n; ++i) {
+            x = x * 1664525u + 1013904223u;
+            v[i % runs].push_back(x);
+        }
+        for(auto& r : v) std::sort(r.begin(), r.end());
+        return v;
+    }
+
+    std::vector<std::vector<std::uint32_t>> const& two_runs() {
+        static auto v = make_runs(2);
+        return v;
+    }
+    std::vector<std::vector<std::uint32_t>> const& many_runs() {
+        static auto v = make_runs(k);
+        return v;
+    }
+
+    template <typename S>
+    std::uint64_t checksum(S s) {
+        std::uint64_t total = 0, i = 0;
+        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s) * ++i;
+        return total;
+    }
+
+    bench::registration std_merge { "merge two-way", "std::merge", n, n * sizeof(std::uint32_t), [] {
+        auto const& runs = two_runs();
+        std::vector<std::uint32_t> out(n);
+        std::merge(runs[0].begin(), runs[0].end(), runs[1].begin(), runs[1].end(), out.begin());
+        return checksum(seq::as_sequence(out));
+    }, bench::baseline };
+    bench::registration merge_two { "merge two-way", "merge", n, n * sizeof(std::uint32_t), [] {
+        auto const& runs = two_runs();
+        return checksum(seq::merge(runs[0], runs[1]));
+    }, bench::max_ratio{ 1.5 } };
+
+    using cursor = std::pair<std::uint32_t const*, std::uint32_t const*>;
+    struct cursor_greater {
+        bool operator()(cursor const& a, cursor const& b) const { return *a.first > *b.first; }
+    };
+    bench::registration heap { "merge k-way", "std::priority_queue", n, n * sizeof(std::uint32_t), [] {
+        std::priority_queue<cursor, std::vector<cursor>, cursor_greater> queue;
+        for(auto const& r : many_runs()) queue.push({ r.data(), r.data() + r.size() });
+        std::uint64_t total = 0, i = 0;
+        while(!queue.empty()) {
+            auto c = queue.top();
+            queue.pop();
+            total += *c.first * ++i;
+            if(++c.first != c.second) queue.push(c);
+        }
+        return total;
+    }, bench::baseline };
+    bench::registration merge_many { "merge k-way", "merge_all", n, n * sizeof(std::uint32_t), [] {
+        return checksum(seq::merge_all(many_runs()));
+    } };
+} // namespace
@@ -0,0 +1,201 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmark runner
+
+#include "benchmark.h++"
+#include "counters.h++"
+#include "../test/allocations.h++"
+
+#include <algorithm> // sort
+#include <chrono>
+#include <cmath> // sqrt
+#include <cstdio> // printf
+#include <cstdlib> // atoi
+#include <cstring> // strcmp
+#include <map>
+#include <string>
+#include <utility> // move
+#include <vector>
+
+namespace bench {
+    std::vector<benchmark>& registry() {
+        static std::vector<benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    registration::registration(std::string group, std::string name, std::size_t elements, std::size_t bytes,
+                               std::function<std::uint64_t()> run) {
+        registry().push_back({ std::move(group), std::move(name), elements, bytes, std::move(run), false, 0 });
+    }
+    registration::registration(std::string group, std::string name, std::size_t elements, std::size_t bytes,
+                               std::function<std::uint64_t()> run, baseline_tag) {
+        registry().push_back({ std::move(group), std::move(name), elements, bytes, std::move(run), true, 0 });
+    }
+    registration::registration(std::string group, std::string name, std::size_t elements, std::size_t bytes,
+                               std::function<std::uint64_t()> run, max_ratio limit) {
+        registry().push_back({ std::move(group), std::move(name), elements, bytes, std::move(run), false, limit.ratio });
+    }
+
+    namespace {
+        using clock = std::chrono::steady_clock;
+
+        struct options {
+            std::string filter;
+            int repetitions = 15;
+            double min_time = 0.02; // seconds per repetition
+            double warm_up = 0.05; // seconds
+            bool check = false;
+            bool counters = false;
+        };
+
+        struct statistics {
+            double median, min, max, mean, stddev; // ns per element
+            std::size_t iterations; // per batch
+        };
+
+        double seconds_since(clock::time_point start) {
+            return std::chrono::duration<double>(clock::now() - start).count();
+        }
+
+        double time_batch(benchmark const& b, std::size_t iterations) {
+            std::uint64_t checksum = 0;
+            auto start = clock::now();
+            for(std::size_t i = 0; i < iterations; ++i) {
+                checksum += b.run();
+            }
+            auto elapsed = seconds_since(start);
+            do_not_optimize(checksum);
+            return elapsed;
+        }
+
+        statistics measure(benchmark const& b, options const& o) {
+            // warm up caches and branch predictors, and size batches to the minimum time
+            std::size_t iterations = 1;
+            auto warm_start = clock::now();
+            for(;;) {
+                auto t = time_batch(b, iterations);
+                if(t >= o.min_time && seconds_since(warm_start) >= o.warm_up) break;
+                if(t < o.min_time) iterations *= 2;
+            }
+
+            std::vector<double> samples;
+            for(int r = 0; r < o.repetitions; ++r) {
+                auto t = time_batch(b, iterations);
+                samples.push_back(t * 1e9 / (double(iterations) * double(b.elements)));
+            }
+            std::sort(samples.begin(), samples.end());
+
+            statistics s;
+            s.iterations = iterations;
+            auto const n = samples.size();
+            s.median = n % 2? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+            s.min = samples.front();
+            s.max = samples.back();
+            s.mean = 0;
+            for(auto x : samples) s.mean += x;
+            s.mean /= n;
+            s.stddev = 0;
+            for(auto x : samples) s.stddev += (x - s.mean) * (x - s.mean);
+            s.stddev = n > 1? std::sqrt(s.stddev / (n - 1)) : 0;
+            return s;
+        }
+
+        void usage(char const* name) {
+            std::printf("usage: %s [filter] [--repetitions n] [--min-time ms] [--warm-up ms] [--check] [--counters]\n", name);
+        }
+
+        void print_counters(counters& c, benchmark const& b, std::size_t iterations) {
+            c.start();
+            time_batch(b, iterations);
+            c.stop();
+            auto const elements = double(iterations) * double(b.elements);
+            std::printf("%-40s", "");
+            for(int e = 0; e < event_count; ++e) {
+                if(c.counts(event(e))) std::printf(" %s %.3f", event_name(event(e)), c.value(event(e)) / elements);
+            }
+            if(c.counts(cycles) && c.counts(instructions) && c.value(cycles) > 0) {
+                std::printf(" IPC %.2f", c.value(instructions) / c.value(cycles));
+            }
+            std::printf("\n");
+        }
+
+        bool is_checked(std::string const& group) {
+            for(auto const& b : registry()) {
+                if(b.group == group && b.max_ratio > 0) return true;
+            }
+            return false;
+        }
+    } // namespace
+} // namespace bench
+
+int main(int argc, char** argv) {
+    bench::options o;
+    for(int i = 1; i < argc; ++i) {
+        if(std::strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc) o.repetitions = std::atoi(argv[++i]);
+        else if(std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) o.min_time = std::atoi(argv[++i]) / 1e3;
+        else if(std::strcmp(argv[i], "--warm-up") == 0 && i + 1 < argc) o.warm_up = std::atoi(argv[++i]) / 1e3;
+        else if(std::strcmp(argv[i], "--check") == 0) o.check = true;
+        else if(std::strcmp(argv[i], "--counters") == 0) o.counters = true;
+        else if(argv[i][0] == '-') {
+            bench::usage(argv[0]);
+            return 1;
+        } else o.filter = argv[i];
+    }
+    if(o.repetitions < 1) o.repetitions = 1;
+
+    bench::counters counters;
+    if(o.counters && !counters.available()) {
+        std::printf("hardware counters unavailable (%s); timing only\n\n", counters.error().c_str());
+        o.counters = false;
+    } else if(o.counters && !counters.error().empty()) {
+        std::printf("some hardware counters unavailable (%s)\n\n", counters.error().c_str());
+    }
+
+    // in check mode only the groups with regression limits run, and exceeding a limit is a failure
+    int failures = 0;
+    std::map<std::string, double> baselines;
+    std::string group;
+    std::printf("%-40s %10s %10s %10s %9s %10s %10s %8s\n", "benchmark", "ns/elem", "min", "max", "stddev", "MB/s", "allocs", "ratio");
+    for(auto const& b : bench::registry()) {
+        auto const full_name = b.group + "/" + b.name;
+        if(full_name.find(o.filter) == std::string::npos) continue;
+        if(o.check && !bench::is_checked(b.group)) continue;
+        if(b.group != group) {
+            group = b.group;
+            std::printf("\n");
+        }
+        auto s = bench::measure(b, o);
+        // a warmed-up pass, so only allocations made on every pass are counted
+        auto const allocated = allocations::during([&b] { bench::do_not_optimize(b.run()); });
+        if(b.is_baseline) baselines[b.group] = s.median;
+        auto const mbps = double(b.bytes) / (s.median * double(b.elements)) * 1e9 / (1 << 20);
+        std::printf("%-40s %10.3f %10.3f %10.3f %8.1f%% %10.1f %10zu", full_name.c_str(), s.median, s.min, s.max,
+                    100 * s.stddev / s.mean, mbps, allocated.allocations);
+        auto it = baselines.find(b.group);
+        if(it != baselines.end()) std::printf(" %7.2fx", s.median / it->second);
+        if(o.check && b.max_ratio > 0) {
+            if(it == baselines.end()) {
+                std::printf("  FAIL (no baseline)");
+                ++failures;
+            } else if(s.median / it->second > b.max_ratio) {
+                std::printf("  FAIL (limit %.2fx)", b.max_ratio);
+                ++failures;
+            } else std::printf("  ok");
+        }
+        std::printf("\n");
+        if(o.counters) bench::print_counters(counters, b, s.iterations);
+    }
+    if(failures) {
+        std::printf("\n%d benchmark(s) over their abstraction penalty limit\n", failures);
+        return 1;
+    }
+}
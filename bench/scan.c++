@@ -0,0 +1,64 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/scan.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/scan.h++>
+#include <taussig/primitives.h++>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 20;
+
+    std::vector<std::uint32_t> const& lengths() {
+        static std::vector<std::uint32_t> v = [] {
+            std::vector<std::uint32_t> v(n);
+            for(std::size_t i = 0; i < n; ++i) v[i] = std::uint32_t(i % 1000);
+            return v;
+        }();
+        return v;
+    }
+    std::vector<std::uint32_t>& offsets() {
+        static std::vector<std::uint32_t> v(n);
+        return v;
+    }
+
+    bench::registration loop { "scan", "loop", n, 2 * n * sizeof(std::uint32_t), [] {
+        auto const& in = lengths();
+        auto& out = offsets();
+        std::uint32_t total = 0;
+        for(std::size_t i = 0; i < n; ++i) {
+            out[i] = total;
+            total += in[i];
+        }
+        return std::uint64_t(out.back());
+    }, bench::baseline };
+    bench::registration lazy { "scan", "exclusive_scan", n, 2 * n * sizeof(std::uint32_t), [] {
+        auto out = offsets().begin();
+        for(auto s = seq::exclusive_scan(seq::as_sequence(lengths()), 0u, std::plus<std::uint32_t>()); !seq::empty(s); seq::pop_front(s)) {
+            *out++ = seq::front(s);
+        }
+        return std::uint64_t(offsets().back());
+    } };
+    bench::registration eager { "scan", "exclusive_scan_into", n, 2 * n * sizeof(std::uint32_t), [] {
+        seq::exclusive_scan_into(seq::as_sequence(lengths()), offsets().begin(), 0u, std::plus<std::uint32_t>());
+        return std::uint64_t(offsets().back());
+    }, bench::max_ratio{ 1.5 } };
+    bench::registration parallel { "scan", "exclusive_scan_into parallel", n, 2 * n * sizeof(std::uint32_t), [] {
+        seq::exclusive_scan_into(seq::as_sequence(lengths()), offsets().begin(), 0u, std::plus<std::uint32_t>(), seq::parallel);
+        return std::uint64_t(offsets().back());
+    } };
+} // namespace
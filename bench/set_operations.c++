@@ -0,0 +1,105 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/set_operations.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/set_operations.h++>
+#include <taussig/primitives.h++>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace {
+    // strictly increasing lists with the given average gap, like the postings of a search index
+    std::vector<std::uint32_t> postings(std::size_t n, std::uint32_t gap, std::uint32_t seed) {
+        std::vector<std::uint32_t> v(n);
+        std::uint32_t x = seed, value = 0;
+        for(auto& e : v) {
+            x = x * 1664525u + 1013904223u;
+            value += 1 + (x >> 16) % (2 * gap - 1);
+            e = value;
+        }
+        return v;
+    }
+
+    std::size_t const n = 1 << 20;
+
+    std::vector<std::uint32_t> const& long_list() {
+        static auto v = postings(n, 8, 1);
+        return v;
+    }
+    std::vector<std::uint32_t> const& similar_list() {
+        static auto v = postings(n, 8, 2);
+        return v;
+    }
+    std::vector<std::uint32_t> const& short_list() {
+        static auto v = postings(n / 256, 8 * 256, 3);
+        return v;
+    }
+
+    template <typename S>
+    std::uint64_t checksum(S s) {
+        std::uint64_t total = 0, i = 0;
+        for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s) * ++i;
+        return total;
+    }
+
+    std::uint64_t std_intersection(std::vector<std::uint32_t> const& a, std::vector<std::uint32_t> const& b) {
+        std::vector<std::uint32_t> out;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+        return checksum(seq::as_sequence(out));
+    }
+
+    // without SIMD, lists of similar length take plain merge steps
+#if defined(TAUSSIG_HAS_SSE2)
+    double const balanced_limit = 0.75;
+#else
+    double const balanced_limit = 1.5;
+#endif
+
+    // two lists of similar length, sharing about one element in eight
+    bench::registration balanced_std { "set_intersection balanced", "std::set_intersection", 2 * n, 2 * n * sizeof(std::uint32_t), [] {
+        return std_intersection(long_list(), similar_list());
+    }, bench::baseline };
+    bench::registration balanced { "set_intersection balanced", "set_intersection", 2 * n, 2 * n * sizeof(std::uint32_t), [] {
+        return checksum(seq::set_intersection(long_list(), similar_list()));
+    }, bench::max_ratio{ balanced_limit } };
+
+    // a list 256 times shorter than the other
+    bench::registration skewed_std { "set_intersection skewed", "std::set_intersection", n + n / 256, (n + n / 256) * sizeof(std::uint32_t), [] {
+        return std_intersection(short_list(), long_list());
+    }, bench::baseline };
+    bench::registration skewed { "set_intersection skewed", "set_intersection", n + n / 256, (n + n / 256) * sizeof(std::uint32_t), [] {
+        return checksum(seq::set_intersection(short_list(), long_list()));
+    }, bench::max_ratio{ 0.75 } };
+
+    bench::registration union_std { "set_union", "std::set_union", 2 * n, 2 * n * sizeof(std::uint32_t), [] {
+        std::vector<std::uint32_t> out;
+        std::set_union(long_list().begin(), long_list().end(), similar_list().begin(), similar_list().end(), std::back_inserter(out));
+        return checksum(seq::as_sequence(out));
+    }, bench::baseline };
+    bench::registration union_seq { "set_union", "set_union", 2 * n, 2 * n * sizeof(std::uint32_t), [] {
+        return checksum(seq::set_union(long_list(), similar_list()));
+    } };
+
+    bench::registration difference_std { "set_difference skewed", "std::set_difference", n + n / 256, (n + n / 256) * sizeof(std::uint32_t), [] {
+        std::vector<std::uint32_t> out;
+        std::set_difference(short_list().begin(), short_list().end(), long_list().begin(), long_list().end(), std::back_inserter(out));
+        return checksum(seq::as_sequence(out));
+    }, bench::baseline };
+    bench::registration difference { "set_difference skewed", "set_difference", n + n / 256, (n + n / 256) * sizeof(std::uint32_t), [] {
+        return checksum(seq::set_difference(short_list(), long_list()));
+    } };
+} // namespace
@@ -0,0 +1,85 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/unique.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/unique.h++>
+#include <taussig/primitives.h++>
+
+#include <algorithm> // min
+#include <cstdint>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 20;
+
+    // sorted values in runs of pseudo-random lengths below `longest`
+    std::vector<std::uint32_t> runs(std::uint32_t longest) {
+        std::vector<std::uint32_t> v;
+        v.reserve(n);
+        std::uint32_t x = 1;
+        for(std::uint32_t value = 0; v.size() < n; ++value) {
+            x = x * 1664525u + 1013904223u;
+            v.insert(v.end(), std::min<std::size_t>(1 + (x >> 16) % longest, n - v.size()), value);
+        }
+        return v;
+    }
+    std::vector<std::uint32_t> const& short_runs() {
+        static std::vector<std::uint32_t> v = runs(4);
+        return v;
+    }
+    std::vector<std::uint32_t> const& long_runs() {
+        static std::vector<std::uint32_t> v = runs(128);
+        return v;
+    }
+
+    std::uint64_t loop(std::vector<std::uint32_t> const& v) {
+        std::uint64_t total = 0;
+        std::size_t run = 1;
+        for(std::size_t i = 1; i <= v.size(); ++i) {
+            if(i == v.size() || v[i] != v[i - 1]) {
+                total += v[i - 1] * run;
+                run = 1;
+            } else ++run;
+        }
+        return total;
+    }
+    template <typename S>
+    std::uint64_t sum(S s) {
+        std::uint64_t total = 0;
+        for(; !seq::empty(s); seq::pop_front(s)) {
+            auto run = seq::front(s);
+            total += run.first * run.second;
+        }
+        return total;
+    }
+
+    bench::registration short_loop { "rle short runs", "loop", n, n * sizeof(std::uint32_t), [] {
+        return loop(short_runs());
+    }, bench::baseline };
+    bench::registration short_rle { "rle short runs", "rle", n, n * sizeof(std::uint32_t), [] {
+        return sum(seq::rle(seq::as_sequence(short_runs())));
+    }, bench::max_ratio{ 1.5 } };
+
+    bench::registration long_loop { "rle long runs", "loop", n, n * sizeof(std::uint32_t), [] {
+        return loop(long_runs());
+    }, bench::baseline };
+    bench::registration long_rle { "rle long runs", "rle", n, n * sizeof(std::uint32_t), [] {
+        return sum(seq::rle(seq::as_sequence(long_runs())));
+    } };
+    bench::registration long_unique { "rle long runs", "unique", n, n * sizeof(std::uint32_t), [] {
+        std::uint64_t total = 0;
+        for(auto s = seq::unique(seq::as_sequence(long_runs())); !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+        return total;
+    } };
+} // namespace
@@ -0,0 +1,63 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Benchmarks for <taussig/algorithms/zip.h++>
+
+#include "benchmark.h++"
+
+#include <taussig/algorithms/zip.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace {
+    std::size_t const n = 1 << 16;
+
+    std::vector<int> const& prices() {
+        static std::vector<int> v = [] {
+            std::vector<int> v(n);
+            for(std::size_t i = 0; i < n; ++i) v[i] = int(i % 1000);
+            return v;
+        }();
+        return v;
+    }
+    std::vector<int> const& quantities() {
+        static std::vector<int> v = [] {
+            std::vector<int> v(n);
+            for(std::size_t i = 0; i < n; ++i) v[i] = int(i % 7);
+            return v;
+        }();
+        return v;
+    }
+
+    bench::registration loop { "zip", "loop", n, 2 * n * sizeof(int), [] {
+        auto const& p = prices();
+        auto const& q = quantities();
+        std::uint64_t total = 0;
+        for(std::size_t i = 0; i < p.size() && i < q.size(); ++i) total += p[i] * q[i];
+        return total;
+    }, bench::baseline };
+    bench::registration zip { "zip", "zip", n, 2 * n * sizeof(int), [] {
+        std::uint64_t total = 0;
+        for(auto s = seq::zip(seq::as_sequence(prices()), seq::as_sequence(quantities())); !seq::empty(s); seq::pop_front(s)) {
+            auto row = seq::front(s);
+            total += std::get<0>(row) * std::get<1>(row);
+        }
+        return total;
+    }, bench::max_ratio{ 2 } };
+    bench::registration soa { "zip", "materialize_soa", n, 2 * n * sizeof(int), [] {
+        auto columns = seq::materialize_soa(seq::zip(seq::as_sequence(prices()), seq::as_sequence(quantities())));
+        return std::uint64_t(std::get<0>(columns).back() + std::get<1>(columns).back());
+    } };
+} // namespace
@@ -33,7 +33,7 @@ def object_file(fn):
 
 dependencies = ['catch', 'wheels']
 include_flags = flags([include('include')], map(dependency_include, dependencies))
-cxx_flags = flags(['-Wall', '-Wextra', '-Wfatal-errors', '-Werror', '-std=c++11', '-O3'])
+cxx_flags = flags(['-Wall', '-Wextra', '-Wfatal-errors', '-Werror', '-std=c++11', '-O3', '-pthread'])
 ld_flags = flags(['-flto'])
 
 parser = argparse.ArgumentParser()
@@ -68,6 +68,18 @@ ninja.rule('lib',
         command = 'ar rc $out $in && ranlib $out',
         description = 'AR $in')
 
+ninja.rule('run',
+        command = '$in $args',
+        description = 'RUN $in')
+
+ninja.rule('codegen',
+        command = 'python bench/codegen.py --cxx ' + args.cxx + ' --check',
+        description = 'CODEGEN $in')
+
+ninja.rule('compile_time',
+        command = 'python bench/compile_time.py --cxx ' + args.cxx,
+        description = 'COMPILE TIME')
+
 ninja.rule('dist',
         command = 'tar cjf $out $in',
         description = 'TAR $in')
@@ -102,6 +114,28 @@ ninja.build('test', 'phony',
 ninja.build('lib', 'phony',
         inputs = libtaussig)
 
+bench_src_files = [fn for fn in get_files('bench', '*.c++') if not fn.startswith(os.path.join('bench', 'codegen'))]
+bench_obj_files = [object_file(fn) for fn in bench_src_files]
+for fn in bench_src_files:
+    ninja.build(object_file(fn), 'cxx',
+            inputs = fn)
+
+bench_runner = 'bin/bench'
+ninja.build(bench_runner, 'link',
+        inputs = bench_obj_files + [object_file(os.path.join('test', 'allocations.c++')), libtaussig])
+ninja.build('bench', 'phony',
+        inputs = bench_runner)
+ninja.build('bench_check', 'run',
+        inputs = bench_runner,
+        variables = { 'args': '--check' })
+
+codegen_src_files = list(get_files(os.path.join('bench', 'codegen'), '*.c++'))
+ninja.build('codegen', 'codegen',
+        inputs = codegen_src_files,
+        implicit = hdr_files + ['bench/codegen.py'])
+ninja.build('compile_time', 'compile_time',
+        implicit = hdr_files + ['bench/compile_time.py'])
+
 tar = 'dist/taussig.tar.bz2'
 ninja.build(tar, 'dist',
         inputs = hdr_files + ([libtaussig] if src_files else []))
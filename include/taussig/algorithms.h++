@@ -18,10 +18,33 @@
 
 #include <taussig/algorithms/consume.h++>
 #include <taussig/algorithms/equal.h++>
+#include <taussig/algorithms/find.h++>
+#include <taussig/algorithms/count.h++>
+#include <taussig/algorithms/any_of.h++>
+#include <taussig/algorithms/search.h++>
+#include <taussig/algorithms/match_all.h++>
 
 #include <taussig/algorithms/map.h++>
 #include <taussig/algorithms/flatten.h++>
 #include <taussig/algorithms/flat_map.h++>
+#include <taussig/algorithms/ascii.h++>
+#include <taussig/algorithms/normalize.h++>
+#include <taussig/algorithms/fold.h++>
+#include <taussig/algorithms/scan.h++>
+#include <taussig/algorithms/zip.h++>
+#include <taussig/algorithms/segments.h++>
+#include <taussig/algorithms/concat.h++>
+#include <taussig/algorithms/chunk.h++>
+#include <taussig/algorithms/window.h++>
+#include <taussig/algorithms/cdc_chunks.h++>
+#include <taussig/algorithms/group_by.h++>
+#include <taussig/algorithms/aggregate_by_key.h++>
+#include <taussig/algorithms/distinct.h++>
+#include <taussig/algorithms/unique.h++>
+#include <taussig/algorithms/external_sort.h++>
+#include <taussig/algorithms/merge.h++>
+#include <taussig/algorithms/set_operations.h++>
+#include <taussig/algorithms/probe.h++>
 
 #endif // TAUSSIG_ALGORITHMS_HPP
 
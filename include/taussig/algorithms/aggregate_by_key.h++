@@ -0,0 +1,173 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Hash aggregation
+
+#ifndef TAUSSIG_ALGORITHMS_AGGREGATE_BY_KEY_HPP
+#define TAUSSIG_ALGORITHMS_AGGREGATE_BY_KEY_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/flat_table.h++>
+#include <taussig/detail/fun_objects.h++>
+#include <taussig/detail/parallel.h++>
+
+#include <wheels/fun/result_of.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <functional> // hash
+#include <iterator> // make_move_iterator
+#include <utility> // move, pair
+#include <vector>
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+
+namespace seq {
+    namespace detail {
+        struct first_of {
+            template <typename P>
+            typename P::first_type const& operator()(P const& p) const { return p.first; }
+        };
+
+        template <typename K, typename T>
+        using aggregate_table = flat_table<std::pair<K, T>, first_of, std::hash<K>, equal_to>;
+
+        template <typename S, typename KeyFun>
+        using AggregateKey = wheels::meta::Decay<wheels::fun::ResultOf<KeyFun&(ReferenceType<S>)>>;
+
+        template <typename K, typename T>
+        std::vector<std::pair<K, T>> drain(aggregate_table<K, T>& table) {
+            std::vector<std::pair<K, T>> result;
+            result.reserve(table.size());
+            table.for_each([&result](std::pair<K, T>& entry) { result.push_back(std::move(entry)); });
+            return result;
+        }
+
+        template <typename Table, typename K, typename T, typename Fun, typename R>
+        void aggregate_into(Table& table, K&& key, std::uint64_t mixed, T const& init, Fun& fun, R&& x) {
+            auto entry = table.insert(key, mixed, [&key, &init] { return std::pair<wheels::meta::Decay<K>, T>(std::move(key), init); });
+            entry.first->second = fun(std::move(entry.first->second), std::forward<R>(x));
+        }
+
+        template <typename S, typename KeyFun, typename T, typename Fun>
+        std::vector<std::pair<AggregateKey<S, KeyFun>, T>> aggregate(S& s, KeyFun& key_fun, T const& init, Fun& fun) {
+            using key_type = AggregateKey<S, KeyFun>;
+            aggregate_table<key_type, T> table;
+            std::hash<key_type> hash;
+            for(; !seq::empty(s); seq::pop_front(s)) {
+                ReferenceType<S> x = seq::front(s);
+                key_type key = key_fun(x);
+                auto const mixed = mix_hash(hash(key));
+                aggregate_into(table, std::move(key), mixed, init, fun, std::forward<ReferenceType<S>>(x));
+            }
+            return drain(table);
+        }
+
+        template <typename S, typename KeyFun, typename T, typename Fun, typename Merge>
+        std::vector<std::pair<AggregateKey<S, KeyFun>, T>> aggregate_parallel(S& s, KeyFun& key_fun, T const& init, Fun& fun, Merge&,
+                                                                              parallel_policy, wheels::meta::False) {
+            return aggregate(s, key_fun, init, fun);
+        }
+
+        // Each thread aggregates a slice of the input into one table per partition of the hash
+        // space; then each thread merges one partition from all the others, so no table is
+        // shared while it is written.
+        template <typename S, typename KeyFun, typename T, typename Fun, typename Merge>
+        std::vector<std::pair<AggregateKey<S, KeyFun>, T>> aggregate_parallel(S& s, KeyFun& key_fun, T const& init, Fun& fun, Merge& merge,
+                                                                              parallel_policy policy, wheels::meta::True) {
+            using key_type = AggregateKey<S, KeyFun>;
+            using table = aggregate_table<key_type, T>;
+            auto const n = static_cast<std::size_t>(s.second - s.first);
+            auto const chunks = chunk_count(policy, n);
+            if(chunks < 2) return aggregate(s, key_fun, init, fun);
+
+            unsigned bits = 0;
+            while((std::size_t(1) << bits) < chunks) ++bits;
+            std::size_t const partitions = std::size_t(1) << bits;
+
+            auto partial = for_each_chunk(n, chunks, [&](std::size_t, std::size_t first, std::size_t last) {
+                std::vector<table> parts(partitions);
+                std::hash<key_type> hash;
+                for(S part { s.first + first, s.first + last }; !seq::empty(part); seq::pop_front(part)) {
+                    ReferenceType<S> x = seq::front(part);
+                    key_type key = key_fun(x);
+                    auto const mixed = mix_hash(hash(key));
+                    aggregate_into(parts[mixed >> (64 - bits)], std::move(key), mixed, init, fun, std::forward<ReferenceType<S>>(x));
+                }
+                return parts;
+            });
+
+            auto merged = for_each_chunk(partitions, partitions, [&](std::size_t p, std::size_t, std::size_t) {
+                table result = std::move(partial[0][p]);
+                for(std::size_t t = 1; t < partial.size(); ++t) {
+                    partial[t][p].for_each([&result, &merge](std::pair<key_type, T>& entry) {
+                        auto found = result.insert(entry.first, [&entry] { return std::move(entry); });
+                        if(!found.second) found.first->second = merge(std::move(found.first->second), std::move(entry.second));
+                    });
+                }
+                return drain(result);
+            });
+
+            std::vector<std::pair<key_type, T>> result;
+            for(auto& part : merged) {
+                result.insert(result.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+            }
+            return result;
+        }
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft]; `key_fun` can be called with an element of `s`, and
+    //!             its results can be hashed with `std::hash` and compared for equality [soft];
+    //!             `fun` can be called with a `T` and an element of `s` and its result converts to
+    //!             `T` [soft].
+    //! *Returns*: one pair for each distinct key that `key_fun` returns for the elements of `s`,
+    //!            holding that key and the fold with `fun` from `init` of the elements with it, in
+    //!            no particular order.
+    //! *Note*: the elements with each key are folded in the order they appear in `s`. Keys are
+    //!         aggregated in an open-addressing table probed sixteen control bytes at a time.
+    template <typename S, typename KeyFun, typename T, typename Fun,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<KeyFun&, void(ReferenceType<S>)>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Fun&, void(T, ReferenceType<S>)>>...>
+    std::vector<std::pair<detail::AggregateKey<S, KeyFun>, T>> aggregate_by_key(S s, KeyFun key_fun, T init, Fun fun) {
+        return detail::aggregate(s, key_fun, init, fun);
+    }
+
+    //! {function}
+    //! *Requires*: as for `aggregate_by_key(s, key_fun, init, fun)`; `merge` can be called with two
+    //!             `T`s and combines partial results so that folding a run of elements in two parts
+    //!             and merging them gives the fold of the whole run [undefined]; `key_fun`, `fun`
+    //!             and `merge` may be called concurrently [undefined].
+    //! *Returns*: as `aggregate_by_key(s, key_fun, init, fun)`.
+    //! *Effects*: random-access sequences are split into slices that are aggregated on separate
+    //!            threads into tables partitioned by hash, and each partition is then merged on
+    //!            its own thread; other sequences are aggregated on the calling thread.
+    template <typename S, typename KeyFun, typename T, typename Fun, typename Merge,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<KeyFun&, void(ReferenceType<S>)>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Fun&, void(T, ReferenceType<S>)>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Merge&, void(T, T)>>...>
+    std::vector<std::pair<detail::AggregateKey<S, KeyFun>, T>> aggregate_by_key(S s, KeyFun key_fun, T init, Fun fun, Merge merge,
+                                                                                parallel_policy policy) {
+        return detail::aggregate_parallel(s, key_fun, init, fun, merge, policy, detail::is_random_access_sequence<S>{});
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_AGGREGATE_BY_KEY_HPP
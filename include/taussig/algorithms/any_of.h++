@@ -0,0 +1,65 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence any_of(), all_of(), and none_of() algorithms
+
+#ifndef TAUSSIG_ALGORITHMS_ANY_OF_HPP
+#define TAUSSIG_ALGORITHMS_ANY_OF_HPP
+
+#include <taussig/algorithms/find.h++>
+
+#include <taussig/primitives/empty.h++>
+
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+
+#include <taussig/detail/fun_objects.h++>
+
+#include <wheels/meta/enable_if.h++>
+
+#include <utility> // forward, move
+
+namespace seq {
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft], and `Pred` is a predicate [soft].
+    //! *Returns*: `true` if at least one element of `s` satisfies `pred`;
+    //!            `false` otherwise.
+    template <typename S, typename Pred,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<detail::is_predicate<Pred, ReferenceType<S>>>...>
+    bool any_of(S s, Pred&& pred) {
+        return !seq::empty(seq::find_if(std::move(s), std::forward<Pred>(pred)));
+    }
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft], and `Pred` is a predicate [soft].
+    //! *Returns*: `true` if all elements of `s` satisfy `pred`;
+    //!            `false` otherwise.
+    template <typename S, typename Pred,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<detail::is_predicate<Pred, ReferenceType<S>>>...>
+    bool all_of(S s, Pred&& pred) {
+        return seq::empty(seq::find_if(std::move(s), detail::negation<Pred>{ std::forward<Pred>(pred) }));
+    }
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft], and `Pred` is a predicate [soft].
+    //! *Returns*: `true` if no element of `s` satisfies `pred`;
+    //!            `false` otherwise.
+    template <typename S, typename Pred,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<detail::is_predicate<Pred, ReferenceType<S>>>...>
+    bool none_of(S s, Pred&& pred) {
+        return !seq::any_of(std::move(s), std::forward<Pred>(pred));
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_ANY_OF_HPP
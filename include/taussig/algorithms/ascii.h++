@@ -0,0 +1,138 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// ASCII case folding adaptors, classification predicates, and iequal() algorithm
+
+#ifndef TAUSSIG_ALGORITHMS_ASCII_HPP
+#define TAUSSIG_ALGORITHMS_ASCII_HPP
+
+#include <taussig/algorithms/map.h++>
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/value_type.h++>
+
+#include <taussig/detail/ascii.h++>
+#include <taussig/detail/characters.h++>
+#include <taussig/detail/contiguous.h++>
+
+#include <wheels/meta/all.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/unqual.h++>
+
+#include <type_traits> // is_same
+#include <utility> // forward, move
+#include <cstdint> // uint8_t
+
+namespace seq {
+    namespace detail {
+        struct ascii_lower_fn {
+            template <typename Char>
+            wheels::meta::Decay<Char> operator()(Char&& c) const { return ascii_fold_lower(wheels::meta::Decay<Char>(c)); }
+        };
+        struct ascii_upper_fn {
+            template <typename Char>
+            wheels::meta::Decay<Char> operator()(Char&& c) const { return ascii_fold_upper(wheels::meta::Decay<Char>(c)); }
+        };
+    } // namespace detail
+
+    //! {class}
+    //! A predicate that tests characters for membership in the given ASCII classes.
+    //! *Note*: characters outside the ASCII range never satisfy it; no locale is involved.
+    template <std::uint8_t Mask>
+    struct ascii_predicate {
+        template <typename Char>
+        bool operator()(Char c) const { return detail::ascii_is(c, Mask); }
+    };
+    using ascii_is_alpha = ascii_predicate<detail::ascii_alpha>;
+    using ascii_is_digit = ascii_predicate<detail::ascii_digit>;
+    using ascii_is_alnum = ascii_predicate<detail::ascii_alpha | detail::ascii_digit>;
+    using ascii_is_space = ascii_predicate<detail::ascii_space>;
+    using ascii_is_upper = ascii_predicate<detail::ascii_upper>;
+    using ascii_is_lower = ascii_predicate<detail::ascii_lower>;
+    using ascii_is_punct = ascii_predicate<detail::ascii_punct>;
+    using ascii_is_xdigit = ascii_predicate<detail::ascii_xdigit>;
+
+    namespace result_of {
+        template <typename Seq>
+        using ascii_lower = map_sequence<detail::ascii_lower_fn, Seq>;
+        template <typename Seq>
+        using ascii_upper = map_sequence<detail::ascii_upper_fn, Seq>;
+    } // namespace result_of
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence of characters [soft].
+    //! *Returns*: a sequence with the elements of `s`, with ASCII uppercase letters mapped to lowercase.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    result_of::ascii_lower<Seq> ascii_lower(Seq&& s) {
+        return { detail::ascii_lower_fn{}, std::forward<Seq>(s) };
+    }
+    //! {function}
+    //! *Requires*: `Seq` is a sequence of characters [soft].
+    //! *Returns*: a sequence with the elements of `s`, with ASCII lowercase letters mapped to uppercase.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    result_of::ascii_upper<Seq> ascii_upper(Seq&& s) {
+        return { detail::ascii_upper_fn{}, std::forward<Seq>(s) };
+    }
+
+    namespace detail {
+        template <typename S, typename R,
+                  bool = is_contiguous_sequence<S>() && is_contiguous_sequence<R>()>
+        struct is_ascii_kernel_comparable : wheels::meta::False {};
+        template <typename S, typename R>
+        struct is_ascii_kernel_comparable<S, R, true>
+        : wheels::meta::All<
+            is_character<wheels::meta::Unqual<ValueType<S>>>,
+            std::is_same<wheels::meta::Unqual<ValueType<S>>, wheels::meta::Unqual<ValueType<R>>>
+        > {};
+
+        template <typename S, typename R,
+                  bool = is_ascii_kernel_comparable<S, R>()>
+        struct iequal {
+            static bool call(S s, R r) {
+                while(!seq::empty(s) && !seq::empty(r)) {
+                    if(ascii_fold_lower(seq::front(s)) != ascii_fold_lower(seq::front(r))) return false;
+                    seq::pop_front(s);
+                    seq::pop_front(r);
+                }
+                return seq::empty(s) == seq::empty(r);
+            }
+        };
+        template <typename S, typename R>
+        struct iequal<S, R, true> {
+            static bool call(S const& s, R const& r) {
+                auto const n = contiguous_size(s);
+                return n == contiguous_size(r)
+                    && (n == 0 || ascii_iequal(contiguous_data(s), contiguous_data(r), n));
+            }
+        };
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` and `R` are sequences of characters [soft].
+    //! *Returns*: `true` if `s` and `r` have the same elements in the same order, ignoring ASCII case;
+    //!            `false` otherwise.
+    //! *Note*: contiguous sequences of the same character type are compared in SIMD blocks.
+    template <typename S, typename R,
+              wheels::meta::EnableIf<is_sequence<S>, is_sequence<R>>...>
+    bool iequal(S s, R r) {
+        return detail::iequal<S, R>::call(std::move(s), std::move(r));
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_ASCII_HPP
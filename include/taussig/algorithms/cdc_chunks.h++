@@ -0,0 +1,191 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Content-defined chunking
+
+#ifndef TAUSSIG_ALGORITHMS_CDC_CHUNKS_HPP
+#define TAUSSIG_ALGORITHMS_CDC_CHUNKS_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/cdc.h++>
+#include <taussig/detail/contiguous.h++>
+
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <cassert>
+#include <type_traits> // is_integral, is_same
+#include <utility> // forward, pair, declval
+#include <vector>
+#include <cstddef> // size_t, ptrdiff_t
+#include <cstdint> // uint64_t
+
+namespace seq {
+    //! {class}
+    //! Chunk size limits for `cdc_chunks`.
+    //! *Note*: `avg_size` is rounded down to a power of two; `normalization` is how many mask bits
+    //!         are added before that size and removed after it, which narrows the spread of
+    //!         chunk sizes around it.
+    struct cdc_params {
+        constexpr cdc_params(std::size_t min_size = 2048, std::size_t avg_size = 8192, std::size_t max_size = 65536,
+                             unsigned normalization = 2)
+        : min_size(min_size), avg_size(avg_size), max_size(max_size), normalization(normalization) {}
+
+        std::size_t min_size;
+        std::size_t avg_size;
+        std::size_t max_size;
+        unsigned normalization;
+    };
+
+    namespace detail {
+        template <typename V>
+        struct is_byte : wheels::meta::Bool<std::is_integral<V>() && sizeof(V) == 1 && !std::is_same<V, bool>()> {};
+
+        struct cdc_cutter {
+            explicit cdc_cutter(cdc_params const& params) : params(params) {
+                unsigned bits = 0;
+                while((std::size_t(2) << bits) <= params.avg_size) ++bits;
+                mask_small = gear_mask(bits + params.normalization);
+                mask_large = gear_mask(bits > params.normalization? bits - params.normalization : 0);
+            }
+
+            template <typename Byte>
+            std::size_t operator()(Byte const* p, std::size_t n) const {
+                return cdc_cut(p, n, params.min_size, params.avg_size, params.max_size, mask_small, mask_large);
+            }
+
+            cdc_params params;
+            std::uint64_t mask_small;
+            std::uint64_t mask_large;
+        };
+    } // namespace detail
+
+    template <typename Seq,
+              bool = detail::is_contiguous_sequence<wheels::meta::Decay<Seq>>()>
+    struct cdc_chunk_sequence;
+
+    // contiguous sequences are cut in place
+    template <typename Seq>
+    struct cdc_chunk_sequence<Seq, true> : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+    public:
+        template <typename SeqF>
+        cdc_chunk_sequence(SeqF&& s, cdc_params const& params)
+        : s(std::forward<SeqF>(s)), cut(params) {
+            next();
+        }
+
+        using reference = seq_type;
+        using value_type = seq_type;
+
+        bool empty() const { return s.first == s.second; }
+        void pop_front() {
+            s.first += static_cast<std::ptrdiff_t>(length);
+            next();
+        }
+        reference front() const { return { s.first, s.first + static_cast<std::ptrdiff_t>(length) }; }
+
+    private:
+        seq_type s;
+        detail::cdc_cutter cut;
+        std::size_t length;
+
+        void next() {
+            auto const n = detail::contiguous_size(s);
+            length = n == 0? 0 : cut(detail::contiguous_data(s), n);
+        }
+    };
+
+    // Other sequences are read into a buffer of twice the largest chunk, which is topped up
+    // whenever less than a largest chunk is left, so each byte is moved at most once.
+    template <typename Seq>
+    struct cdc_chunk_sequence<Seq, false> : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using buffer_type = std::vector<ValueType<seq_type>>;
+    public:
+        template <typename SeqF>
+        cdc_chunk_sequence(SeqF&& s, cdc_params const& params)
+        : s(std::forward<SeqF>(s)), cut(params) {
+            buffer.reserve(2 * params.max_size);
+            fill();
+            next();
+        }
+
+        using reference = std::pair<typename buffer_type::const_iterator, typename buffer_type::const_iterator>;
+        using value_type = reference;
+
+        bool empty() const { return start == buffer.size(); }
+        void pop_front() {
+            start += length;
+            if(buffer.size() - start < cut.params.max_size) fill();
+            next();
+        }
+        reference front() const {
+            auto const first = buffer.begin() + static_cast<std::ptrdiff_t>(start);
+            return { first, first + static_cast<std::ptrdiff_t>(length) };
+        }
+
+    private:
+        seq_type s;
+        detail::cdc_cutter cut;
+        buffer_type buffer;
+        std::size_t start = 0;
+        std::size_t length = 0;
+
+        void fill() {
+            buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(start));
+            start = 0;
+            for(; buffer.size() < 2 * cut.params.max_size && !seq::empty(s); seq::pop_front(s)) {
+                buffer.push_back(seq::front(s));
+            }
+        }
+        void next() {
+            length = start == buffer.size()? 0 : cut(buffer.data() + start, buffer.size() - start);
+        }
+    };
+    static_assert(is_true_sequence<cdc_chunk_sequence<fake_sequence<char>>>(), "cdc_chunk_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence of bytes [soft];
+    //!             `0 < params.min_size <= params.avg_size <= params.max_size` [undefined].
+    //! *Returns*: a sequence of consecutive chunks of `s` whose boundaries depend only on the
+    //!            bytes near them, found with a Gear rolling hash as in FastCDC; each chunk is
+    //!            between `params.min_size` and `params.max_size` bytes long, except maybe the last.
+    //!            Each chunk is itself a contiguous sequence.
+    //! *Note*: chunks of contiguous sequences are slices of `s` and copy nothing. Other sequences
+    //!         are copied through a buffer of `2 * params.max_size` bytes, so each chunk is only
+    //!         valid until the next `pop_front`.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<detail::is_byte<ValueType<wheels::meta::Decay<Seq>>>>...>
+    cdc_chunk_sequence<Seq> cdc_chunks(Seq&& s, cdc_params const& params = cdc_params()) {
+        assert(0 < params.min_size && params.min_size <= params.avg_size && params.avg_size <= params.max_size);
+        return { std::forward<Seq>(s), params };
+    }
+
+    namespace result_of {
+        template <typename Seq>
+        using cdc_chunks = decltype(seq::cdc_chunks(std::declval<Seq>()));
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_CDC_CHUNKS_HPP
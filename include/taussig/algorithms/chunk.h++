@@ -0,0 +1,123 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence chunk() algorithm
+
+#ifndef TAUSSIG_ALGORITHMS_CHUNK_HPP
+#define TAUSSIG_ALGORITHMS_CHUNK_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/contiguous.h++>
+
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <algorithm> // min
+#include <cassert>
+#include <utility> // forward, pair, declval
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    template <typename Seq,
+              bool = detail::is_random_access_sequence<wheels::meta::Decay<Seq>>()>
+    struct chunk_sequence;
+
+    // random-access sequences are sliced in place
+    template <typename Seq>
+    struct chunk_sequence<Seq, true> : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+    public:
+        template <typename SeqF>
+        chunk_sequence(SeqF&& s, std::size_t n)
+        : s(std::forward<SeqF>(s)), n(n) {}
+
+        using reference = seq_type;
+        using value_type = seq_type;
+
+        bool empty() const { return s.first == s.second; }
+        void pop_front() { s.first += step(); }
+        reference front() const { return { s.first, s.first + step() }; }
+
+    private:
+        seq_type s;
+        std::size_t n;
+
+        std::ptrdiff_t step() const {
+            return static_cast<std::ptrdiff_t>(std::min<std::size_t>(n, static_cast<std::size_t>(s.second - s.first)));
+        }
+    };
+
+    // other sequences are copied into a buffer that is reused for every chunk
+    template <typename Seq>
+    struct chunk_sequence<Seq, false> : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using buffer_type = std::vector<ValueType<seq_type>>;
+    public:
+        template <typename SeqF>
+        chunk_sequence(SeqF&& s, std::size_t n)
+        : s(std::forward<SeqF>(s)), n(n) {
+            buffer.reserve(n);
+            fill();
+        }
+
+        using reference = std::pair<typename buffer_type::const_iterator, typename buffer_type::const_iterator>;
+        using value_type = reference;
+
+        bool empty() const { return buffer.empty(); }
+        void pop_front() { fill(); }
+        reference front() const { return { buffer.begin(), buffer.end() }; }
+
+    private:
+        seq_type s;
+        std::size_t n;
+        buffer_type buffer;
+
+        void fill() {
+            buffer.clear();
+            for(; buffer.size() < n && !seq::empty(s); seq::pop_front(s)) {
+                buffer.push_back(seq::front(s));
+            }
+        }
+    };
+    static_assert(is_true_sequence<chunk_sequence<fake_sequence<int>>>(), "chunk_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; `n > 0` [undefined].
+    //! *Returns*: a sequence of consecutive chunks of `n` elements of `s`, the last of which may be
+    //!            shorter; each chunk is itself a contiguous or random-access sequence.
+    //! *Note*: chunks of random-access sequences are slices of `s` and copy nothing. Other
+    //!         sequences are copied into a buffer allocated once and reused, so each chunk is only
+    //!         valid until the next `pop_front`.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    chunk_sequence<Seq> chunk(Seq&& s, std::size_t n) {
+        assert(n > 0);
+        return { std::forward<Seq>(s), n };
+    }
+
+    namespace result_of {
+        template <typename Seq>
+        using chunk = decltype(seq::chunk(std::declval<Seq>(), std::size_t()));
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_CHUNK_HPP
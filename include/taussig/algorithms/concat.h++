@@ -0,0 +1,136 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence concat() algorithm
+
+#ifndef TAUSSIG_ALGORITHMS_CONCAT_HPP
+#define TAUSSIG_ALGORITHMS_CONCAT_HPP
+
+#include <taussig/algorithms/segments.h++>
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <tuple>
+#include <type_traits> // common_type, conditional, integral_constant, is_same
+#include <utility> // forward, move, declval
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        template <typename T, typename... Ts>
+        struct all_same : std::is_same<std::tuple<T, Ts...>, std::tuple<Ts..., T>> {};
+
+        // segments with the same reference type keep it; mixed ones yield values of a common type
+        template <typename... R>
+        using ConcatReference = typename std::conditional<
+                                    all_same<R...>::value,
+                                    std::tuple_element<0, std::tuple<R...>>,
+                                    std::common_type<wheels::meta::Decay<R>...>
+                                >::type::type;
+    } // namespace detail
+
+    template <typename... Seqs>
+    struct concat_sequence : true_sequence {
+    private:
+        static constexpr std::size_t last = sizeof...(Seqs) - 1;
+
+        template <std::size_t I>
+        using index = std::integral_constant<std::size_t, I>;
+
+    public:
+        using segments_type = std::tuple<wheels::meta::Decay<Seqs>...>;
+
+        explicit concat_sequence(segments_type segments)
+        : segs(std::move(segments)) {
+            advance(index<0>{});
+        }
+
+        using reference = detail::ConcatReference<ReferenceType<wheels::meta::Decay<Seqs>>...>;
+        using value_type = wheels::meta::Decay<reference>;
+
+        bool empty() const { return current > last; }
+        void pop_front() { pop_front(index<0>{}); }
+        reference front() const { return front(index<0>{}); }
+
+        //! {function}
+        //! *Returns*: the concatenated sequences, as they are now; the ones before the current one
+        //!            are empty.
+        segments_type const& segments() const { return segs; }
+
+    private:
+        segments_type segs;
+        std::size_t current = 0; // the first segment that is not empty
+
+        // each operation tests the current segment index against each segment in turn; the last
+        // segment needs no test because the sequence is not empty
+
+        template <std::size_t I>
+        reference front(index<I>) const {
+            return current == I? static_cast<reference>(seq::front(std::get<I>(segs))) : front(index<I + 1>{});
+        }
+        reference front(index<last>) const {
+            return seq::front(std::get<last>(segs));
+        }
+
+        template <std::size_t I>
+        void pop_front(index<I>) {
+            if(current != I) return pop_front(index<I + 1>{});
+            seq::pop_front(std::get<I>(segs));
+            if(seq::empty(std::get<I>(segs))) advance(index<I + 1>{});
+        }
+        void pop_front(index<last>) {
+            seq::pop_front(std::get<last>(segs));
+            if(seq::empty(std::get<last>(segs))) current = last + 1;
+        }
+
+        // skips to the first segment from I on that is not empty
+        template <std::size_t I>
+        void advance(index<I>) {
+            current = I;
+            if(seq::empty(std::get<I>(segs))) advance(index<I + 1>{});
+        }
+        void advance(index<last + 1>) {
+            current = last + 1;
+        }
+    };
+    static_assert(is_true_sequence<concat_sequence<fake_sequence<int>, fake_sequence<long>>>(), "concat_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` and all `Seqs` are sequences [soft].
+    //! *Returns*: a sequence with the elements of all the sequences, one after the other.
+    //! *Note*: if the sequences have different reference types, the elements are values of their
+    //!         common type. Only the segment-aware terminals `fold`, `reduce` and `count` run a
+    //!         separate loop over each segment; see `for_each_segment`. Anything else walks the
+    //!         result element by element, choosing the current segment on every call, which costs
+    //!         several times as much as a loop over the segments.
+    template <typename Seq, typename... Seqs,
+              wheels::meta::EnableIf<is_sequence<Seq>, is_sequence<Seqs>...>...>
+    concat_sequence<Seq, Seqs...> concat(Seq&& s, Seqs&&... ss) {
+        return concat_sequence<Seq, Seqs...>(typename concat_sequence<Seq, Seqs...>::segments_type(std::forward<Seq>(s), std::forward<Seqs>(ss)...));
+    }
+
+    namespace result_of {
+        template <typename... Seqs>
+        using concat = decltype(seq::concat(std::declval<Seqs>()...));
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_CONCAT_HPP
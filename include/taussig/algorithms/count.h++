@@ -0,0 +1,112 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence count() and count_if() algorithms
+
+#ifndef TAUSSIG_ALGORITHMS_COUNT_HPP
+#define TAUSSIG_ALGORITHMS_COUNT_HPP
+
+#include <taussig/algorithms/find.h++> // is_kernel_searchable
+#include <taussig/algorithms/segments.h++>
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/find_kernels.h++>
+#include <taussig/detail/fun_objects.h++>
+
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        template <typename S, typename T,
+                  bool = is_kernel_searchable<S, T>()>
+        struct count {
+            static std::size_t call(S s, T const& value) {
+                std::size_t n = 0;
+                for(; !seq::empty(s); seq::pop_front(s)) {
+                    if(detail::equal_to{}(seq::front(s), value)) ++n;
+                }
+                return n;
+            }
+        };
+        template <typename S, typename T>
+        struct count<S, T, true> {
+            static std::size_t call(S const& s, T const& value) {
+                auto const narrowed = static_cast<ValueType<S>>(value);
+                if(!detail::equal_to{}(narrowed, value)) return 0;
+                return detail::count_value(detail::contiguous_data(s), detail::contiguous_size(s), narrowed);
+            }
+        };
+
+        template <typename S, typename T>
+        std::size_t count_segments(S const& s, T const& value, wheels::meta::False) {
+            return count<S, T>::call(s, value);
+        }
+        template <typename S, typename T>
+        std::size_t count_segments(S const& s, T const& value, wheels::meta::True);
+
+        template <typename T>
+        struct count_segment {
+            template <typename S>
+            void operator()(S const& s) const {
+                n += count_segments(s, value, is_segmented<S>{});
+            }
+
+            T const& value;
+            std::size_t& n;
+        };
+
+        // each segment is counted with its own kernel
+        template <typename S, typename T>
+        std::size_t count_segments(S const& s, T const& value, wheels::meta::True) {
+            std::size_t n = 0;
+            for_each_segment(s, count_segment<T> { value, n });
+            return n;
+        }
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft] and its elements are comparable with `value`.
+    //! *Returns*: the number of elements of `s` equal to `value`.
+    //! *Complexity*: linear; contiguous sequences of integral values are counted in blocks, and
+    //!               so are contiguous segments of segmented sequences.
+    template <typename S, typename T,
+              wheels::meta::EnableIf<is_sequence<S>>...>
+    std::size_t count(S s, T const& value) {
+        return detail::count_segments(s, value, is_segmented<S>{});
+    }
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft], and `Pred` is a predicate [soft].
+    //! *Returns*: the number of elements of `s` that satisfy `pred`.
+    template <typename S, typename Pred,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<detail::is_predicate<Pred, ReferenceType<S>>>...>
+    std::size_t count_if(S s, Pred&& pred) {
+        std::size_t n = 0;
+        for(; !seq::empty(s); seq::pop_front(s)) {
+            if(pred(seq::front(s))) ++n;
+        }
+        return n;
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_COUNT_HPP
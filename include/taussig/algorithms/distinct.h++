@@ -0,0 +1,177 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence distinct() and distinct_by() algorithms
+
+#ifndef TAUSSIG_ALGORITHMS_DISTINCT_HPP
+#define TAUSSIG_ALGORITHMS_DISTINCT_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/bloom_filter.h++>
+#include <taussig/detail/flat_table.h++>
+#include <taussig/detail/fun_objects.h++>
+
+#include <wheels/fun/result_of.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <functional> // hash
+#include <utility> // forward
+#include <cstddef> // size_t
+
+namespace seq {
+    //! {class}
+    //! Requests that `distinct` and `distinct_by` remember keys approximately, in a Bloom filter
+    //! of about `bytes` bytes.
+    struct approximate {
+        constexpr explicit approximate(std::size_t bytes) : bytes(bytes) {}
+        std::size_t bytes;
+    };
+
+    namespace detail {
+        template <typename Seq, typename KeyFun>
+        using DistinctKey = wheels::meta::Decay<wheels::fun::ResultOf<wheels::meta::Decay<KeyFun>&(ReferenceType<wheels::meta::Decay<Seq>>)>>;
+
+        // remembers every key; a copy is stored the first time each is seen
+        template <typename Key>
+        struct exact_set {
+            template <typename K>
+            bool insert(K&& key) {
+                return table.insert(key, [&key] { return Key(std::forward<K>(key)); }).second;
+            }
+
+            flat_table<Key, identity, std::hash<Key>, equal_to> table;
+        };
+
+        // remembers hashes of keys in a fixed amount of memory, and can mistake a new key for a
+        // seen one
+        template <typename Key>
+        struct approximate_set {
+            explicit approximate_set(approximate a) : filter(a.bytes) {}
+
+            bool insert(Key const& key) {
+                return filter.insert(mix_hash(std::hash<Key>{}(key)));
+            }
+
+            blocked_bloom_filter filter;
+        };
+    } // namespace detail
+
+    template <typename Seq, typename KeyFun, typename Set>
+    struct distinct_sequence : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using key_fun_type = wheels::meta::Decay<KeyFun>;
+
+    public:
+        template <typename SeqF, typename KeyFunF>
+        distinct_sequence(SeqF&& s, KeyFunF&& key_fun, Set seen)
+        : s(std::forward<SeqF>(s)), key_fun(std::forward<KeyFunF>(key_fun)), seen(std::move(seen)) {
+            find_new();
+        }
+
+        using reference = ReferenceType<seq_type>;
+        using value_type = ValueType<seq_type>;
+
+        bool empty() const { return seq::empty(s); }
+        void pop_front() {
+            seq::pop_front(s);
+            find_new();
+        }
+        reference front() const { return seq::front(s); }
+
+    private:
+        seq_type s;
+        key_fun_type key_fun;
+        Set seen; // includes the key of the front
+
+        void find_new() {
+            for(; !seq::empty(s); seq::pop_front(s)) {
+                reference x = seq::front(s);
+                if(seen.insert(wheels::fun::invoke(key_fun, x))) return;
+            }
+        }
+    };
+    static_assert(is_true_sequence<distinct_sequence<fake_sequence<int>, detail::identity, detail::exact_set<int>>>(),
+                  "distinct_sequence must be a true sequence");
+
+    namespace result_of {
+        template <typename Seq, typename KeyFun>
+        using distinct_by = distinct_sequence<Seq, KeyFun, detail::exact_set<detail::DistinctKey<Seq, KeyFun>>>;
+        template <typename Seq>
+        using distinct = distinct_by<Seq, detail::identity>;
+
+        template <typename Seq, typename KeyFun>
+        using approximate_distinct_by = distinct_sequence<Seq, KeyFun, detail::approximate_set<detail::DistinctKey<Seq, KeyFun>>>;
+        template <typename Seq>
+        using approximate_distinct = approximate_distinct_by<Seq, detail::identity>;
+    } // namespace result_of
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; `key_fun` can be called with an element of `s`, and
+    //!             its results can be hashed with `std::hash` and compared for equality [soft].
+    //! *Returns*: a sequence of the elements of `s` for which `key_fun` returns a key it did not
+    //!            return for any earlier element.
+    //! *Note*: `key_fun` is called once per element. Each distinct key is copied into an
+    //!         open-addressing table, which copies of the sequence do not share.
+    template <typename Seq, typename KeyFun,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<wheels::meta::Decay<KeyFun>&, void(ReferenceType<Seq>)>>...>
+    result_of::distinct_by<Seq, KeyFun> distinct_by(Seq&& s, KeyFun&& key_fun) {
+        return { std::forward<Seq>(s), std::forward<KeyFun>(key_fun), {} };
+    }
+
+    //! {function}
+    //! *Requires*: as for `distinct_by(s, key_fun)`.
+    //! *Returns*: like `distinct_by(s, key_fun)`, but keys are remembered in a blocked Bloom filter
+    //!            of `a.bytes` bytes instead, so memory use does not grow with the number of keys.
+    //! *Note*: no key is yielded twice, but an element whose key is new can be mistaken for a
+    //!         duplicate and skipped. The rates are approximate: with 2M distinct random 64-bit
+    //!         keys and `b` bits of filter per key, about one in 160 keys was skipped at `b = 8`,
+    //!         one in 4500 at `b = 16`, and one in 40000 at `b = 24`. Skips get likelier as the
+    //!         filter fills, so late keys are skipped more often than early ones.
+    template <typename Seq, typename KeyFun,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<wheels::meta::Decay<KeyFun>&, void(ReferenceType<Seq>)>>...>
+    result_of::approximate_distinct_by<Seq, KeyFun> distinct_by(Seq&& s, KeyFun&& key_fun, approximate a) {
+        return { std::forward<Seq>(s), std::forward<KeyFun>(key_fun), detail::approximate_set<detail::DistinctKey<Seq, KeyFun>>(a) };
+    }
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; its elements can be hashed with `std::hash` and
+    //!             compared for equality [soft].
+    //! *Returns*: a sequence of the first occurrence of each element of `s`.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    result_of::distinct<Seq> distinct(Seq&& s) {
+        return seq::distinct_by(std::forward<Seq>(s), detail::identity{});
+    }
+
+    //! {function}
+    //! *Requires*: as for `distinct(s)`.
+    //! *Returns*: like `distinct(s)`, but remembering elements approximately; see `distinct_by(s, key_fun, a)`.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    result_of::approximate_distinct<Seq> distinct(Seq&& s, approximate a) {
+        return seq::distinct_by(std::forward<Seq>(s), detail::identity{}, a);
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_DISTINCT_HPP
@@ -0,0 +1,236 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sorting sequences larger than memory
+
+#ifndef TAUSSIG_ALGORITHMS_EXTERNAL_SORT_HPP
+#define TAUSSIG_ALGORITHMS_EXTERNAL_SORT_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/value_type.h++>
+
+#include <taussig/detail/fun_objects.h++> // is_predicate
+#include <taussig/detail/loser_tree.h++>
+#include <taussig/detail/parallel.h++>
+#include <taussig/detail/temp_file.h++>
+
+#include <wheels/meta/enable_if.h++>
+
+#include <algorithm> // sort, inplace_merge, min, max
+#include <cstdio> // fread, fwrite
+#include <string>
+#include <type_traits> // is_trivially_copyable, is_default_constructible
+#include <utility> // move
+#include <vector>
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+
+namespace seq {
+    namespace detail {
+        // A sorted run of `T`s, either held whole in memory, or read from a file one block at a time.
+        template <typename T>
+        class sorted_run {
+        public:
+            explicit sorted_run(std::vector<T> elements) : buffer(std::move(elements)) {}
+            sorted_run(file_handle file, std::size_t size, std::size_t block)
+            : file(std::move(file)), unread(size), block(block) {
+                refill();
+            }
+
+            bool empty() const { return position == buffer.size(); }
+            T const& front() const { return buffer[position]; }
+            void pop_front() {
+                if(++position == buffer.size() && unread) refill();
+            }
+
+        private:
+            file_handle file;
+            std::size_t offset = 0; // elements read from the file so far
+            std::size_t unread = 0;
+            std::size_t block = 0;
+            std::vector<T> buffer;
+            std::size_t position = 0;
+
+            void refill() {
+                auto const n = std::min(block, unread);
+                buffer.resize(n);
+                // copies of a run share the file, so each read says where it starts
+                if(!seek_file(file.get(), static_cast<std::uint64_t>(offset) * sizeof(T))
+                   || std::fread(buffer.data(), sizeof(T), n, file.get()) != n) {
+                    throw_io_error("cannot read a sorted run");
+                }
+                offset += n;
+                unread -= n;
+                position = 0;
+            }
+        };
+
+        struct spilled_run {
+            file_handle file;
+            std::size_t size;
+        };
+
+        template <typename T>
+        spilled_run spill(std::vector<T> const& elements, std::string const& dir) {
+            auto file = make_temp_file(dir);
+            if(std::fwrite(elements.data(), sizeof(T), elements.size(), file.get()) != elements.size()) {
+                throw_io_error("cannot write a sorted run");
+            }
+            return { std::move(file), elements.size() };
+        }
+
+        //! {function}
+        //! *Effects*: sorts `v` by `cmp`, sorting slices on separate threads and then merging
+        //!            neighbouring slices, also on separate threads, until one is left.
+        template <typename T, typename Cmp>
+        void sort_parallel(std::vector<T>& v, Cmp& cmp, parallel_policy policy) {
+            auto const chunks = chunk_count(policy, v.size());
+            if(chunks < 2) {
+                std::sort(v.begin(), v.end(), cmp);
+                return;
+            }
+            std::vector<std::size_t> bounds(1, 0);
+            auto ends = for_each_chunk(v.size(), chunks, [&v, &cmp](std::size_t, std::size_t first, std::size_t last) {
+                std::sort(v.begin() + first, v.begin() + last, cmp);
+                return last;
+            });
+            bounds.insert(bounds.end(), ends.begin(), ends.end());
+            while(bounds.size() > 2) {
+                auto const pairs = (bounds.size() - 1) / 2;
+                for_each_chunk(pairs, pairs, [&v, &cmp, &bounds](std::size_t i, std::size_t, std::size_t) {
+                    std::inplace_merge(v.begin() + bounds[2 * i], v.begin() + bounds[2 * i + 1], v.begin() + bounds[2 * i + 2], cmp);
+                    return i;
+                });
+                std::vector<std::size_t> merged;
+                for(std::size_t i = 0; i < bounds.size(); i += 2) merged.push_back(bounds[i]);
+                if(merged.back() != bounds.back()) merged.push_back(bounds.back());
+                bounds = std::move(merged);
+            }
+        }
+    } // namespace detail
+
+    template <typename T, typename Cmp>
+    struct external_sort_sequence : true_sequence {
+        external_sort_sequence(std::vector<detail::sorted_run<T>> runs, Cmp cmp)
+        : runs(std::move(runs)), cmp(std::move(cmp)) {
+            if(!this->runs.empty()) tree.build(this->runs.size(), goes_before());
+        }
+
+        using reference = T const&;
+        using value_type = T;
+
+        bool empty() const { return runs.empty() || runs[tree.winner()].empty(); }
+        void pop_front() {
+            runs[tree.winner()].pop_front();
+            tree.replay(goes_before());
+        }
+        reference front() const { return runs[tree.winner()].front(); }
+
+    private:
+        std::vector<detail::sorted_run<T>> runs;
+        Cmp cmp;
+        detail::loser_tree tree;
+
+        // exhausted runs go last
+        struct run_less {
+            external_sort_sequence* self;
+            bool operator()(std::size_t i, std::size_t j) const {
+                auto const& runs = self->runs;
+                if(runs[i].empty()) return false;
+                if(runs[j].empty()) return true;
+                return self->cmp(runs[i].front(), runs[j].front());
+            }
+        };
+        run_less goes_before() { return { this }; }
+    };
+    static_assert(is_true_sequence<external_sort_sequence<int, bool(*)(int, int)>>(), "external_sort_sequence must be a true sequence");
+
+    namespace detail {
+        template <typename S, typename Cmp>
+        external_sort_sequence<ValueType<S>, Cmp> external_sort(S s, Cmp cmp, std::size_t memory_budget, std::string const& tmpdir,
+                                                                parallel_policy policy) {
+            using value_type = ValueType<S>;
+            auto const capacity = std::max<std::size_t>(1, memory_budget / sizeof(value_type));
+
+            std::vector<spilled_run> spilled;
+            std::vector<value_type> buffer;
+            for(; !seq::empty(s); seq::pop_front(s)) {
+                if(buffer.size() == capacity) {
+                    sort_parallel(buffer, cmp, policy);
+                    spilled.push_back(spill(buffer, tmpdir));
+                    buffer.clear();
+                }
+                // grow geometrically, but never past the budget
+                if(buffer.size() == buffer.capacity()) buffer.reserve(std::min(capacity, 2 * buffer.size() + 16));
+                buffer.push_back(seq::front(s));
+            }
+            sort_parallel(buffer, cmp, policy);
+
+            std::vector<sorted_run<value_type>> runs;
+            if(spilled.empty()) {
+                if(!buffer.empty()) runs.emplace_back(std::move(buffer));
+            } else {
+                if(!buffer.empty()) spilled.push_back(spill(buffer, tmpdir));
+                std::vector<value_type>().swap(buffer);
+                auto const block = std::max<std::size_t>(1, capacity / spilled.size());
+                runs.reserve(spilled.size());
+                for(auto& run : spilled) runs.emplace_back(std::move(run.file), run.size, block);
+            }
+            return { std::move(runs), std::move(cmp) };
+        }
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft]; its value type is trivially copyable and default
+    //!             constructible [soft]; `cmp` is a strict weak ordering of its elements [undefined].
+    //! *Effects*: reads all of `s`, sorting it on the calling thread in runs of up to
+    //!            `memory_budget` bytes. If `s` does not fit in one run, each run is written
+    //!            to an unnamed temporary file in `tmpdir`, or in the system's temporary directory
+    //!            if `tmpdir` is empty.
+    //! *Returns*: a sequence of the elements of `s` sorted by `cmp`, which merges the runs as it
+    //!            is read; each run is read from its file in blocks that share `memory_budget`.
+    //! *Note*: the sort is not stable. Copies of the result read on independently and share the
+    //!         files, which are removed with the last copy.
+    //! *Throws*: `std::system_error` if a temporary file cannot be created, written or read; reads
+    //!           happen while the result is traversed.
+    template <typename S, typename Cmp,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<std::is_trivially_copyable<ValueType<S>>>...,
+              wheels::meta::EnableIf<std::is_default_constructible<ValueType<S>>>...,
+              wheels::meta::EnableIf<detail::is_predicate<Cmp&, ValueType<S> const&, ValueType<S> const&>>...>
+    external_sort_sequence<ValueType<S>, Cmp> external_sort(S s, Cmp cmp, std::size_t memory_budget, std::string const& tmpdir = {}) {
+        return detail::external_sort(std::move(s), std::move(cmp), memory_budget, tmpdir, parallel_policy { 1, 0 });
+    }
+
+    //! {function}
+    //! *Requires*: as for `external_sort(s, cmp, memory_budget, tmpdir)`; `cmp` may be called
+    //!             concurrently [undefined].
+    //! *Effects*: as for `external_sort(s, cmp, memory_budget, tmpdir)`, but each run is sorted
+    //!            with the threads of `policy`.
+    //! *Returns*: as for `external_sort(s, cmp, memory_budget, tmpdir)`.
+    //! *Note*: merging two halves of a run may briefly allocate as much memory again.
+    template <typename S, typename Cmp,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<std::is_trivially_copyable<ValueType<S>>>...,
+              wheels::meta::EnableIf<std::is_default_constructible<ValueType<S>>>...,
+              wheels::meta::EnableIf<detail::is_predicate<Cmp&, ValueType<S> const&, ValueType<S> const&>>...>
+    external_sort_sequence<ValueType<S>, Cmp> external_sort(S s, Cmp cmp, std::size_t memory_budget, std::string const& tmpdir,
+                                                            parallel_policy policy) {
+        return detail::external_sort(std::move(s), std::move(cmp), memory_budget, tmpdir, policy);
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_EXTERNAL_SORT_HPP
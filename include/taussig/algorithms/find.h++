@@ -0,0 +1,104 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence find() and find_if() algorithms
+
+#ifndef TAUSSIG_ALGORITHMS_FIND_HPP
+#define TAUSSIG_ALGORITHMS_FIND_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/find_kernels.h++>
+#include <taussig/detail/fun_objects.h++>
+
+#include <wheels/meta/all.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/not.h++>
+
+#include <type_traits> // is_integral, is_same
+#include <utility> // move
+
+namespace seq {
+    namespace detail {
+        //! {trait}
+        //! *Returns*: `true` if searching `S` for values of type `T` can use the contiguous kernels;
+        //!            `false` otherwise.
+        template <typename S, typename T,
+                  bool = is_contiguous_sequence<S>()>
+        struct is_kernel_searchable : wheels::meta::False {};
+        template <typename S, typename T>
+        struct is_kernel_searchable<S, T, true>
+        : wheels::meta::All<
+            std::is_integral<ValueType<S>>,
+            wheels::meta::Not<std::is_same<ValueType<S>, bool>>,
+            std::is_integral<T>
+        > {};
+
+        template <typename S, typename T,
+                  bool = is_kernel_searchable<S, T>()>
+        struct find {
+            static S call(S s, T const& value) {
+                while(!seq::empty(s) && !detail::equal_to{}(seq::front(s), value)) {
+                    seq::pop_front(s);
+                }
+                return s;
+            }
+        };
+        template <typename S, typename T>
+        struct find<S, T, true> {
+            static S call(S s, T const& value) {
+                auto const narrowed = static_cast<ValueType<S>>(value);
+                // if the value does not survive the conversion no element can compare equal to it
+                if(!detail::equal_to{}(narrowed, value)) {
+                    s.first = s.second;
+                    return s;
+                }
+                s.first += detail::find_value(detail::contiguous_data(s), detail::contiguous_size(s), narrowed);
+                return s;
+            }
+        };
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft] and its elements are comparable with `value`.
+    //! *Returns*: the remainder of `s` starting at the first element equal to `value`;
+    //!            an empty sequence if there is no such element.
+    //! *Complexity*: linear; contiguous sequences of integral values are searched in blocks.
+    template <typename S, typename T,
+              wheels::meta::EnableIf<is_sequence<S>>...>
+    S find(S s, T const& value) {
+        return detail::find<S, T>::call(std::move(s), value);
+    }
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft], and `Pred` is a predicate [soft].
+    //! *Returns*: the remainder of `s` starting at the first element that satisfies `pred`;
+    //!            an empty sequence if there is no such element.
+    template <typename S, typename Pred,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<detail::is_predicate<Pred, ReferenceType<S>>>...>
+    S find_if(S s, Pred&& pred) {
+        while(!seq::empty(s) && !pred(seq::front(s))) {
+            seq::pop_front(s);
+        }
+        return s;
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_FIND_HPP
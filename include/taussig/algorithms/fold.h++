@@ -0,0 +1,253 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Folds and reductions
+
+#ifndef TAUSSIG_ALGORITHMS_FOLD_HPP
+#define TAUSSIG_ALGORITHMS_FOLD_HPP
+
+#include <taussig/algorithms/segments.h++>
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/parallel.h++>
+
+#include <wheels/fun/result_of.h++>
+#include <wheels/meta/all.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/not.h++>
+#include <wheels/optional.h++>
+
+#include <functional> // plus, multiplies, bit_and, bit_or, bit_xor
+#include <type_traits> // is_arithmetic, is_integral, is_same
+#include <utility> // move
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    //! {trait}
+    //! *Returns*: `true` if `Op` is known to be associative and commutative, so that a reduction may
+    //!            apply it in any order; `false` otherwise.
+    //! *Note*: specialize it for your own operations to let `reduce` and `fold` reorder them.
+    template <typename Op>
+    struct is_reorderable : wheels::meta::False {};
+    template <typename T>
+    struct is_reorderable<std::plus<T>> : std::is_arithmetic<T> {};
+    template <typename T>
+    struct is_reorderable<std::multiplies<T>> : std::is_arithmetic<T> {};
+    template <typename T>
+    struct is_reorderable<std::bit_and<T>> : std::is_integral<T> {};
+    template <typename T>
+    struct is_reorderable<std::bit_or<T>> : std::is_integral<T> {};
+    template <typename T>
+    struct is_reorderable<std::bit_xor<T>> : std::is_integral<T> {};
+
+    namespace detail {
+        // independent accumulators, enough to hide the latency of a vector add
+        constexpr std::size_t fold_lanes = 8;
+
+        template <typename S, typename T, typename Op>
+        struct is_unrollable
+        : wheels::meta::All<
+            is_contiguous_sequence<S>,
+            std::is_arithmetic<ValueType<S>>,
+            std::is_arithmetic<T>,
+            is_reorderable<wheels::meta::Decay<Op>>
+        > {};
+
+        // integral arithmetic gives the same result in any order; mixing in floating-point values
+        // rounds or truncates differently depending on where the partial sums are converted, and
+        // conversion to bool is not modular
+        template <typename S, typename T, typename Op>
+        struct is_exact_fold
+        : wheels::meta::All<
+            std::is_integral<T>,
+            wheels::meta::Not<std::is_same<T, bool>>,
+            std::is_integral<ValueType<S>>,
+            std::is_integral<wheels::meta::Decay<wheels::fun::ResultOf<Op&(T, ReferenceType<S>)>>>,
+            wheels::meta::Not<std::is_same<wheels::meta::Decay<wheels::fun::ResultOf<Op&(T, ReferenceType<S>)>>, bool>>
+        > {};
+
+        template <typename S, typename T, typename Op>
+        T fold_sequential(S& s, T acc, Op& op) {
+            for(; !seq::empty(s); seq::pop_front(s)) {
+                acc = op(std::move(acc), seq::front(s));
+            }
+            return acc;
+        }
+
+        template <typename T, typename V, typename Op>
+        T fold_unrolled(V const* p, std::size_t n, T acc, Op& op) {
+            std::size_t i = 0;
+            if(n >= 2 * fold_lanes) {
+                T lanes[fold_lanes];
+                lanes[0] = op(acc, p[0]);
+                for(std::size_t k = 1; k < fold_lanes; ++k) lanes[k] = static_cast<T>(p[k]);
+                for(i = fold_lanes; n - i >= fold_lanes; i += fold_lanes) {
+                    for(std::size_t k = 0; k < fold_lanes; ++k) lanes[k] = op(lanes[k], p[i + k]);
+                }
+                for(std::size_t width = fold_lanes / 2; width > 0; width /= 2) {
+                    for(std::size_t k = 0; k < width; ++k) lanes[k] = op(lanes[k], lanes[k + width]);
+                }
+                acc = lanes[0];
+            }
+            for(; i < n; ++i) acc = op(acc, p[i]);
+            return acc;
+        }
+
+        template <typename S, typename T, typename Op>
+        T reduce(S& s, T init, Op& op, wheels::meta::False) {
+            return fold_sequential(s, std::move(init), op);
+        }
+        template <typename S, typename T, typename Op>
+        T reduce(S& s, T init, Op& op, wheels::meta::True) {
+            return fold_unrolled(contiguous_data(s), contiguous_size(s), std::move(init), op);
+        }
+
+        template <bool Reassociate, typename S, typename T, typename Op>
+        T fold_segments(S& s, T init, Op& op, wheels::meta::False) {
+            using unrollable = wheels::meta::All<
+                                    is_unrollable<S, T, Op>,
+                                    wheels::meta::Bool<Reassociate || is_exact_fold<S, T, Op>()>
+                               >;
+            return reduce(s, std::move(init), op, unrollable{});
+        }
+        template <bool Reassociate, typename S, typename T, typename Op>
+        T fold_segments(S& s, T init, Op& op, wheels::meta::True);
+
+        template <bool Reassociate, typename T, typename Op>
+        struct fold_segment {
+            template <typename S>
+            void operator()(S const& segment) const {
+                S s = segment;
+                acc = fold_segments<Reassociate>(s, std::move(acc), op, is_segmented<S>{});
+            }
+
+            T& acc;
+            Op& op;
+        };
+
+        // each segment is folded by its own loop, in order
+        template <bool Reassociate, typename S, typename T, typename Op>
+        T fold_segments(S& s, T init, Op& op, wheels::meta::True) {
+            for_each_segment(s, fold_segment<Reassociate, T, Op> { init, op });
+            return init;
+        }
+
+        // combines adjacent results until one is left, keeping their order
+        template <typename T, typename Op>
+        T combine_tree(std::vector<T>& parts, Op& op) {
+            for(std::size_t width = 1; width < parts.size(); width *= 2) {
+                for(std::size_t i = 0; i + width < parts.size(); i += 2 * width) {
+                    parts[i] = op(std::move(parts[i]), std::move(parts[i + width]));
+                }
+            }
+            return std::move(parts[0]);
+        }
+
+        template <typename S, typename T, typename Op>
+        T reduce_parallel(S& s, T init, Op& op, parallel_policy, wheels::meta::False) {
+            return reduce(s, std::move(init), op, is_unrollable<S, T, Op>{});
+        }
+        template <typename S, typename T, typename Op>
+        T reduce_parallel(S& s, T init, Op& op, parallel_policy policy, wheels::meta::True) {
+            auto const n = static_cast<std::size_t>(s.second - s.first);
+            auto const chunks = chunk_count(policy, n);
+            if(chunks < 2) return reduce(s, std::move(init), op, is_unrollable<S, T, Op>{});
+            auto parts = for_each_chunk(n, chunks, [&s, &op](std::size_t, std::size_t first, std::size_t last) {
+                S part { s.first + first, s.first + last };
+                T acc = seq::front(part);
+                seq::pop_front(part);
+                return reduce(part, std::move(acc), op, is_unrollable<S, T, Op>{});
+            });
+            return op(std::move(init), combine_tree(parts, op));
+        }
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft]; `op` can be called with a `T` and an element of `s` and
+    //!             its result converts to `T` [soft].
+    //! *Returns*: `op(...op(op(init, e0), e1)..., en)` for the elements `e0`...`en` of `s`, or `init`
+    //!            if `s` is empty.
+    //! *Note*: when `is_reorderable<Op>` and the elements are stored contiguously, folds where the
+    //!         elements, `T`, and the result of `op` are all integral use several independent
+    //!         accumulators; the result is the same. Segmented sequences
+    //!         are folded one segment at a time.
+    template <typename S, typename T, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(T, ReferenceType<S>)>>...>
+    T fold(S s, T init, Op op) {
+        return detail::fold_segments<false>(s, std::move(init), op, is_segmented<S>{});
+    }
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft]; `op` is associative [undefined]; `op` can be called with
+    //!             a `T` and an element of `s` and its result converts to `T` [soft].
+    //! *Returns*: `init` combined with all elements of `s` by `op`.
+    //! *Note*: unlike `fold`, the operations may be grouped and, when `is_reorderable<Op>`, reordered
+    //!         differently, which can change the rounding of floating-point results.
+    template <typename S, typename T, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(T, ReferenceType<S>)>>...>
+    T reduce(S s, T init, Op op) {
+        return detail::fold_segments<true>(s, std::move(init), op, is_segmented<S>{});
+    }
+
+    //! {function}
+    //! *Requires*: as for `reduce(s, init, op)`; `op` may be called concurrently [undefined].
+    //! *Returns*: `init` combined with all elements of `s` by `op`.
+    //! *Effects*: random-access sequences are split into slices that are reduced on separate
+    //!            threads, and the partial results are combined pairwise in order; other
+    //!            sequences are reduced on the calling thread.
+    template <typename S, typename T, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(T, ReferenceType<S>)>>...>
+    T reduce(S s, T init, Op op, parallel_policy policy) {
+        return detail::reduce_parallel(s, std::move(init), op, policy, detail::is_random_access_sequence<S>{});
+    }
+
+    //! {function}
+    //! *Requires*: as for `reduce(s, init, op)`, with `T` the value type of `S`.
+    //! *Returns*: the elements of `s` combined by `op`, or none if `s` is empty.
+    template <typename S, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(ValueType<S>, ReferenceType<S>)>>...>
+    wheels::optional<ValueType<S>> reduce(S s, Op op) {
+        if(seq::empty(s)) return wheels::none;
+        ValueType<S> first = seq::front(s);
+        seq::pop_front(s);
+        return seq::reduce(std::move(s), std::move(first), std::move(op));
+    }
+
+    //! {function}
+    //! *Requires*: as for `reduce(s, init, op, policy)`, with `T` the value type of `S`.
+    //! *Returns*: the elements of `s` combined by `op`, or none if `s` is empty.
+    template <typename S, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(ValueType<S>, ReferenceType<S>)>>...>
+    wheels::optional<ValueType<S>> reduce(S s, Op op, parallel_policy policy) {
+        if(seq::empty(s)) return wheels::none;
+        ValueType<S> first = seq::front(s);
+        seq::pop_front(s);
+        return seq::reduce(std::move(s), std::move(first), std::move(op), policy);
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_FOLD_HPP
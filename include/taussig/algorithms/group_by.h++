@@ -0,0 +1,218 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence group_by() and group_reduce() algorithms
+
+#ifndef TAUSSIG_ALGORITHMS_GROUP_BY_HPP
+#define TAUSSIG_ALGORITHMS_GROUP_BY_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/fun_objects.h++>
+#include <taussig/detail/iterators.h++>
+
+#include <wheels/fun/result_of.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/optional.h++>
+
+#include <iterator> // forward_iterator_tag
+#include <utility> // forward, move, pair, declval
+
+namespace seq {
+    template <typename Seq, typename Fun,
+              bool = detail::is_iterator_pair<wheels::meta::Decay<Seq>, std::forward_iterator_tag>()>
+    struct group_by_sequence;
+
+    // multi-pass sequences are sliced at the end of each run
+    template <typename Seq, typename Fun>
+    struct group_by_sequence<Seq, Fun, true> : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using fun_type = wheels::meta::Decay<Fun>;
+        using key_type = wheels::meta::Decay<wheels::fun::ResultOf<fun_type&(ReferenceType<seq_type>)>>;
+    public:
+        template <typename SeqF, typename FunF>
+        group_by_sequence(SeqF&& s, FunF&& fun)
+        : s(std::forward<SeqF>(s)), fun(std::forward<FunF>(fun)) {
+            find_run();
+        }
+
+        using reference = std::pair<key_type const&, seq_type>;
+        using value_type = std::pair<key_type, seq_type>;
+
+        bool empty() const { return s.first == s.second; }
+        void pop_front() {
+            s.first = run_end;
+            find_run();
+        }
+        reference front() const { return { *key, seq_type { s.first, run_end } }; }
+
+    private:
+        seq_type s;
+        fun_type fun;
+        wheels::optional<key_type> key;
+        decltype(s.first) run_end;
+
+        void find_run() {
+            run_end = s.first;
+            if(run_end == s.second) return;
+            key = wheels::some(key_type(wheels::fun::invoke(fun, *run_end)));
+            while(++run_end != s.second && detail::equal_to{}(wheels::fun::invoke(fun, *run_end), *key)) {}
+        }
+    };
+
+    // Single-pass sequences are shared between the groups and their runs: consuming a run
+    // advances the underlying sequence, and moving to the next group skips what is left of it.
+    template <typename Seq, typename Fun>
+    struct group_by_sequence<Seq, Fun, false> : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using fun_type = wheels::meta::Decay<Fun>;
+        using key_type = wheels::meta::Decay<wheels::fun::ResultOf<fun_type&(ReferenceType<seq_type>)>>;
+    public:
+        struct run_sequence : true_sequence {
+            explicit run_sequence(group_by_sequence const* group) : group(group) {}
+
+            using reference = ReferenceType<seq_type>;
+            using value_type = ValueType<seq_type>;
+
+            bool empty() const { return !group->in_run(); }
+            void pop_front() { seq::pop_front(group->s); }
+            reference front() const { return seq::front(group->s); }
+
+        private:
+            group_by_sequence const* group;
+        };
+
+        template <typename SeqF, typename FunF>
+        group_by_sequence(SeqF&& s, FunF&& fun)
+        : s(std::forward<SeqF>(s)), fun(std::forward<FunF>(fun)) {
+            start_run();
+        }
+
+        using reference = std::pair<key_type const&, run_sequence>;
+        using value_type = std::pair<key_type, run_sequence>;
+
+        bool empty() const { return !key; }
+        void pop_front() {
+            while(in_run()) seq::pop_front(s);
+            start_run();
+        }
+        reference front() const { return { *key, run_sequence { this } }; }
+
+    private:
+        mutable seq_type s; // runs consume it through the groups
+        fun_type fun;
+        wheels::optional<key_type> key; // none once all groups are done
+
+        bool in_run() const {
+            return !seq::empty(s) && detail::equal_to{}(wheels::fun::invoke(fun, seq::front(s)), *key);
+        }
+        void start_run() {
+            if(seq::empty(s)) key = wheels::none;
+            else key = wheels::some(key_type(wheels::fun::invoke(fun, seq::front(s))));
+        }
+    };
+    static_assert(is_true_sequence<group_by_sequence<fake_sequence<int>, int(*)(int)>>(), "group_by_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; `fun` can be called with an element of `s` and its
+    //!             results are equality comparable [soft].
+    //! *Returns*: a sequence of pairs of a key and the run of consecutive elements of `s` for which
+    //!            `fun` returns that key.
+    //! *Note*: runs of multi-pass sequences are slices of `s`. Runs of single-pass sequences read
+    //!         from `s` directly: each is only valid until the next `pop_front` on the groups,
+    //!         and while the groups are not moved or copied. `fun` is called once per element for
+    //!         multi-pass sequences, and for single-pass ones each time a run is tested for the end.
+    template <typename Seq, typename Fun,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<wheels::meta::Decay<Fun>&, void(ReferenceType<Seq>)>>...>
+    group_by_sequence<Seq, Fun> group_by(Seq&& s, Fun&& fun) {
+        return { std::forward<Seq>(s), std::forward<Fun>(fun) };
+    }
+
+    template <typename Seq, typename KeyFun, typename T, typename Fun>
+    struct group_reduce_sequence : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using key_fun_type = wheels::meta::Decay<KeyFun>;
+        using fun_type = wheels::meta::Decay<Fun>;
+        using key_type = wheels::meta::Decay<wheels::fun::ResultOf<key_fun_type&(ReferenceType<seq_type>)>>;
+    public:
+        template <typename SeqF, typename KeyFunF, typename TF, typename FunF>
+        group_reduce_sequence(SeqF&& s, KeyFunF&& key_fun, TF&& init, FunF&& fun)
+        : s(std::forward<SeqF>(s)), key_fun(std::forward<KeyFunF>(key_fun)), init(std::forward<TF>(init)), fun(std::forward<FunF>(fun)) {
+            reduce_run();
+        }
+
+        using reference = std::pair<key_type, T> const&;
+        using value_type = std::pair<key_type, T>;
+
+        bool empty() const { return !current; }
+        void pop_front() { reduce_run(); }
+        reference front() const { return *current; }
+
+    private:
+        seq_type s;
+        key_fun_type key_fun;
+        T init;
+        fun_type fun;
+        wheels::optional<value_type> current; // none once all groups are done
+
+        void reduce_run() {
+            if(seq::empty(s)) {
+                current = wheels::none;
+                return;
+            }
+            key_type key = wheels::fun::invoke(key_fun, seq::front(s));
+            T acc = init;
+            do {
+                acc = wheels::fun::invoke(fun, std::move(acc), seq::front(s));
+                seq::pop_front(s);
+            } while(!seq::empty(s) && detail::equal_to{}(wheels::fun::invoke(key_fun, seq::front(s)), key));
+            current = wheels::some(value_type(std::move(key), std::move(acc)));
+        }
+    };
+    static_assert(is_true_sequence<group_reduce_sequence<fake_sequence<int>, int(*)(int), int, int(*)(int, int)>>(), "group_reduce_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; `key_fun` can be called with an element of `s` and
+    //!             its results are equality comparable [soft]; `fun` can be called with a `T` and an
+    //!             element of `s` and its result converts to `T` [soft].
+    //! *Returns*: a sequence of pairs of a key and the fold with `fun` from `init` of the run of
+    //!            consecutive elements of `s` for which `key_fun` returns that key.
+    //! *Note*: each run is folded as it is read, in a single pass over `s`, without storing it.
+    template <typename Seq, typename KeyFun, typename T, typename Fun,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<wheels::meta::Decay<KeyFun>&, void(ReferenceType<Seq>)>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<wheels::meta::Decay<Fun>&, void(wheels::meta::Decay<T>, ReferenceType<Seq>)>>...>
+    group_reduce_sequence<Seq, KeyFun, wheels::meta::Decay<T>, Fun> group_reduce(Seq&& s, KeyFun&& key_fun, T&& init, Fun&& fun) {
+        return { std::forward<Seq>(s), std::forward<KeyFun>(key_fun), std::forward<T>(init), std::forward<Fun>(fun) };
+    }
+
+    namespace result_of {
+        template <typename Seq, typename Fun>
+        using group_by = decltype(seq::group_by(std::declval<Seq>(), std::declval<Fun>()));
+        template <typename Seq, typename KeyFun, typename T, typename Fun>
+        using group_reduce = decltype(seq::group_reduce(std::declval<Seq>(), std::declval<KeyFun>(), std::declval<T>(), std::declval<Fun>()));
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_GROUP_BY_HPP
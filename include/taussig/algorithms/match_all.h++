@@ -0,0 +1,324 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Multi-pattern matching with an Aho-Corasick automaton
+
+#ifndef TAUSSIG_ALGORITHMS_MATCH_ALL_HPP
+#define TAUSSIG_ALGORITHMS_MATCH_ALL_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/primitives/as_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/fake_sequence.h++>
+#include <taussig/traits/is_sequence.h++>
+
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <algorithm> // sort, unique, lower_bound
+#include <limits> // numeric_limits
+#include <type_traits> // make_unsigned
+#include <utility> // forward, pair
+#include <vector>
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t
+
+namespace seq {
+    //! {class}
+    //! A compiled Aho-Corasick automaton over code units of type `Char`.
+    //! *Note*: symbols are compressed into the classes that occur in the patterns. The states closest
+    //!         to the root, which are visited most often, get a dense transition table indexed by class;
+    //!         deeper states keep sorted edge lists and fall back through failure links.
+    template <typename Char>
+    struct aho_corasick {
+    public:
+        //! {class}
+        //! An occurrence of a pattern: its index in the construction sequence,
+        //! and the offset of its first element in the input.
+        struct match {
+            std::size_t pattern;
+            std::size_t offset;
+        };
+
+        using state_type = std::uint32_t;
+        static constexpr state_type root = 0;
+        static constexpr state_type none = std::numeric_limits<state_type>::max();
+
+        //! {constructor}
+        //! *Requires*: `Patterns` is a sequence source whose elements are sequence sources of `Char` [soft].
+        //! *Constructs*: an automaton that recognises all patterns in `patterns`;
+        //!               at most `dense_limit` transitions are stored in the dense table.
+        //! *Note*: empty patterns never match.
+        template <typename Patterns>
+        explicit aho_corasick(Patterns const& patterns, std::size_t dense_limit = 1 << 16) {
+            std::vector<std::vector<Char>> texts;
+            for(auto&& ps = seq::as_sequence(patterns); !seq::empty(ps); seq::pop_front(ps)) {
+                texts.emplace_back();
+                for(auto&& p = seq::as_sequence(seq::front(ps)); !seq::empty(p); seq::pop_front(p)) {
+                    texts.back().push_back(seq::front(p));
+                }
+            }
+            build_classes(texts);
+            build(texts, dense_limit);
+        }
+
+        //! {function}
+        //! *Returns*: the number of patterns in this automaton.
+        std::size_t pattern_count() const { return lengths.size(); }
+
+        //! {function}
+        //! *Returns*: the state reached from `state` after reading `c`.
+        state_type next(state_type state, Char c) const {
+            auto const cls = class_of(c);
+            if(cls == 0) return root; // symbol not used by any pattern
+            while(state >= dense_states) {
+                auto first = edges.begin() + edge_offsets[state];
+                auto last = edges.begin() + edge_offsets[state + 1];
+                auto it = std::lower_bound(first, last, edge { cls, 0 });
+                if(it != last && it->cls == cls) return it->target;
+                state = fail[state];
+            }
+            return dense[state * classes + cls];
+        }
+
+        //! {function}
+        //! *Returns*: the first state in the failure chain of `state` (including itself) that
+        //!            completes a pattern, or `none` if there is none.
+        state_type output_state(state_type state) const {
+            return output_offsets[state] != output_offsets[state + 1]? state : dictionary[state];
+        }
+        //! {function}
+        //! *Returns*: the next state after `state` in the failure chain that completes a pattern,
+        //!            or `none` if there is none.
+        state_type next_output_state(state_type state) const { return dictionary[state]; }
+        //! {function}
+        //! *Returns*: the number of patterns completed exactly at `state`.
+        std::size_t output_count(state_type state) const { return output_offsets[state + 1] - output_offsets[state]; }
+        //! {function}
+        //! *Returns*: the `i`th pattern completed exactly at `state`.
+        std::size_t output(state_type state, std::size_t i) const { return outputs[output_offsets[state] + i]; }
+        //! {function}
+        //! *Returns*: the length of pattern `pattern`.
+        std::size_t pattern_length(std::size_t pattern) const { return lengths[pattern]; }
+
+    private:
+        using code_type = typename std::make_unsigned<Char>::type;
+
+        struct edge {
+            std::uint32_t cls;
+            state_type target;
+            bool operator<(edge const& that) const { return cls < that.cls; }
+        };
+
+        std::uint32_t classes;
+        std::uint32_t narrow_count;
+        std::uint32_t narrow_classes[256];
+        std::vector<code_type> wide_symbols;
+
+        state_type dense_states;
+        std::vector<state_type> dense;
+        std::vector<std::uint32_t> edge_offsets;
+        std::vector<edge> edges;
+        std::vector<state_type> fail;
+
+        std::vector<state_type> dictionary;
+        std::vector<std::uint32_t> output_offsets;
+        std::vector<std::size_t> outputs;
+        std::vector<std::size_t> lengths;
+
+        std::uint32_t class_of(Char c) const {
+            auto const code = static_cast<code_type>(c);
+            if(code < 256) return narrow_classes[code];
+            auto it = std::lower_bound(wide_symbols.begin(), wide_symbols.end(), code);
+            if(it == wide_symbols.end() || *it != code) return 0;
+            return narrow_count + static_cast<std::uint32_t>(it - wide_symbols.begin());
+        }
+
+        void build_classes(std::vector<std::vector<Char>> const& texts) {
+            std::vector<code_type> symbols;
+            for(auto const& t : texts) {
+                for(auto c : t) symbols.push_back(static_cast<code_type>(c));
+            }
+            std::sort(symbols.begin(), symbols.end());
+            symbols.erase(std::unique(symbols.begin(), symbols.end()), symbols.end());
+
+            // narrow symbols get a direct lookup table; wide ones are binary searched
+            std::fill(narrow_classes, narrow_classes + 256, 0);
+            std::uint32_t n = 1;
+            for(auto s : symbols) {
+                if(s < 256) narrow_classes[s] = n++;
+                else wide_symbols.push_back(s);
+            }
+            narrow_count = n;
+            classes = n + static_cast<std::uint32_t>(wide_symbols.size());
+        }
+
+        void build(std::vector<std::vector<Char>> const& texts, std::size_t dense_limit) {
+            // trie in insertion order
+            std::vector<std::vector<edge>> trie(1);
+            std::vector<std::vector<std::size_t>> own(1);
+            for(std::size_t id = 0; id < texts.size(); ++id) {
+                lengths.push_back(texts[id].size());
+                if(texts[id].empty()) continue;
+                state_type s = root;
+                for(auto c : texts[id]) {
+                    auto const cls = class_of(c);
+                    auto it = std::lower_bound(trie[s].begin(), trie[s].end(), edge { cls, 0 });
+                    if(it != trie[s].end() && it->cls == cls) {
+                        s = it->target;
+                    } else {
+                        auto const t = static_cast<state_type>(trie.size());
+                        trie[s].insert(it, edge { cls, t });
+                        trie.emplace_back();
+                        own.emplace_back();
+                        s = t;
+                    }
+                }
+                own[s].push_back(id);
+            }
+
+            // renumber states in breadth-first order so that failure links always point backwards
+            auto const count = trie.size();
+            std::vector<state_type> order;
+            std::vector<state_type> renumber(count);
+            order.reserve(count);
+            order.push_back(root);
+            for(std::size_t i = 0; i < order.size(); ++i) {
+                renumber[order[i]] = static_cast<state_type>(i);
+                for(auto const& e : trie[order[i]]) order.push_back(e.target);
+            }
+
+            std::vector<std::vector<edge>> goto_(count);
+            for(std::size_t i = 0; i < count; ++i) {
+                for(auto const& e : trie[order[i]]) goto_[i].push_back(edge { e.cls, renumber[e.target] });
+            }
+
+            fail.assign(count, root);
+            dictionary.assign(count, none);
+            output_offsets.assign(1, 0);
+            for(std::size_t s = 0; s < count; ++s) {
+                for(auto id : own[order[s]]) outputs.push_back(id);
+                output_offsets.push_back(static_cast<std::uint32_t>(outputs.size()));
+            }
+
+            // failure links in BFS order; each only depends on shallower states
+            auto goto_or_fail = [&](state_type s, std::uint32_t cls) -> state_type {
+                for(;;) {
+                    auto it = std::lower_bound(goto_[s].begin(), goto_[s].end(), edge { cls, 0 });
+                    if(it != goto_[s].end() && it->cls == cls) return it->target;
+                    if(s == root) return root;
+                    s = fail[s];
+                }
+            };
+            for(std::size_t s = 0; s < count; ++s) {
+                for(auto const& e : goto_[s]) {
+                    auto const f = s == root? root : goto_or_fail(fail[s], e.cls);
+                    fail[e.target] = f;
+                    dictionary[e.target] = output_offsets[f] != output_offsets[f + 1]? f : dictionary[f];
+                }
+            }
+
+            // dense rows for the hottest states, sparse edges for the rest
+            auto const rows = std::min<std::size_t>(count, std::max<std::size_t>(1, dense_limit / classes));
+            dense_states = static_cast<state_type>(rows);
+            dense.assign(rows * classes, root);
+            for(std::size_t s = 0; s < rows; ++s) {
+                if(s != root) {
+                    std::copy(dense.begin() + fail[s] * classes, dense.begin() + (fail[s] + 1) * classes,
+                              dense.begin() + s * classes);
+                }
+                for(auto const& e : goto_[s]) dense[s * classes + e.cls] = e.target;
+            }
+            edge_offsets.assign(1, 0);
+            for(std::size_t s = 0; s < count; ++s) {
+                if(s >= rows) edges.insert(edges.end(), goto_[s].begin(), goto_[s].end());
+                edge_offsets.push_back(static_cast<std::uint32_t>(edges.size()));
+            }
+        }
+    };
+
+    template <typename Char>
+    constexpr typename aho_corasick<Char>::state_type aho_corasick<Char>::root;
+    template <typename Char>
+    constexpr typename aho_corasick<Char>::state_type aho_corasick<Char>::none;
+
+    template <typename Seq, typename Char>
+    struct match_all_sequence : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using automaton_type = aho_corasick<Char>;
+        using state_type = typename automaton_type::state_type;
+
+    public:
+        template <typename SeqF>
+        match_all_sequence(SeqF&& s, automaton_type const& automaton)
+        : s(std::forward<SeqF>(s)), automaton(&automaton) {
+            advance();
+        }
+
+        using value_type = typename automaton_type::match;
+        using reference = value_type;
+
+        bool empty() const { return out_state == automaton_type::none; }
+        void pop_front() { advance(); }
+        reference front() const {
+            auto const pattern = automaton->output(out_state, out_index);
+            return { pattern, position - automaton->pattern_length(pattern) };
+        }
+
+    private:
+        seq_type s;
+        automaton_type const* automaton;
+        state_type state = automaton_type::root;
+        state_type out_state = automaton_type::none;
+        std::size_t out_index = 0;
+        std::size_t position = 0;
+
+        void advance() {
+            if(out_state != automaton_type::none) {
+                if(++out_index < automaton->output_count(out_state)) return;
+                out_state = automaton->next_output_state(out_state);
+                out_index = 0;
+                if(out_state != automaton_type::none) return;
+            }
+            while(!seq::empty(s)) {
+                state = automaton->next(state, seq::front(s));
+                seq::pop_front(s);
+                ++position;
+                out_state = automaton->output_state(state);
+                if(out_state != automaton_type::none) return;
+            }
+        }
+    };
+    static_assert(is_true_sequence<match_all_sequence<fake_sequence<char>, char>>(), "match_all_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence of values convertible to `Char` [soft];
+    //!             `automaton` outlives the result [undefined].
+    //! *Returns*: a sequence of all occurrences of the patterns of `automaton` in `s`, in order of their last element;
+    //!            patterns that end at the same position are yielded longest first.
+    //! *Complexity*: a single pass over `s`.
+    template <typename Seq, typename Char,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    match_all_sequence<Seq, Char> match_all(Seq&& s, aho_corasick<Char> const& automaton) {
+        return { std::forward<Seq>(s), automaton };
+    }
+
+    namespace result_of {
+        template <typename Seq, typename Char>
+        using match_all = match_all_sequence<Seq, Char>;
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_MATCH_ALL_HPP
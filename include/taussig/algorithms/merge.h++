@@ -0,0 +1,302 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence merge() and merge_all() algorithms
+
+#ifndef TAUSSIG_ALGORITHMS_MERGE_HPP
+#define TAUSSIG_ALGORITHMS_MERGE_HPP
+
+#include <taussig/algorithms/concat.h++> // ConcatReference, all_same
+
+#include <taussig/primitives/as_sequence.h++>
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/fun_objects.h++>
+#include <taussig/detail/loser_tree.h++>
+
+#include <wheels/meta/all.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/depend_on.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/trait_of.h++>
+
+#include <type_traits> // conditional, is_same
+#include <utility> // forward, move
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    template <typename Seq1, typename Seq2, typename Cmp>
+    struct merge_sequence : true_sequence {
+    private:
+        using seq1_type = wheels::meta::Decay<Seq1>;
+        using seq2_type = wheels::meta::Decay<Seq2>;
+        using is_random_access = wheels::meta::All<detail::is_random_access_sequence<seq1_type>, detail::is_random_access_sequence<seq2_type>>;
+
+    public:
+        template <typename Seq1F, typename Seq2F, typename CmpF>
+        merge_sequence(Seq1F&& s1, Seq2F&& s2, CmpF&& cmp)
+        : s1(std::forward<Seq1F>(s1)), s2(std::forward<Seq2F>(s2)), cmp(std::forward<CmpF>(cmp)) {
+            choose();
+        }
+
+        using reference = detail::ConcatReference<ReferenceType<seq1_type>, ReferenceType<seq2_type>>;
+        using value_type = wheels::meta::Decay<reference>;
+
+        bool empty() const { return seq::empty(s1) && seq::empty(s2); }
+        void pop_front() {
+            pop_front(is_random_access{});
+            choose();
+        }
+        reference front() const { return second? seq::front(s2) : seq::front(s1); }
+
+    private:
+        seq1_type s1;
+        seq2_type s2;
+        wheels::meta::Decay<Cmp> cmp;
+        bool second; // whether the front comes from s2
+
+        // slices advance by the result of the comparison instead of branching on it
+        void pop_front(wheels::meta::True) {
+            s1.first += !second;
+            s2.first += second;
+        }
+        void pop_front(wheels::meta::False) {
+            if(second) seq::pop_front(s2);
+            else seq::pop_front(s1);
+        }
+        // ties go to s1, so the merge is stable
+        void choose() {
+            if(seq::empty(s1)) second = true;
+            else if(seq::empty(s2)) second = false;
+            else second = cmp(seq::front(s2), seq::front(s1));
+        }
+    };
+    static_assert(is_true_sequence<merge_sequence<fake_sequence<int>, fake_sequence<int>, detail::less>>(), "merge_sequence must be a true sequence");
+
+    template <typename Seq, typename Cmp>
+    struct merge_all_sequence : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using cmp_type = wheels::meta::Decay<Cmp>;
+
+    public:
+        merge_all_sequence(std::vector<seq_type> sources, cmp_type cmp)
+        : sources(std::move(sources)), cmp(std::move(cmp)) {
+            if(!this->sources.empty()) tree.build(this->sources.size(), goes_before());
+        }
+
+        using reference = ReferenceType<seq_type>;
+        using value_type = ValueType<seq_type>;
+
+        bool empty() const { return sources.empty() || seq::empty(sources[tree.winner()]); }
+        void pop_front() {
+            seq::pop_front(sources[tree.winner()]);
+            tree.replay(goes_before());
+        }
+        reference front() const { return seq::front(sources[tree.winner()]); }
+
+    private:
+        std::vector<seq_type> sources;
+        cmp_type cmp;
+        detail::loser_tree tree;
+
+        // exhausted sources go last, and ties go to the earlier source
+        struct source_less {
+            merge_all_sequence* self;
+            bool operator()(std::size_t i, std::size_t j) const {
+                auto const& sources = self->sources;
+                if(seq::empty(sources[i])) return false;
+                if(seq::empty(sources[j])) return true;
+                if(self->cmp(seq::front(sources[i]), seq::front(sources[j]))) return true;
+                return i < j && !self->cmp(seq::front(sources[j]), seq::front(sources[i]));
+            }
+        };
+        source_less goes_before() { return { this }; }
+    };
+    static_assert(is_true_sequence<merge_all_sequence<fake_sequence<int>, detail::less>>(), "merge_all_sequence must be a true sequence");
+
+    namespace detail {
+        template <typename Source>
+        using SourceSequence = wheels::meta::Decay<seq::result_of::as_sequence<Source>>;
+
+        template <typename Sources>
+        using InnerSequence = SourceSequence<ReferenceType<SourceSequence<Sources>>>;
+
+        template <typename Sources, typename Cmp>
+        merge_all_sequence<InnerSequence<Sources>, Cmp> merge_all(Sources&& ss, Cmp&& cmp) {
+            std::vector<InnerSequence<Sources>> sources;
+            for(auto&& outer = seq::as_sequence(std::forward<Sources>(ss)); !seq::empty(outer); seq::pop_front(outer)) {
+                sources.push_back(seq::as_sequence(seq::front(outer)));
+            }
+            return { std::move(sources), std::forward<Cmp>(cmp) };
+        }
+
+        struct sequence_source_test {
+            template <typename T>
+            wheels::meta::DependOn<wheels::meta::True, seq::result_of::as_sequence<T>> static test(int);
+            template <typename...>
+            wheels::meta::False static test(...);
+        };
+        template <typename T>
+        struct is_sequence_source : wheels::meta::TraitOf<sequence_source_test, T> {};
+
+        template <typename Seq, typename T,
+                  bool = is_sequence_source<T>()>
+        struct is_source_of : wheels::meta::False {};
+        template <typename Seq, typename T>
+        struct is_source_of<Seq, T, true> : std::is_same<SourceSequence<T>, Seq> {};
+
+        template <typename T,
+                  bool = is_sequence_source<T>()>
+        struct source_sequence_of { using type = SourceSequence<T>; };
+        template <typename T>
+        struct source_sequence_of<T, false> { using type = void; };
+
+        template <typename T, typename... Ts>
+        struct last_of : last_of<Ts...> {};
+        template <typename T>
+        struct last_of<T> { using type = T; };
+
+        // all the arguments are sources of Seq, except the last one when it is a comparator
+        template <typename Seq, bool HasCmp, typename T, typename... Ts>
+        struct are_merge_arguments
+        : wheels::meta::Bool<is_source_of<Seq, T>() && are_merge_arguments<Seq, HasCmp, Ts...>()> {};
+        template <typename Seq, typename T>
+        struct are_merge_arguments<Seq, true, T> : wheels::meta::True {};
+        template <typename Seq, typename T>
+        struct are_merge_arguments<Seq, false, T> : is_source_of<Seq, T> {};
+
+        //! {traits}
+        //! *Note*: describes a merge of the arguments `S1, Ts...`, which are all sources of the same
+        //!         sequence type, optionally followed by a comparator.
+        template <typename S1, typename... Ts>
+        struct k_way_merge {
+        private:
+            using last = typename last_of<Ts...>::type;
+
+        public:
+            static constexpr bool has_cmp = !is_sequence_source<last>::value;
+            using sequence = typename source_sequence_of<S1>::type;
+            using compare = typename std::conditional<has_cmp, wheels::meta::Decay<last>, less>::type;
+            using result = merge_all_sequence<sequence, compare>;
+            static constexpr std::size_t sources = 1 + sizeof...(Ts) - has_cmp;
+            static constexpr bool valid = are_merge_arguments<sequence, has_cmp, S1, Ts...>::value;
+        };
+
+        template <typename T>
+        T&& last_argument(T&& t) { return std::forward<T>(t); }
+        template <typename T, typename... Ts>
+        typename last_of<Ts...>::type&& last_argument(T&&, Ts&&... ts) {
+            return last_argument(std::forward<Ts>(ts)...);
+        }
+
+        template <typename Seq, typename T,
+                  wheels::meta::EnableIf<is_sequence_source<T>>...>
+        int add_merge_source(std::vector<Seq>& sources, T&& t) {
+            sources.push_back(seq::as_sequence(std::forward<T>(t)));
+            return 0;
+        }
+        template <typename Seq, typename T,
+                  wheels::meta::DisableIf<is_sequence_source<T>>...>
+        int add_merge_source(std::vector<Seq>&, T&&) { return 0; }
+
+        template <typename Cmp, typename T>
+        Cmp merge_comparator(wheels::meta::True, T&& cmp) { return std::forward<T>(cmp); }
+        template <typename Cmp, typename T>
+        Cmp merge_comparator(wheels::meta::False, T&&) { return less{}; }
+
+        template <typename K, typename... Ts>
+        typename K::result merge_k_way(Ts&&... ts) {
+            std::vector<typename K::sequence> sources;
+            sources.reserve(K::sources);
+            int const added[] = { add_merge_source(sources, std::forward<Ts>(ts))... };
+            (void)added;
+            return {
+                std::move(sources),
+                merge_comparator<typename K::compare>(wheels::meta::Bool<K::has_cmp>{}, last_argument(std::forward<Ts>(ts)...))
+            };
+        }
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S1` and `S2` are sequence sources [soft]; their elements are sorted by `cmp` and
+    //!             comparable with each other [undefined]; sources that are not sequences
+    //!             themselves outlive the result [undefined].
+    //! *Returns*: a sequence of the elements of both `s1` and `s2`, sorted by `cmp`.
+    //! *Note*: the merge is stable: equal elements of `s1` come before those of `s2`. Each element
+    //!         takes one comparison; slices advance without branching on its result. If the
+    //!         sources have different reference types, the elements are values of their common type.
+    template <typename S1, typename S2, typename Cmp,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<S1>>, is_sequence<detail::SourceSequence<S2>>>...,
+              wheels::meta::DisableIf<detail::is_sequence_source<Cmp>>...>
+    merge_sequence<detail::SourceSequence<S1>, detail::SourceSequence<S2>, Cmp> merge(S1&& s1, S2&& s2, Cmp&& cmp) {
+        return { seq::as_sequence(std::forward<S1>(s1)), seq::as_sequence(std::forward<S2>(s2)), std::forward<Cmp>(cmp) };
+    }
+
+    //! {function}
+    //! *Returns*: `merge(s1, s2, cmp)` with `cmp` comparing by `<`.
+    template <typename S1, typename S2,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<S1>>, is_sequence<detail::SourceSequence<S2>>>...>
+    merge_sequence<detail::SourceSequence<S1>, detail::SourceSequence<S2>, detail::less> merge(S1&& s1, S2&& s2) {
+        return { seq::as_sequence(std::forward<S1>(s1)), seq::as_sequence(std::forward<S2>(s2)), detail::less{} };
+    }
+
+    //! {function}
+    //! *Requires*: the arguments are three or more sequence sources of the same sequence type,
+    //!             optionally followed by a comparator `cmp` [soft]; their elements are sorted by
+    //!             `cmp`, or by `<` if there is none [undefined]; sources that are not sequences
+    //!             themselves outlive the result [undefined].
+    //! *Returns*: a sorted sequence of the elements of all the sources.
+    //! *Note*: the merge is stable. The sources play a tournament in a tree of losers: each element
+    //!         takes about `log2(k)` comparisons for `k` sources, plus one more on ties.
+    template <typename S1, typename S2, typename S3, typename... Ts,
+              typename K = detail::k_way_merge<S1, S2, S3, Ts...>,
+              wheels::meta::EnableIf<wheels::meta::Bool<K::valid && K::sources >= 3>>...>
+    typename K::result merge(S1&& s1, S2&& s2, S3&& s3, Ts&&... ts) {
+        return detail::merge_k_way<K>(std::forward<S1>(s1), std::forward<S2>(s2), std::forward<S3>(s3), std::forward<Ts>(ts)...);
+    }
+
+    //! {function}
+    //! *Requires*: `Sources` is a sequence source whose elements are sequence sources sorted by
+    //!             `cmp` [soft]; elements that are not sequences themselves outlive the result [undefined].
+    //! *Returns*: a sorted sequence of the elements of all the sources in `ss`.
+    //! *Effects*: reads all of `ss` to collect the sources.
+    //! *Note*: as for `merge(s1, s2, s3, ts...)`.
+    template <typename Sources, typename Cmp,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<Sources>>>...,
+              wheels::meta::EnableIf<is_sequence<detail::InnerSequence<Sources>>>...>
+    merge_all_sequence<detail::InnerSequence<Sources>, Cmp> merge_all(Sources&& ss, Cmp&& cmp) {
+        return detail::merge_all(std::forward<Sources>(ss), std::forward<Cmp>(cmp));
+    }
+
+    //! {function}
+    //! *Requires*: as for `merge_all(ss, cmp)`, with the sources sorted by `<`.
+    //! *Returns*: `merge_all(ss, cmp)` with `cmp` comparing by `<`.
+    template <typename Sources,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<Sources>>>...,
+              wheels::meta::EnableIf<is_sequence<detail::InnerSequence<Sources>>>...>
+    merge_all_sequence<detail::InnerSequence<Sources>, detail::less> merge_all(Sources&& ss) {
+        return detail::merge_all(std::forward<Sources>(ss), detail::less{});
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_MERGE_HPP
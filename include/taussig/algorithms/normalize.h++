@@ -0,0 +1,192 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence nfc() and nfd() Unicode normalization adaptors
+
+#ifndef TAUSSIG_ALGORITHMS_NORMALIZE_HPP
+#define TAUSSIG_ALGORITHMS_NORMALIZE_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/fake_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+
+#include <taussig/detail/unicode_data.h++>
+
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/is_related.h++>
+
+#include <type_traits> // is_convertible
+#include <utility> // forward
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    //! {class}
+    //! A sequence of the code points of `Seq` in Normalization Form C (if `Compose`) or D.
+    //! *Note*: code points that pass the quick check and cannot interact with their neighbours
+    //!         are yielded directly; only the segments around them that need decomposition,
+    //!         reordering or composition go through an internal buffer, which is reused.
+    template <typename Seq, bool Compose>
+    struct normalize_sequence : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+
+    public:
+        template <typename SeqF,
+                  wheels::meta::DisableIfRelated<SeqF, normalize_sequence<Seq, Compose>>...>
+        explicit normalize_sequence(SeqF&& s) : s(std::forward<SeqF>(s)) {
+            fill();
+        }
+
+        using reference = char32_t;
+        using value_type = char32_t;
+
+        bool empty() const { return position == buffer.size() && !direct; }
+        void pop_front() {
+            if(direct) direct = false;
+            else ++position;
+            if(position == buffer.size()) fill();
+        }
+        reference front() const { return direct? current : buffer[position]; }
+
+    private:
+        seq_type s;
+        std::vector<char32_t> buffer;
+        std::size_t position = 0;
+        char32_t current = 0;
+        bool direct = false;
+
+        static bool is_boundary(char32_t u) {
+            auto const flags = detail::ucd::lookup(u).flags;
+            return Compose? (flags & detail::ucd::nfd_boundary) && !(flags & (detail::ucd::nfc_no | detail::ucd::nfc_maybe))
+                          : (flags & detail::ucd::nfd_boundary);
+        }
+        static bool is_inert(char32_t u) {
+            auto const flags = detail::ucd::lookup(u).flags;
+            return is_boundary(u) && (Compose || !(flags & detail::ucd::nfd_no));
+        }
+
+        void fill() {
+            buffer.clear();
+            position = 0;
+            if(seq::empty(s)) return;
+
+            char32_t const u = seq::front(s);
+            seq::pop_front(s);
+            // quick check: stable code points followed by a segment boundary are already normalized
+            if(is_inert(u) && (seq::empty(s) || is_boundary(seq::front(s)))) {
+                current = u;
+                direct = true;
+                return;
+            }
+
+            decompose(u);
+            while(!seq::empty(s) && !is_boundary(seq::front(s))) {
+                decompose(seq::front(s));
+                seq::pop_front(s);
+            }
+            reorder();
+            if(Compose) compose();
+        }
+
+        void decompose(char32_t u) {
+            using namespace detail::ucd::hangul;
+            if(is_syllable(u)) {
+                auto const index = u - s_base;
+                buffer.push_back(l_base + index / n_count);
+                buffer.push_back(v_base + (index % n_count) / t_count);
+                if(index % t_count != 0) buffer.push_back(t_base + index % t_count);
+                return;
+            }
+            auto const& r = detail::ucd::lookup(u);
+            if(r.flags & detail::ucd::nfd_no) {
+                buffer.insert(buffer.end(), detail::ucd::decompositions + r.decomposition,
+                              detail::ucd::decompositions + r.decomposition + r.decomposition_length);
+            } else {
+                buffer.push_back(u);
+            }
+        }
+
+        static int combining_class(char32_t u) { return detail::ucd::lookup(u).combining_class; }
+
+        void reorder() {
+            // stable insertion sort of each run of non-starters; runs are short
+            for(std::size_t i = 1; i < buffer.size(); ++i) {
+                auto const u = buffer[i];
+                auto const c = combining_class(u);
+                if(c == 0) continue;
+                auto j = i;
+                for(; j > 0 && combining_class(buffer[j - 1]) > c; --j) {
+                    buffer[j] = buffer[j - 1];
+                }
+                buffer[j] = u;
+            }
+        }
+
+        void compose() {
+            if(buffer.empty()) return;
+            std::size_t starter = 0;
+            int last = combining_class(buffer[0]) == 0? 0 : 256; // a leading non-starter blocks everything
+            std::size_t out = 1;
+            for(std::size_t i = 1; i < buffer.size(); ++i) {
+                auto const u = buffer[i];
+                auto const c = combining_class(u);
+                if(last < c || last == 0) {
+                    auto const composite = detail::ucd::compose(buffer[starter], u);
+                    if(composite != 0) {
+                        buffer[starter] = composite;
+                        continue;
+                    }
+                }
+                if(c == 0) starter = out;
+                last = c;
+                buffer[out++] = u;
+            }
+            buffer.resize(out);
+        }
+    };
+    static_assert(is_true_sequence<normalize_sequence<fake_sequence<char32_t>, true>>(), "normalize_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence of code points [soft].
+    //! *Returns*: a sequence with the code points of `s` in Normalization Form C.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<std::is_convertible<ReferenceType<Seq>, char32_t>>...>
+    normalize_sequence<Seq, true> nfc(Seq&& s) {
+        return normalize_sequence<Seq, true>(std::forward<Seq>(s));
+    }
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence of code points [soft].
+    //! *Returns*: a sequence with the code points of `s` in Normalization Form D.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<std::is_convertible<ReferenceType<Seq>, char32_t>>...>
+    normalize_sequence<Seq, false> nfd(Seq&& s) {
+        return normalize_sequence<Seq, false>(std::forward<Seq>(s));
+    }
+
+    namespace result_of {
+        template <typename Seq>
+        using nfc = normalize_sequence<Seq, true>;
+        template <typename Seq>
+        using nfd = normalize_sequence<Seq, false>;
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_NORMALIZE_HPP
@@ -0,0 +1,287 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Instrumented pass-through sequences
+//
+// Define TAUSSIG_NO_PROBES to turn every probe into a plain copy of the sequence it wraps.
+
+#ifndef TAUSSIG_ALGORITHMS_PROBE_HPP
+#define TAUSSIG_ALGORITHMS_PROBE_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/is_related.h++>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#   include <x86intrin.h>
+#   define TAUSSIG_HAS_RDTSC 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#   include <intrin.h>
+#   define TAUSSIG_HAS_RDTSC 1
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint> // uint64_t
+#include <deque>
+#include <iomanip> // setw
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility> // forward, move, declval
+
+namespace seq {
+    //! {class}
+    //! Totals gathered by all probes with the same name.
+    //! *Note*: `ticks` are processor cycles where the timestamp counter is available, and
+    //!         nanoseconds elsewhere; they are only measured on `sampled` of the calls.
+    struct probe_stats {
+        explicit probe_stats(std::string name) : name(std::move(name)) {}
+
+        std::string const name;
+        std::atomic<std::uint64_t> empty_calls { 0 };
+        std::atomic<std::uint64_t> front_calls { 0 };
+        std::atomic<std::uint64_t> pop_front_calls { 0 };
+        std::atomic<std::uint64_t> sampled { 0 };
+        std::atomic<std::uint64_t> ticks { 0 };
+    };
+
+    namespace detail {
+        struct probe_registry {
+            std::mutex mutex;
+            std::deque<probe_stats> stats; // deque keeps addresses stable
+        };
+
+        inline probe_registry& probes() {
+            static probe_registry registry;
+            return registry;
+        }
+
+        inline std::uint64_t probe_ticks() {
+#if defined(TAUSSIG_HAS_RDTSC)
+            return __rdtsc();
+#else
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+    } // namespace detail
+
+    //! {function}
+    //! *Returns*: the totals for the probes named `name`, registering them if needed.
+    inline probe_stats& probe_stats_for(std::string const& name) {
+        auto& registry = detail::probes();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for(auto& s : registry.stats) {
+            if(s.name == name) return s;
+        }
+        registry.stats.emplace_back(name);
+        return registry.stats.back();
+    }
+
+    //! {function}
+    //! *Effects*: zeroes the totals of all probes.
+    inline void reset_probes() {
+        auto& registry = detail::probes();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for(auto& s : registry.stats) {
+            s.empty_calls = 0;
+            s.front_calls = 0;
+            s.pop_front_calls = 0;
+            s.sampled = 0;
+            s.ticks = 0;
+        }
+    }
+
+    //! {function}
+    //! *Effects*: writes one line per probe to `os` with its call counts and, when sampled, the
+    //!            average ticks spent upstream per call.
+    //! *Note*: the format flags and precision of `os` are restored afterwards.
+    inline void dump_probes(std::ostream& os) {
+        auto& registry = detail::probes();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto const flags = os.flags();
+        auto const precision = os.precision();
+        os << std::left << std::setw(24) << "probe" << std::right
+           << std::setw(14) << "empty" << std::setw(14) << "front" << std::setw(14) << "pop_front"
+           << std::setw(14) << "ticks/call" << '\n';
+        for(auto& s : registry.stats) {
+            os << std::left << std::setw(24) << s.name << std::right
+               << std::setw(14) << s.empty_calls << std::setw(14) << s.front_calls << std::setw(14) << s.pop_front_calls;
+            if(s.sampled) os << std::setw(14) << std::fixed << std::setprecision(1) << double(s.ticks) / double(s.sampled);
+            os << '\n';
+        }
+        os.flags(flags);
+        os.precision(precision);
+    }
+
+    //! {tag}
+    //! Requests that a probe also samples the time spent in the sequence it wraps.
+    struct sample_ticks_tag {};
+    constexpr sample_ticks_tag sample_ticks {};
+
+    template <typename Seq, bool Timed>
+    struct probe_sequence : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+
+        // one call in this many is timed
+        static constexpr std::uint64_t sample_period = 64;
+        // counts are published at least this often, for sequences that live long
+        static constexpr std::uint64_t flush_period = 1 << 16;
+
+    public:
+        template <typename SeqF,
+                  wheels::meta::DisableIfRelated<SeqF, probe_sequence<Seq, Timed>>...>
+        probe_sequence(SeqF&& s, probe_stats& stats)
+        : s(std::forward<SeqF>(s)), stats(&stats) {}
+
+        // each object counts only the calls made on it, so copies start from zero
+        probe_sequence(probe_sequence const& that)
+        : s(that.s), stats(that.stats) {}
+        probe_sequence(probe_sequence&& that)
+        : s(std::move(that.s)), stats(that.stats)
+        , empty_calls(that.empty_calls), front_calls(that.front_calls), pop_front_calls(that.pop_front_calls)
+        , sampled(that.sampled), ticks(that.ticks) {
+            that.clear();
+        }
+        probe_sequence& operator=(probe_sequence const& that) {
+            flush();
+            s = that.s;
+            stats = that.stats;
+            return *this;
+        }
+        probe_sequence& operator=(probe_sequence&& that) {
+            flush();
+            s = std::move(that.s);
+            stats = that.stats;
+            empty_calls = that.empty_calls;
+            front_calls = that.front_calls;
+            pop_front_calls = that.pop_front_calls;
+            sampled = that.sampled;
+            ticks = that.ticks;
+            that.clear();
+            return *this;
+        }
+
+        ~probe_sequence() { flush(); }
+
+        using reference = ReferenceType<seq_type>;
+        using value_type = wheels::meta::Decay<reference>;
+
+        bool empty() const {
+            auto start = sample_start(++empty_calls);
+            bool result = seq::empty(s);
+            sample_end(start);
+            return result;
+        }
+        void pop_front() {
+            auto start = sample_start(++pop_front_calls);
+            seq::pop_front(s);
+            sample_end(start);
+            if(pop_front_calls % flush_period == 0) flush();
+        }
+        reference front() const {
+            auto start = sample_start(++front_calls);
+            reference result = seq::front(s);
+            sample_end(start);
+            return std::forward<reference>(result);
+        }
+
+        //! {function}
+        //! *Effects*: adds the calls counted so far to the totals of this probe's name.
+        void flush() const {
+            if(empty_calls) stats->empty_calls.fetch_add(empty_calls, std::memory_order_relaxed);
+            if(front_calls) stats->front_calls.fetch_add(front_calls, std::memory_order_relaxed);
+            if(pop_front_calls) stats->pop_front_calls.fetch_add(pop_front_calls, std::memory_order_relaxed);
+            if(sampled) {
+                stats->sampled.fetch_add(sampled, std::memory_order_relaxed);
+                stats->ticks.fetch_add(ticks, std::memory_order_relaxed);
+            }
+            clear();
+        }
+
+    private:
+        seq_type s;
+        probe_stats* stats;
+        mutable std::uint64_t empty_calls = 0;
+        mutable std::uint64_t front_calls = 0;
+        mutable std::uint64_t pop_front_calls = 0;
+        mutable std::uint64_t sampled = 0;
+        mutable std::uint64_t ticks = 0;
+
+        void clear() const {
+            empty_calls = front_calls = pop_front_calls = sampled = ticks = 0;
+        }
+
+        // a start of zero means the call is not sampled
+        std::uint64_t sample_start(std::uint64_t calls) const {
+            return Timed && calls % sample_period == 1? detail::probe_ticks() : 0;
+        }
+        void sample_end(std::uint64_t start) const {
+            if(Timed && start) {
+                ticks += detail::probe_ticks() - start;
+                ++sampled;
+            }
+        }
+    };
+    static_assert(is_true_sequence<probe_sequence<fake_sequence<int>, true>>(), "probe_sequence must be a true sequence");
+
+#if defined(TAUSSIG_NO_PROBES)
+    // the name is taken as is, so no string is built for it
+    template <typename Seq, typename Name,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    wheels::meta::Decay<Seq> probe(Seq&& s, Name const&) {
+        return std::forward<Seq>(s);
+    }
+    template <typename Seq, typename Name,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    wheels::meta::Decay<Seq> probe(Seq&& s, Name const&, sample_ticks_tag) {
+        return std::forward<Seq>(s);
+    }
+#else
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft].
+    //! *Returns*: a sequence with the same elements as `s` that counts the calls made on it
+    //!            under `name`; see `dump_probes`.
+    //! *Note*: with `TAUSSIG_NO_PROBES` defined, returns a copy of `s` instead.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    probe_sequence<Seq, false> probe(Seq&& s, std::string const& name) {
+        return { std::forward<Seq>(s), probe_stats_for(name) };
+    }
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft].
+    //! *Returns*: like `probe(s, name)`, but also samples the time spent in calls on `s`.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    probe_sequence<Seq, true> probe(Seq&& s, std::string const& name, sample_ticks_tag) {
+        return { std::forward<Seq>(s), probe_stats_for(name) };
+    }
+#endif // TAUSSIG_NO_PROBES
+
+    namespace result_of {
+        template <typename Seq>
+        using probe = decltype(seq::probe(std::declval<Seq>(), std::declval<std::string const&>()));
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_PROBE_HPP
@@ -0,0 +1,316 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Prefix scans
+
+#ifndef TAUSSIG_ALGORITHMS_SCAN_HPP
+#define TAUSSIG_ALGORITHMS_SCAN_HPP
+
+#include <taussig/algorithms/fold.h++>
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/iterators.h++>
+#include <taussig/detail/parallel.h++>
+#include <taussig/detail/scan_kernels.h++>
+
+#include <wheels/fun/result_of.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/unqual.h++>
+
+#include <functional> // plus
+#include <iterator> // random_access_iterator_tag
+#include <memory> // addressof
+#include <type_traits> // is_integral, is_same
+#include <utility> // forward, move, declval
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        struct scan_from_front_tag {};
+    } // namespace detail
+
+    template <typename Seq, typename T, typename Fun>
+    struct inclusive_scan_sequence : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using fun_type = wheels::meta::Decay<Fun>;
+    public:
+        template <typename SeqF, typename TF, typename FunF>
+        inclusive_scan_sequence(SeqF&& s, TF&& init, FunF&& fun)
+        : s(std::forward<SeqF>(s)), fun(std::forward<FunF>(fun)), acc(std::forward<TF>(init)) {
+            if(!seq::empty(this->s)) acc = wheels::fun::invoke(this->fun, std::move(acc), seq::front(this->s));
+        }
+        template <typename SeqF, typename FunF>
+        inclusive_scan_sequence(SeqF&& s, detail::scan_from_front_tag, FunF&& fun)
+        : s(std::forward<SeqF>(s)), fun(std::forward<FunF>(fun)), acc(seq::empty(this->s)? T() : T(seq::front(this->s))) {}
+
+        using reference = T const&;
+        using value_type = T;
+
+        bool empty() const { return seq::empty(s); }
+        void pop_front() {
+            seq::pop_front(s);
+            if(!seq::empty(s)) acc = wheels::fun::invoke(fun, std::move(acc), seq::front(s));
+        }
+        reference front() const { return acc; }
+
+    private:
+        seq_type s;
+        fun_type fun;
+        T acc; // the current front
+    };
+    static_assert(is_true_sequence<inclusive_scan_sequence<fake_sequence<int>, int, int(*)(int, int)>>(), "inclusive_scan_sequence must be a true sequence");
+
+    template <typename Seq, typename T, typename Fun>
+    struct exclusive_scan_sequence : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using fun_type = wheels::meta::Decay<Fun>;
+    public:
+        template <typename SeqF, typename TF, typename FunF>
+        exclusive_scan_sequence(SeqF&& s, TF&& init, FunF&& fun)
+        : s(std::forward<SeqF>(s)), fun(std::forward<FunF>(fun)), acc(std::forward<TF>(init)) {}
+
+        using reference = T const&;
+        using value_type = T;
+
+        bool empty() const { return seq::empty(s); }
+        void pop_front() {
+            acc = wheels::fun::invoke(fun, std::move(acc), seq::front(s));
+            seq::pop_front(s);
+        }
+        reference front() const { return acc; }
+
+    private:
+        seq_type s;
+        fun_type fun;
+        T acc; // the current front
+    };
+    static_assert(is_true_sequence<exclusive_scan_sequence<fake_sequence<int>, int, int(*)(int, int)>>(), "exclusive_scan_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; `fun` can be called with a `T` and an element of
+    //!             `s` and its result converts to `T` [soft].
+    //! *Returns*: a sequence of the running results of folding `s` with `fun` from `init`, the
+    //!            first of which is `fun(init, e0)`.
+    template <typename Seq, typename T, typename Fun,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<wheels::meta::Decay<Fun>&, void(wheels::meta::Decay<T>, ReferenceType<Seq>)>>...>
+    inclusive_scan_sequence<Seq, wheels::meta::Decay<T>, Fun> inclusive_scan(Seq&& s, T&& init, Fun&& fun) {
+        return { std::forward<Seq>(s), std::forward<T>(init), std::forward<Fun>(fun) };
+    }
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; its value type is default-constructible; `fun` can be
+    //!             called with a value and an element of `s` and its result converts to the value
+    //!             type [soft].
+    //! *Returns*: a sequence of the running results of folding `s` with `fun`, the first of which is
+    //!            the first element of `s`.
+    template <typename Seq, typename Fun,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<wheels::meta::Decay<Fun>&, void(ValueType<Seq>, ReferenceType<Seq>)>>...>
+    inclusive_scan_sequence<Seq, ValueType<Seq>, Fun> inclusive_scan(Seq&& s, Fun&& fun) {
+        return { std::forward<Seq>(s), detail::scan_from_front_tag{}, std::forward<Fun>(fun) };
+    }
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; `fun` can be called with a `T` and an element of
+    //!             `s` and its result converts to `T` [soft].
+    //! *Returns*: a sequence of the running results of folding `s` with `fun` from `init`, the
+    //!            first of which is `init`; it has as many elements as `s`.
+    template <typename Seq, typename T, typename Fun,
+              wheels::meta::EnableIf<is_sequence<Seq>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<wheels::meta::Decay<Fun>&, void(wheels::meta::Decay<T>, ReferenceType<Seq>)>>...>
+    exclusive_scan_sequence<Seq, wheels::meta::Decay<T>, Fun> exclusive_scan(Seq&& s, T&& init, Fun&& fun) {
+        return { std::forward<Seq>(s), std::forward<T>(init), std::forward<Fun>(fun) };
+    }
+
+    namespace result_of {
+        template <typename Seq, typename T, typename Fun>
+        using inclusive_scan = decltype(seq::inclusive_scan(std::declval<Seq>(), std::declval<T>(), std::declval<Fun>()));
+        template <typename Seq, typename T, typename Fun>
+        using exclusive_scan = decltype(seq::exclusive_scan(std::declval<Seq>(), std::declval<T>(), std::declval<Fun>()));
+    } // namespace result_of
+
+    namespace detail {
+        template <typename S, typename O, typename T, typename Op,
+                  bool = is_contiguous_sequence<S>() && is_contiguous_iterator<O>()>
+        struct is_prefix_summable : wheels::meta::False {};
+        template <typename S, typename O, typename T, typename Op>
+        struct is_prefix_summable<S, O, T, Op, true>
+        : wheels::meta::Bool<
+            std::is_integral<ValueType<S>>()
+            && (sizeof(ValueType<S>) == 4 || sizeof(ValueType<S>) == 8)
+            && std::is_same<wheels::meta::Unqual<IteratorValueType<O>>, ValueType<S>>()
+            && std::is_same<T, ValueType<S>>()
+            && std::is_same<wheels::meta::Decay<Op>, std::plus<ValueType<S>>>()
+        > {};
+
+        template <bool Inclusive, typename S, typename O, typename T, typename Op>
+        O scan_into(S& s, O out, T acc, Op& op, wheels::meta::False) {
+            for(; !seq::empty(s); seq::pop_front(s)) {
+                T next = op(acc, seq::front(s));
+                *out = Inclusive? next : std::move(acc);
+                ++out;
+                acc = std::move(next);
+            }
+            return out;
+        }
+        template <bool Inclusive, typename S, typename O, typename T, typename Op>
+        O scan_into(S& s, O out, T acc, Op&, wheels::meta::True) {
+            auto const n = contiguous_size(s);
+            if(n == 0) return out;
+            prefix_sum<Inclusive>(contiguous_data(s), std::addressof(*out), n, acc);
+            return out + n;
+        }
+        template <bool Inclusive, typename S, typename O, typename T, typename Op>
+        O scan_into(S& s, O out, T acc, Op& op) {
+            return scan_into<Inclusive>(s, out, std::move(acc), op, is_prefix_summable<S, O, T, Op>{});
+        }
+
+        // Two passes over slices: the first reduces each slice, the totals are scanned on the
+        // calling thread, and the second scans each slice starting from its total
+        template <bool Inclusive, typename S, typename O, typename T, typename Op>
+        O scan_into_parallel(S& s, O out, T acc, Op& op, parallel_policy, wheels::meta::False) {
+            return scan_into<Inclusive>(s, out, std::move(acc), op);
+        }
+        template <bool Inclusive, typename S, typename O, typename T, typename Op>
+        O scan_into_parallel(S& s, O out, T acc, Op& op, parallel_policy policy, wheels::meta::True) {
+            auto const n = static_cast<std::size_t>(s.second - s.first);
+            auto const chunks = chunk_count(policy, n);
+            if(chunks < 2) return scan_into<Inclusive>(s, out, std::move(acc), op);
+            auto totals = for_each_chunk(n, chunks, [&s, &op](std::size_t, std::size_t first, std::size_t last) {
+                S part { s.first + first, s.first + last };
+                T total = seq::front(part);
+                seq::pop_front(part);
+                return reduce(part, std::move(total), op, is_unrollable<S, T, Op>{});
+            });
+            std::vector<T> starts;
+            starts.reserve(chunks);
+            starts.push_back(std::move(acc));
+            for(std::size_t i = 0; i + 1 < chunks; ++i) starts.push_back(op(starts[i], std::move(totals[i])));
+            for_each_chunk(n, chunks, [&s, &out, &op, &starts](std::size_t i, std::size_t first, std::size_t last) {
+                S part { s.first + first, s.first + last };
+                scan_into<Inclusive>(part, out + first, std::move(starts[i]), op);
+                return 0;
+            });
+            return out + n;
+        }
+
+        template <typename S, typename O>
+        struct is_parallel_scannable
+        : wheels::meta::Bool<is_random_access_sequence<S>() && is_iterator<O, std::random_access_iterator_tag>()> {};
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` is a sequence [soft]; `fun` can be called with a `T` and an element of `s`
+    //!             and its result converts to `T` [soft]; `out` can be written as many elements as
+    //!             `s` has [undefined].
+    //! *Effects*: writes the running results of folding `s` with `fun` from `init` to `out`,
+    //!            starting with `fun(init, e0)`.
+    //! *Returns*: `out` advanced past the last element written.
+    //! *Note*: integral prefix sums with `std::plus` between contiguous buffers use SIMD blocks.
+    template <typename S, typename O, typename T, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(T, ReferenceType<S>)>>...>
+    O inclusive_scan_into(S s, O out, T init, Op op) {
+        return detail::scan_into<true>(s, out, std::move(init), op);
+    }
+
+    //! {function}
+    //! *Requires*: as for `inclusive_scan_into(s, out, init, op)`; `op` is associative and may be
+    //!             called concurrently [undefined].
+    //! *Effects*: as `inclusive_scan_into(s, out, init, op)`; when `s` is random-access and `out` is a
+    //!            random-access iterator, the work is split into slices that are first reduced and
+    //!            then scanned on separate threads.
+    //! *Returns*: `out` advanced past the last element written.
+    template <typename S, typename O, typename T, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(T, ReferenceType<S>)>>...>
+    O inclusive_scan_into(S s, O out, T init, Op op, parallel_policy policy) {
+        return detail::scan_into_parallel<true>(s, out, std::move(init), op, policy, detail::is_parallel_scannable<S, O>{});
+    }
+
+    //! {function}
+    //! *Requires*: as for `inclusive_scan_into(s, out, init, op)`, with `T` the value type of `S`.
+    //! *Effects*: writes the running results of folding `s` with `op` to `out`, starting with the
+    //!            first element of `s`.
+    //! *Returns*: `out` advanced past the last element written.
+    template <typename S, typename O, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(ValueType<S>, ReferenceType<S>)>>...>
+    O inclusive_scan_into(S s, O out, Op op) {
+        if(seq::empty(s)) return out;
+        ValueType<S> first = seq::front(s);
+        seq::pop_front(s);
+        *out = first;
+        ++out;
+        return seq::inclusive_scan_into(std::move(s), out, std::move(first), std::move(op));
+    }
+
+    //! {function}
+    //! *Requires*: as for `inclusive_scan_into(s, out, init, op, policy)`, with `T` the value type of `S`.
+    //! *Effects*: as `inclusive_scan_into(s, out, op)`, spread over threads as for
+    //!            `inclusive_scan_into(s, out, init, op, policy)`.
+    //! *Returns*: `out` advanced past the last element written.
+    template <typename S, typename O, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(ValueType<S>, ReferenceType<S>)>>...>
+    O inclusive_scan_into(S s, O out, Op op, parallel_policy policy) {
+        if(seq::empty(s)) return out;
+        ValueType<S> first = seq::front(s);
+        seq::pop_front(s);
+        *out = first;
+        ++out;
+        return seq::inclusive_scan_into(std::move(s), out, std::move(first), std::move(op), policy);
+    }
+
+    //! {function}
+    //! *Requires*: as for `inclusive_scan_into(s, out, init, op)`.
+    //! *Effects*: writes the running results of folding `s` with `op` from `init` to `out`, starting
+    //!            with `init` and leaving out the total.
+    //! *Returns*: `out` advanced past the last element written.
+    //! *Note*: integral prefix sums with `std::plus` between contiguous buffers use SIMD blocks.
+    template <typename S, typename O, typename T, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(T, ReferenceType<S>)>>...>
+    O exclusive_scan_into(S s, O out, T init, Op op) {
+        return detail::scan_into<false>(s, out, std::move(init), op);
+    }
+
+    //! {function}
+    //! *Requires*: as for `inclusive_scan_into(s, out, init, op, policy)`.
+    //! *Effects*: as `exclusive_scan_into(s, out, init, op)`, spread over threads as for
+    //!            `inclusive_scan_into(s, out, init, op, policy)`.
+    //! *Returns*: `out` advanced past the last element written.
+    template <typename S, typename O, typename T, typename Op,
+              wheels::meta::EnableIf<is_sequence<S>>...,
+              wheels::meta::EnableIf<wheels::fun::is_invocable<Op&, void(T, ReferenceType<S>)>>...>
+    O exclusive_scan_into(S s, O out, T init, Op op, parallel_policy policy) {
+        return detail::scan_into_parallel<false>(s, out, std::move(init), op, policy, detail::is_parallel_scannable<S, O>{});
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_SCAN_HPP
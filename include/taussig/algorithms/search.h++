@@ -0,0 +1,130 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence search() algorithm
+
+#ifndef TAUSSIG_ALGORITHMS_SEARCH_HPP
+#define TAUSSIG_ALGORITHMS_SEARCH_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/value_type.h++>
+
+#include <taussig/interop/materialize.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/fun_objects.h++>
+#include <taussig/detail/search_kernels.h++>
+
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/invoke.h++>
+#include <wheels/meta/unqual.h++>
+
+#include <type_traits> // conditional, is_integral, is_arithmetic, is_same
+#include <utility> // move
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        struct linear_search_tag { using type = linear_search_tag; };
+        struct two_way_search_tag { using type = two_way_search_tag; };
+        struct contiguous_search_tag { using type = contiguous_search_tag; };
+
+        template <typename S, typename N,
+                  bool = is_contiguous_sequence<S>() && is_contiguous_sequence<N>(),
+                  bool = is_random_access_sequence<S>()>
+        struct search_kind_of : linear_search_tag {};
+        template <typename S, typename N>
+        struct search_kind_of<S, N, false, true>
+        : std::conditional<std::is_arithmetic<ValueType<N>>::value, two_way_search_tag, linear_search_tag>::type {};
+        template <typename S, typename N>
+        struct search_kind_of<S, N, true, true>
+        : std::conditional<std::is_integral<ValueType<S>>::value
+                           && !std::is_same<ValueType<S>, bool>::value
+                           && std::is_same<wheels::meta::Unqual<ValueType<S>>, wheels::meta::Unqual<ValueType<N>>>::value,
+                contiguous_search_tag,
+                typename search_kind_of<S, N, false, true>::type>::type {};
+
+        template <typename S, typename N,
+                  typename Kind = wheels::meta::Invoke<search_kind_of<S, N>>>
+        struct search {
+            // Morris-Pratt over a single forward pass; `start` trails the scan at the candidate match
+            static S call(S s, N needle) {
+                auto pattern = seq::materialize<std::vector<ValueType<N>>>(std::move(needle));
+                std::size_t const m = pattern.size();
+                if(m == 0) return s;
+
+                std::vector<std::size_t> border(m);
+                for(std::size_t i = 1, k = 0; i < m; ++i) {
+                    while(k > 0 && !detail::equal_to{}(pattern[i], pattern[k])) k = border[k - 1];
+                    if(detail::equal_to{}(pattern[i], pattern[k])) ++k;
+                    border[i] = k;
+                }
+
+                S start = s;
+                std::size_t q = 0;
+                for(; !seq::empty(s); seq::pop_front(s)) {
+                    auto&& c = seq::front(s);
+                    while(q > 0 && !detail::equal_to{}(c, pattern[q])) {
+                        auto const b = border[q - 1];
+                        for(; q > b; --q) seq::pop_front(start);
+                    }
+                    if(detail::equal_to{}(c, pattern[q])) ++q;
+                    else seq::pop_front(start);
+                    if(q == m) return start;
+                }
+                return s;
+            }
+        };
+        template <typename S, typename N>
+        struct search<S, N, two_way_search_tag> {
+            static S call(S s, N needle) {
+                return call(std::move(s), std::move(needle), is_random_access_sequence<N>{});
+            }
+            static S call(S s, N needle, std::true_type) {
+                s.first = two_way_search(s.first, s.second, needle.first, needle.second);
+                return s;
+            }
+            static S call(S s, N needle, std::false_type) {
+                auto pattern = seq::materialize<std::vector<ValueType<N>>>(std::move(needle));
+                s.first = two_way_search(s.first, s.second, pattern.begin(), pattern.end());
+                return s;
+            }
+        };
+        template <typename S, typename N>
+        struct search<S, N, contiguous_search_tag> {
+            static S call(S s, N const& needle) {
+                s.first += search_values(contiguous_data(s), contiguous_size(s),
+                                         contiguous_data(needle), contiguous_size(needle));
+                return s;
+            }
+        };
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` and `N` are sequences [soft] and their elements are comparable.
+    //! *Returns*: the remainder of `haystack` starting at the first occurrence of `needle`;
+    //!            an empty sequence if `needle` does not occur in `haystack`.
+    //! *Complexity*: linear. Random-access haystacks use Two-Way; contiguous sequences of integral
+    //!               values are scanned with a vectorised first/last element filter; other sequences
+    //!               are searched in a single pass.
+    template <typename S, typename N,
+              wheels::meta::EnableIf<is_sequence<S>, is_sequence<N>>...>
+    S search(S haystack, N needle) {
+        return detail::search<S, N>::call(std::move(haystack), std::move(needle));
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_SEARCH_HPP
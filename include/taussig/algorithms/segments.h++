@@ -0,0 +1,71 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Segmented sequences
+
+#ifndef TAUSSIG_ALGORITHMS_SEGMENTS_HPP
+#define TAUSSIG_ALGORITHMS_SEGMENTS_HPP
+
+#include <taussig/detail/indices.h++>
+
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/depend_on.h++>
+#include <wheels/meta/trait_of.h++>
+
+#include <tuple>
+#include <utility> // forward
+
+namespace seq {
+    namespace detail {
+        struct segmented_test {
+            template <typename T>
+            wheels::meta::DependOn<wheels::meta::True, typename T::segments_type> static test(int);
+            template <typename>
+            wheels::meta::False static test(...);
+        };
+    } // namespace detail
+
+    //! {trait}
+    //! *Returns*: `true` if `S` is a sequence made of segments, with a `segments()` member function
+    //!            that returns them as a `segments_type` tuple; `false` otherwise.
+    template <typename S>
+    struct is_segmented : wheels::meta::TraitOf<detail::segmented_test, wheels::meta::Decay<S>> {};
+
+    namespace detail {
+        template <typename Segments, typename Fun, std::size_t... I>
+        void for_each_segment(Segments const& segments, Fun& fun, indices<I...>) {
+            swallow { (fun(std::get<I>(segments)), 0)... };
+        }
+        template <typename S, typename Fun>
+        void for_each_segment(S const& s, Fun& fun, wheels::meta::True) {
+            using segments_type = typename wheels::meta::Decay<S>::segments_type;
+            for_each_segment(s.segments(), fun, IndicesFor<std::tuple_size<segments_type>::value>{});
+        }
+        template <typename S, typename Fun>
+        void for_each_segment(S const& s, Fun& fun, wheels::meta::False) {
+            fun(s);
+        }
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `fun` can be called with each segment of `s` [soft].
+    //! *Effects*: calls `fun` with each segment of `s` in order, or with `s` itself if it is not
+    //!            segmented; segments already consumed are empty.
+    //! *Note*: terminals use this to run a tight loop per segment instead of dispatching on every
+    //!         element.
+    template <typename S, typename Fun>
+    void for_each_segment(S const& s, Fun&& fun) {
+        detail::for_each_segment(s, fun, is_segmented<S>{});
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_SEGMENTS_HPP
@@ -0,0 +1,309 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence set_union(), set_intersection(), and set_difference() algorithms
+
+#ifndef TAUSSIG_ALGORITHMS_SET_OPERATIONS_HPP
+#define TAUSSIG_ALGORITHMS_SET_OPERATIONS_HPP
+
+#include <taussig/algorithms/concat.h++> // ConcatReference
+#include <taussig/algorithms/merge.h++> // SourceSequence
+
+#include <taussig/primitives/as_sequence.h++>
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/fun_objects.h++>
+#include <taussig/detail/intersect_kernels.h++>
+
+#include <wheels/meta/all.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <algorithm> // lower_bound
+#include <functional> // less, ref
+#include <iterator> // iterator_traits
+#include <type_traits> // is_same
+#include <utility> // forward
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t
+
+namespace seq {
+    namespace detail {
+        //! {function}
+        //! *Requires*: `[first, last)` is sorted by `cmp` and `cmp(*first, key)` [undefined].
+        //! *Returns*: the first iterator in `[first, last)` that does not go before `key`, or `last`.
+        //! *Note*: probes at doubling distances and then searches the last gap, so skipping `d`
+        //!         elements takes about `2 log2(d)` comparisons.
+        template <typename I, typename T, typename Cmp>
+        I gallop(I first, I last, T const& key, Cmp& cmp) {
+            typename std::iterator_traits<I>::difference_type step = 1;
+            for(;;) {
+                if(last - first <= step) return std::lower_bound(first + 1, last, key, std::ref(cmp));
+                auto const probe = first + step;
+                if(!cmp(*probe, key)) return std::lower_bound(first + 1, probe, key, std::ref(cmp));
+                first = probe;
+                step *= 2;
+            }
+        }
+
+        // drops the elements of a sequence that go before key; the first one is known to
+        template <typename Seq, typename T, typename Cmp>
+        void skip_before(Seq& s, T const& key, Cmp& cmp, wheels::meta::True) {
+            // most skips are short when the lengths are similar
+            ++s.first;
+            if(s.first != s.second && cmp(*s.first, key)) s.first = gallop(s.first, s.second, key, cmp);
+        }
+        template <typename Seq, typename T, typename Cmp>
+        void skip_before(Seq& s, T const& key, Cmp& cmp, wheels::meta::False) {
+            do seq::pop_front(s);
+            while(!seq::empty(s) && cmp(seq::front(s), key));
+        }
+        template <typename Seq, typename T, typename Cmp>
+        void skip_before(Seq& s, T const& key, Cmp& cmp) {
+            skip_before(s, key, cmp, is_random_access_sequence<Seq>{});
+        }
+
+        template <typename Cmp>
+        struct is_plain_less : std::is_same<Cmp, less> {};
+        template <>
+        struct is_plain_less<std::less<std::uint32_t>> : wheels::meta::True {};
+
+        //! {trait}
+        //! *Returns*: `true` if the common elements of `S1` and `S2` ordered by `Cmp` can be found
+        //!            with the block intersection kernel; `false` otherwise.
+        template <typename S1, typename S2, typename Cmp,
+                  bool = is_contiguous_sequence<S1>() && is_contiguous_sequence<S2>()>
+        struct is_block_intersectable : wheels::meta::False {};
+        template <typename S1, typename S2, typename Cmp>
+        struct is_block_intersectable<S1, S2, Cmp, true>
+        : wheels::meta::All<
+            is_contiguous_sequence_of<S1, std::uint32_t>,
+            is_contiguous_sequence_of<S2, std::uint32_t>,
+            is_plain_less<Cmp>
+        > {};
+
+        // the block kernel pays off while neither side is this many times longer than the other;
+        // beyond that, galloping over the longer side is cheaper
+        constexpr std::size_t block_intersection_ratio = 32;
+    } // namespace detail
+
+    template <typename Seq1, typename Seq2, typename Cmp>
+    struct set_union_sequence : true_sequence {
+    private:
+        using seq1_type = wheels::meta::Decay<Seq1>;
+        using seq2_type = wheels::meta::Decay<Seq2>;
+
+    public:
+        template <typename Seq1F, typename Seq2F, typename CmpF>
+        set_union_sequence(Seq1F&& s1, Seq2F&& s2, CmpF&& cmp)
+        : s1(std::forward<Seq1F>(s1)), s2(std::forward<Seq2F>(s2)), cmp(std::forward<CmpF>(cmp)) {
+            choose();
+        }
+
+        using reference = detail::ConcatReference<ReferenceType<seq1_type>, ReferenceType<seq2_type>>;
+        using value_type = wheels::meta::Decay<reference>;
+
+        bool empty() const { return seq::empty(s1) && seq::empty(s2); }
+        void pop_front() {
+            if(from != second) seq::pop_front(s1);
+            if(from != first) seq::pop_front(s2);
+            choose();
+        }
+        reference front() const { return from == second? seq::front(s2) : seq::front(s1); }
+
+    private:
+        enum source { first, second, both };
+
+        seq1_type s1;
+        seq2_type s2;
+        wheels::meta::Decay<Cmp> cmp;
+        source from;
+
+        // equal elements are taken once, from s1
+        void choose() {
+            if(seq::empty(s1)) from = second;
+            else if(seq::empty(s2)) from = first;
+            else if(cmp(seq::front(s1), seq::front(s2))) from = first;
+            else if(cmp(seq::front(s2), seq::front(s1))) from = second;
+            else from = both;
+        }
+    };
+    static_assert(is_true_sequence<set_union_sequence<fake_sequence<int>, fake_sequence<int>, detail::less>>(), "set_union_sequence must be a true sequence");
+
+    template <typename Seq1, typename Seq2, typename Cmp>
+    struct set_intersection_sequence : true_sequence {
+    private:
+        using seq1_type = wheels::meta::Decay<Seq1>;
+        using seq2_type = wheels::meta::Decay<Seq2>;
+        using cmp_type = wheels::meta::Decay<Cmp>;
+
+    public:
+        template <typename Seq1F, typename Seq2F, typename CmpF>
+        set_intersection_sequence(Seq1F&& s1, Seq2F&& s2, CmpF&& cmp)
+        : s1(std::forward<Seq1F>(s1)), s2(std::forward<Seq2F>(s2)), cmp(std::forward<CmpF>(cmp)) {
+            seek();
+        }
+
+        using reference = ReferenceType<seq1_type>;
+        using value_type = ValueType<seq1_type>;
+
+        bool empty() const { return seq::empty(s1) || seq::empty(s2); }
+        void pop_front() {
+            seq::pop_front(s1);
+            seq::pop_front(s2);
+            seek();
+        }
+        reference front() const { return seq::front(s1); }
+
+    private:
+        seq1_type s1;
+        seq2_type s2;
+        cmp_type cmp;
+
+        // moves both sequences to their next common element
+        void seek() {
+            skip_blocks(detail::is_block_intersectable<seq1_type, seq2_type, cmp_type>{});
+            while(!seq::empty(s1) && !seq::empty(s2)) {
+                if(cmp(seq::front(s1), seq::front(s2))) detail::skip_before(s1, seq::front(s2), cmp);
+                else if(cmp(seq::front(s2), seq::front(s1))) detail::skip_before(s2, seq::front(s1), cmp);
+                else return;
+            }
+        }
+
+        void skip_blocks(wheels::meta::True) {
+            auto const n1 = detail::contiguous_size(s1);
+            auto const n2 = detail::contiguous_size(s2);
+            if(n1 > n2 * detail::block_intersection_ratio || n2 > n1 * detail::block_intersection_ratio) return;
+            std::size_t i = 0, j = 0;
+            detail::skip_disjoint_blocks(detail::contiguous_data(s1), n1, i, detail::contiguous_data(s2), n2, j);
+            s1.first += i;
+            s2.first += j;
+        }
+        void skip_blocks(wheels::meta::False) {}
+    };
+    static_assert(is_true_sequence<set_intersection_sequence<fake_sequence<int>, fake_sequence<int>, detail::less>>(), "set_intersection_sequence must be a true sequence");
+
+    template <typename Seq1, typename Seq2, typename Cmp>
+    struct set_difference_sequence : true_sequence {
+    private:
+        using seq1_type = wheels::meta::Decay<Seq1>;
+        using seq2_type = wheels::meta::Decay<Seq2>;
+
+    public:
+        template <typename Seq1F, typename Seq2F, typename CmpF>
+        set_difference_sequence(Seq1F&& s1, Seq2F&& s2, CmpF&& cmp)
+        : s1(std::forward<Seq1F>(s1)), s2(std::forward<Seq2F>(s2)), cmp(std::forward<CmpF>(cmp)) {
+            seek();
+        }
+
+        using reference = ReferenceType<seq1_type>;
+        using value_type = ValueType<seq1_type>;
+
+        bool empty() const { return seq::empty(s1); }
+        void pop_front() {
+            seq::pop_front(s1);
+            seek();
+        }
+        reference front() const { return seq::front(s1); }
+
+    private:
+        seq1_type s1;
+        seq2_type s2;
+        wheels::meta::Decay<Cmp> cmp;
+
+        // moves s1 to its next element without a match in s2; each match cancels one element
+        void seek() {
+            while(!seq::empty(s1) && !seq::empty(s2)) {
+                if(cmp(seq::front(s1), seq::front(s2))) return;
+                if(cmp(seq::front(s2), seq::front(s1))) detail::skip_before(s2, seq::front(s1), cmp);
+                else {
+                    seq::pop_front(s1);
+                    seq::pop_front(s2);
+                }
+            }
+        }
+    };
+    static_assert(is_true_sequence<set_difference_sequence<fake_sequence<int>, fake_sequence<int>, detail::less>>(), "set_difference_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `S1` and `S2` are sequence sources [soft]; their elements are sorted by `cmp`
+    //!             [undefined]; sources that are not sequences themselves outlive the result [undefined].
+    //! *Returns*: a sorted sequence of the elements in either `s1` or `s2`.
+    //! *Note*: as `std::set_union`: an element found `m` times in `s1` and `n` times in `s2`
+    //!         appears `max(m, n)` times, taken from `s1` first. If the sources have different
+    //!         reference types, the elements are values of their common type.
+    template <typename S1, typename S2, typename Cmp,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<S1>>, is_sequence<detail::SourceSequence<S2>>>...>
+    set_union_sequence<detail::SourceSequence<S1>, detail::SourceSequence<S2>, Cmp> set_union(S1&& s1, S2&& s2, Cmp&& cmp) {
+        return { seq::as_sequence(std::forward<S1>(s1)), seq::as_sequence(std::forward<S2>(s2)), std::forward<Cmp>(cmp) };
+    }
+
+    //! {function}
+    //! *Returns*: `set_union(s1, s2, cmp)` with `cmp` comparing by `<`.
+    template <typename S1, typename S2,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<S1>>, is_sequence<detail::SourceSequence<S2>>>...>
+    set_union_sequence<detail::SourceSequence<S1>, detail::SourceSequence<S2>, detail::less> set_union(S1&& s1, S2&& s2) {
+        return { seq::as_sequence(std::forward<S1>(s1)), seq::as_sequence(std::forward<S2>(s2)), detail::less{} };
+    }
+
+    //! {function}
+    //! *Requires*: as for `set_union`.
+    //! *Returns*: a sorted sequence of the elements of `s1` that are also in `s2`.
+    //! *Note*: as `std::set_intersection`: an element found `m` times in `s1` and `n` times in
+    //!         `s2` appears `min(m, n)` times. Random-access sources skip ahead by galloping, so
+    //!         intersecting a short sequence with a much longer one takes about `2 log2(n / m)`
+    //!         comparisons per element of the short one. Contiguous sequences of `std::uint32_t`
+    //!         of similar lengths, ordered by `<`, skip four elements at a time with SIMD.
+    template <typename S1, typename S2, typename Cmp,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<S1>>, is_sequence<detail::SourceSequence<S2>>>...>
+    set_intersection_sequence<detail::SourceSequence<S1>, detail::SourceSequence<S2>, Cmp> set_intersection(S1&& s1, S2&& s2, Cmp&& cmp) {
+        return { seq::as_sequence(std::forward<S1>(s1)), seq::as_sequence(std::forward<S2>(s2)), std::forward<Cmp>(cmp) };
+    }
+
+    //! {function}
+    //! *Returns*: `set_intersection(s1, s2, cmp)` with `cmp` comparing by `<`.
+    template <typename S1, typename S2,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<S1>>, is_sequence<detail::SourceSequence<S2>>>...>
+    set_intersection_sequence<detail::SourceSequence<S1>, detail::SourceSequence<S2>, detail::less> set_intersection(S1&& s1, S2&& s2) {
+        return { seq::as_sequence(std::forward<S1>(s1)), seq::as_sequence(std::forward<S2>(s2)), detail::less{} };
+    }
+
+    //! {function}
+    //! *Requires*: as for `set_union`.
+    //! *Returns*: a sorted sequence of the elements of `s1` that are not in `s2`.
+    //! *Note*: as `std::set_difference`: an element found `m` times in `s1` and `n` times in `s2`
+    //!         appears `max(m - n, 0)` times. A random-access `s2` skips ahead by galloping.
+    template <typename S1, typename S2, typename Cmp,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<S1>>, is_sequence<detail::SourceSequence<S2>>>...>
+    set_difference_sequence<detail::SourceSequence<S1>, detail::SourceSequence<S2>, Cmp> set_difference(S1&& s1, S2&& s2, Cmp&& cmp) {
+        return { seq::as_sequence(std::forward<S1>(s1)), seq::as_sequence(std::forward<S2>(s2)), std::forward<Cmp>(cmp) };
+    }
+
+    //! {function}
+    //! *Returns*: `set_difference(s1, s2, cmp)` with `cmp` comparing by `<`.
+    template <typename S1, typename S2,
+              wheels::meta::EnableIf<is_sequence<detail::SourceSequence<S1>>, is_sequence<detail::SourceSequence<S2>>>...>
+    set_difference_sequence<detail::SourceSequence<S1>, detail::SourceSequence<S2>, detail::less> set_difference(S1&& s1, S2&& s2) {
+        return { seq::as_sequence(std::forward<S1>(s1)), seq::as_sequence(std::forward<S2>(s2)), detail::less{} };
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_SET_OPERATIONS_HPP
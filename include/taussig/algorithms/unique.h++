@@ -0,0 +1,208 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence unique() and rle() algorithms
+
+#ifndef TAUSSIG_ALGORITHMS_UNIQUE_HPP
+#define TAUSSIG_ALGORITHMS_UNIQUE_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/find_kernels.h++>
+#include <taussig/detail/fun_objects.h++>
+#include <taussig/detail/iterators.h++>
+
+#include <wheels/meta/all.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/is_related.h++>
+#include <wheels/meta/not.h++>
+#include <wheels/optional.h++>
+
+#include <iterator> // forward_iterator_tag
+#include <type_traits> // is_integral, is_same
+#include <utility> // forward, pair, declval
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        //! {trait}
+        //! *Returns*: `true` if the runs of `S` can be found with the contiguous kernels; `false` otherwise.
+        template <typename S,
+                  bool = is_contiguous_sequence<S>()>
+        struct is_run_scannable : wheels::meta::False {};
+        template <typename S>
+        struct is_run_scannable<S, true>
+        : wheels::meta::All<
+            std::is_integral<ValueType<S>>,
+            wheels::meta::Not<std::is_same<ValueType<S>, bool>>
+        > {};
+
+        // Walks the runs of equal consecutive elements of a sequence, comparing each element once.
+        template <typename Seq,
+                  bool = is_iterator_pair<wheels::meta::Decay<Seq>, std::forward_iterator_tag>()>
+        struct run_cursor;
+
+        // multi-pass sequences keep the current run as a slice
+        template <typename Seq>
+        struct run_cursor<Seq, true> {
+        private:
+            using seq_type = wheels::meta::Decay<Seq>;
+        public:
+            template <typename SeqF>
+            explicit run_cursor(SeqF&& s) : s(std::forward<SeqF>(s)) {
+                find_end(is_run_scannable<seq_type>{});
+            }
+
+            using reference = ReferenceType<seq_type>;
+
+            bool done() const { return s.first == s.second; }
+            reference value() const { return *s.first; }
+            std::size_t length() const { return run_length; }
+            void next() {
+                s.first = run_end;
+                find_end(is_run_scannable<seq_type>{});
+            }
+
+        private:
+            seq_type s;
+            decltype(s.first) run_end;
+            std::size_t run_length;
+
+            void find_end(wheels::meta::False) {
+                run_end = s.first;
+                run_length = 0;
+                if(run_end == s.second) return;
+                do {
+                    ++run_end;
+                    ++run_length;
+                } while(run_end != s.second && detail::equal_to{}(*run_end, *s.first));
+            }
+            void find_end(wheels::meta::True) {
+                auto const n = contiguous_size(s);
+                run_length = n == 0? 0 : find_run_end(contiguous_data(s), n, 1);
+                run_end = s.first + run_length;
+            }
+        };
+
+        // single-pass sequences keep a copy of the first element of the current run
+        template <typename Seq>
+        struct run_cursor<Seq, false> {
+        private:
+            using seq_type = wheels::meta::Decay<Seq>;
+            using value_type = ValueType<seq_type>;
+        public:
+            template <typename SeqF>
+            explicit run_cursor(SeqF&& s) : s(std::forward<SeqF>(s)) {
+                next();
+            }
+
+            using reference = value_type const&;
+
+            bool done() const { return !current; }
+            reference value() const { return *current; }
+            std::size_t length() const { return run_length; }
+            void next() {
+                if(seq::empty(s)) {
+                    current = wheels::none;
+                    return;
+                }
+                current = wheels::some(value_type(seq::front(s)));
+                run_length = 0;
+                do {
+                    seq::pop_front(s);
+                    ++run_length;
+                } while(!seq::empty(s) && detail::equal_to{}(seq::front(s), *current));
+            }
+
+        private:
+            seq_type s; // positioned after the current run
+            wheels::optional<value_type> current; // none once all runs are done
+            std::size_t run_length;
+        };
+    } // namespace detail
+
+    template <typename Seq>
+    struct unique_sequence : true_sequence {
+    private:
+        using cursor_type = detail::run_cursor<Seq>;
+    public:
+        template <typename SeqF,
+                  wheels::meta::DisableIfRelated<SeqF, unique_sequence<Seq>>...>
+        explicit unique_sequence(SeqF&& s) : runs(std::forward<SeqF>(s)) {}
+
+        using reference = typename cursor_type::reference;
+        using value_type = ValueType<wheels::meta::Decay<Seq>>;
+
+        bool empty() const { return runs.done(); }
+        void pop_front() { runs.next(); }
+        reference front() const { return runs.value(); }
+
+    private:
+        cursor_type runs;
+    };
+    static_assert(is_true_sequence<unique_sequence<fake_sequence<int>>>(), "unique_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; its elements are equality comparable [soft].
+    //! *Returns*: a sequence of the first element of each run of equal consecutive elements of `s`.
+    //! *Note*: each element is compared once; runs in contiguous sequences of integral values are
+    //!         found in blocks. Single-pass sequences are read a whole run at a time.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    unique_sequence<Seq> unique(Seq&& s) {
+        return unique_sequence<Seq>(std::forward<Seq>(s));
+    }
+
+    template <typename Seq>
+    struct rle_sequence : true_sequence {
+    private:
+        using cursor_type = detail::run_cursor<Seq>;
+    public:
+        template <typename SeqF,
+                  wheels::meta::DisableIfRelated<SeqF, rle_sequence<Seq>>...>
+        explicit rle_sequence(SeqF&& s) : runs(std::forward<SeqF>(s)) {}
+
+        using reference = std::pair<typename cursor_type::reference, std::size_t>;
+        using value_type = std::pair<ValueType<wheels::meta::Decay<Seq>>, std::size_t>;
+
+        bool empty() const { return runs.done(); }
+        void pop_front() { runs.next(); }
+        reference front() const { return reference(runs.value(), runs.length()); }
+
+    private:
+        cursor_type runs;
+    };
+    static_assert(is_true_sequence<rle_sequence<fake_sequence<int>>>(), "rle_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; its elements are equality comparable [soft].
+    //! *Returns*: a sequence of pairs of the first element of each run of equal consecutive
+    //!            elements of `s` and the length of that run.
+    //! *Note*: as for `unique`.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    rle_sequence<Seq> rle(Seq&& s) {
+        return rle_sequence<Seq>(std::forward<Seq>(s));
+    }
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_UNIQUE_HPP
@@ -0,0 +1,135 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence window() algorithm
+
+#ifndef TAUSSIG_ALGORITHMS_WINDOW_HPP
+#define TAUSSIG_ALGORITHMS_WINDOW_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/contiguous.h++>
+
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <cassert>
+#include <utility> // forward, pair, declval
+#include <vector>
+#include <cstddef> // size_t, ptrdiff_t
+
+namespace seq {
+    template <typename Seq,
+              bool = detail::is_random_access_sequence<wheels::meta::Decay<Seq>>()>
+    struct window_sequence;
+
+    // random-access sequences are sliced in place
+    template <typename Seq>
+    struct window_sequence<Seq, true> : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+    public:
+        template <typename SeqF>
+        window_sequence(SeqF&& s, std::size_t k)
+        : s(std::forward<SeqF>(s)), k(static_cast<std::ptrdiff_t>(k)) {}
+
+        using reference = seq_type;
+        using value_type = seq_type;
+
+        bool empty() const { return s.second - s.first < k; }
+        void pop_front() { ++s.first; }
+        reference front() const { return { s.first, s.first + k }; }
+
+    private:
+        seq_type s;
+        std::ptrdiff_t k;
+    };
+
+    // Other sequences go through a ring buffer of 2k slots where every element is written twice,
+    // k slots apart, so the last k elements are always contiguous: they start at the next slot
+    // to be written.
+    template <typename Seq>
+    struct window_sequence<Seq, false> : true_sequence {
+    private:
+        using seq_type = wheels::meta::Decay<Seq>;
+        using buffer_type = std::vector<ValueType<seq_type>>;
+    public:
+        template <typename SeqF>
+        window_sequence(SeqF&& s, std::size_t k)
+        : s(std::forward<SeqF>(s)), ring(2 * k), k(k) {
+            for(std::size_t i = 0; i < k; ++i) {
+                if(seq::empty(this->s)) {
+                    done = true;
+                    break;
+                }
+                push();
+            }
+        }
+
+        using reference = std::pair<typename buffer_type::const_iterator, typename buffer_type::const_iterator>;
+        using value_type = reference;
+
+        bool empty() const { return done; }
+        void pop_front() {
+            if(seq::empty(s)) done = true;
+            else push();
+        }
+        reference front() const {
+            auto const first = ring.begin() + static_cast<std::ptrdiff_t>(next);
+            return { first, first + static_cast<std::ptrdiff_t>(k) };
+        }
+
+    private:
+        seq_type s;
+        buffer_type ring;
+        std::size_t k;
+        std::size_t next = 0; // the slot the next element goes to, and the start of the window
+        bool done = false;
+
+        void push() {
+            ring[next] = seq::front(s);
+            ring[next + k] = ring[next];
+            seq::pop_front(s);
+            if(++next == k) next = 0;
+        }
+    };
+    static_assert(is_true_sequence<window_sequence<fake_sequence<int>>>(), "window_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` is a sequence [soft]; `k > 0` [undefined]; if `s` is not random-access,
+    //!             its value type is default-constructible and copy-assignable.
+    //! *Returns*: a sequence of the windows of `k` consecutive elements of `s`, each starting one
+    //!            element after the previous; it is empty if `s` has fewer than `k` elements.
+    //!            Each window is itself a contiguous or random-access sequence.
+    //! *Note*: windows of random-access sequences are slices of `s` and copy nothing. Other
+    //!         sequences are read once, into a buffer of `2k` elements allocated up front, so
+    //!         each window is only valid until the next `pop_front`.
+    template <typename Seq,
+              wheels::meta::EnableIf<is_sequence<Seq>>...>
+    window_sequence<Seq> window(Seq&& s, std::size_t k) {
+        assert(k > 0);
+        return { std::forward<Seq>(s), k };
+    }
+
+    namespace result_of {
+        template <typename Seq>
+        using window = decltype(seq::window(std::declval<Seq>(), std::size_t()));
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_WINDOW_HPP
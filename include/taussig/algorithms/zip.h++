@@ -0,0 +1,98 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Sequence zip() algorithm
+
+#ifndef TAUSSIG_ALGORITHMS_ZIP_HPP
+#define TAUSSIG_ALGORITHMS_ZIP_HPP
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/is_true_sequence.h++>
+#include <taussig/traits/true_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+#include <taussig/traits/fake_sequence.h++>
+
+#include <taussig/detail/indices.h++>
+
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+
+#include <initializer_list>
+#include <tuple>
+#include <utility> // forward, move, declval
+
+namespace seq {
+    template <typename... Seqs>
+    struct zip_sequence : true_sequence {
+    private:
+        using indices = detail::IndicesFor<sizeof...(Seqs)>;
+
+    public:
+        using sequences_type = std::tuple<wheels::meta::Decay<Seqs>...>;
+
+        explicit zip_sequence(sequences_type sequences) : seqs(std::move(sequences)) {}
+
+        using reference = std::tuple<ReferenceType<wheels::meta::Decay<Seqs>>...>;
+        using value_type = std::tuple<ValueType<wheels::meta::Decay<Seqs>>...>;
+
+        bool empty() const { return empty(indices{}); }
+        void pop_front() { pop_front(indices{}); }
+        reference front() const { return front(indices{}); }
+
+        //! {function}
+        //! *Returns*: the zipped sequences, as they are now.
+        //! *Note*: this gives columnar access, e.g. to the buffers of contiguous sequences.
+        sequences_type const& sequences() const { return seqs; }
+
+    private:
+        sequences_type seqs;
+
+        template <std::size_t... I>
+        bool empty(detail::indices<I...>) const {
+            for(bool e : { seq::empty(std::get<I>(seqs))... }) {
+                if(e) return true;
+            }
+            return false;
+        }
+        template <std::size_t... I>
+        void pop_front(detail::indices<I...>) {
+            detail::swallow { (seq::pop_front(std::get<I>(seqs)), 0)... };
+        }
+        template <std::size_t... I>
+        reference front(detail::indices<I...>) const {
+            return reference(seq::front(std::get<I>(seqs))...);
+        }
+    };
+    static_assert(is_true_sequence<zip_sequence<fake_sequence<int>, fake_sequence<char>>>(), "zip_sequence must be a true sequence");
+
+    //! {function}
+    //! *Requires*: `Seq` and all `Seqs` are sequences [soft].
+    //! *Returns*: a sequence of tuples with one element from each of the sequences, as long as the
+    //!            shortest of them.
+    //! *Note*: the tuples hold what the sequences' `front` returns, so elements of containers are
+    //!         referenced rather than copied.
+    template <typename Seq, typename... Seqs,
+              wheels::meta::EnableIf<is_sequence<Seq>, is_sequence<Seqs>...>...>
+    zip_sequence<Seq, Seqs...> zip(Seq&& s, Seqs&&... ss) {
+        return zip_sequence<Seq, Seqs...>(typename zip_sequence<Seq, Seqs...>::sequences_type(std::forward<Seq>(s), std::forward<Seqs>(ss)...));
+    }
+
+    namespace result_of {
+        template <typename... Seqs>
+        using zip = decltype(seq::zip(std::declval<Seqs>()...));
+    } // namespace result_of
+} // namespace seq
+
+#endif // TAUSSIG_ALGORITHMS_ZIP_HPP
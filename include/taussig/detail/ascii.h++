@@ -0,0 +1,146 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// ASCII classification and case folding tables and kernels
+
+#ifndef TAUSSIG_DETAIL_ASCII_HPP
+#define TAUSSIG_DETAIL_ASCII_HPP
+
+#include <taussig/detail/simd.h++>
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint32_t
+
+namespace seq {
+    namespace detail {
+        enum ascii_class : std::uint8_t {
+            ascii_alpha = 0x01,
+            ascii_digit = 0x02,
+            ascii_space = 0x04,
+            ascii_upper = 0x08,
+            ascii_lower = 0x10,
+            ascii_punct = 0x20,
+            ascii_xdigit = 0x40,
+        };
+
+        //! {class}
+        //! Lookup tables for the ASCII range; a class template so the definitions can live in a header.
+        template <typename = void>
+        struct ascii_tables {
+            static std::uint8_t const to_lower[128];
+            static std::uint8_t const to_upper[128];
+            static std::uint8_t const classes[128];
+        };
+
+        template <typename Dummy>
+        std::uint8_t const ascii_tables<Dummy>::to_lower[128] = {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+            0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+            0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+            0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+            0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+            0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+        };
+        template <typename Dummy>
+        std::uint8_t const ascii_tables<Dummy>::to_upper[128] = {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+            0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+            0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+            0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+            0x60, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+            0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+        };
+        template <typename Dummy>
+        std::uint8_t const ascii_tables<Dummy>::classes[128] = {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x04, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+            0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+            0x20, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+            0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20,
+            0x20, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x20, 0x20, 0x20, 0x00,
+        };
+
+        //! {function}
+        //! *Returns*: `c` mapped to lowercase if it is an uppercase ASCII letter; `c` otherwise.
+        template <typename Char>
+        Char ascii_fold_lower(Char c) {
+            return static_cast<std::uint32_t>(c) < 128? static_cast<Char>(ascii_tables<>::to_lower[static_cast<std::uint32_t>(c)]) : c;
+        }
+        //! {function}
+        //! *Returns*: `c` mapped to uppercase if it is a lowercase ASCII letter; `c` otherwise.
+        template <typename Char>
+        Char ascii_fold_upper(Char c) {
+            return static_cast<std::uint32_t>(c) < 128? static_cast<Char>(ascii_tables<>::to_upper[static_cast<std::uint32_t>(c)]) : c;
+        }
+        //! {function}
+        //! *Returns*: `true` if `c` is an ASCII character in any of the classes in `mask`; `false` otherwise.
+        template <typename Char>
+        bool ascii_is(Char c, std::uint8_t mask) {
+            return static_cast<std::uint32_t>(c) < 128 && (ascii_tables<>::classes[static_cast<std::uint32_t>(c)] & mask);
+        }
+
+#if defined(TAUSSIG_HAS_SSE2)
+        template <std::size_t Size>
+        struct ascii_fold_lanes {};
+        template <>
+        struct ascii_fold_lanes<1> {
+            // signed comparisons leave everything outside the ASCII range alone
+            static __m128i fold(__m128i x) {
+                __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), x));
+                return _mm_or_si128(x, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+            }
+        };
+        template <>
+        struct ascii_fold_lanes<2> {
+            static __m128i fold(__m128i x) {
+                __m128i upper = _mm_and_si128(_mm_cmpgt_epi16(x, _mm_set1_epi16('A' - 1)), _mm_cmpgt_epi16(_mm_set1_epi16('Z' + 1), x));
+                return _mm_or_si128(x, _mm_and_si128(upper, _mm_set1_epi16(0x20)));
+            }
+        };
+        template <>
+        struct ascii_fold_lanes<4> {
+            static __m128i fold(__m128i x) {
+                __m128i upper = _mm_and_si128(_mm_cmpgt_epi32(x, _mm_set1_epi32('A' - 1)), _mm_cmpgt_epi32(_mm_set1_epi32('Z' + 1), x));
+                return _mm_or_si128(x, _mm_and_si128(upper, _mm_set1_epi32(0x20)));
+            }
+        };
+#endif // TAUSSIG_HAS_SSE2
+
+        //! {function}
+        //! *Requires*: `Char` is a character type; `a` and `b` point to at least `n` elements [undefined].
+        //! *Returns*: `true` if the two buffers are equal after folding ASCII letters to lowercase;
+        //!            `false` otherwise.
+        template <typename Char>
+        bool ascii_iequal(Char const* a, Char const* b, std::size_t n) {
+            std::size_t i = 0;
+#if defined(TAUSSIG_HAS_SSE2)
+            std::size_t const step = 16 / sizeof(Char);
+            for(; n - i >= step; i += step) {
+                __m128i x = ascii_fold_lanes<sizeof(Char)>::fold(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i)));
+                __m128i y = ascii_fold_lanes<sizeof(Char)>::fold(_mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i)));
+                if(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF) return false;
+            }
+#endif
+            for(; i < n; ++i) {
+                if(ascii_fold_lower(a[i]) != ascii_fold_lower(b[i])) return false;
+            }
+            return true;
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_ASCII_HPP
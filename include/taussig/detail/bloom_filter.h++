@@ -0,0 +1,70 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Blocked Bloom filter
+
+#ifndef TAUSSIG_DETAIL_BLOOM_FILTER_HPP
+#define TAUSSIG_DETAIL_BLOOM_FILTER_HPP
+
+#include <vector>
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t, uint64_t
+
+namespace seq {
+    namespace detail {
+        //! {class}
+        //! A Bloom filter that sets all the bits of a hash in one 32-byte block.
+        //! *Note*: each of the eight 32-bit words of a block gets one bit, picked by multiplying
+        //!         the low half of the hash with a different odd constant; the high half picks the
+        //!         block. A lookup touches a single cache line, and the word loop vectorizes.
+        class blocked_bloom_filter {
+        public:
+            static constexpr std::size_t block_words = 8;
+            static constexpr std::size_t block_bytes = block_words * sizeof(std::uint32_t);
+
+            //! {function}
+            //! *Effects*: makes a filter of at most `bytes` bytes, and at least one block.
+            explicit blocked_bloom_filter(std::size_t bytes)
+            : words((bytes < block_bytes? 1 : bytes / block_bytes) * block_words) {}
+
+            //! {function}
+            //! *Requires*: `h` is a well-mixed 64-bit hash [undefined].
+            //! *Effects*: sets the bits for `h`.
+            //! *Returns*: whether any of them was not set before, i.e. `h` was certainly not inserted before.
+            bool insert(std::uint64_t h) {
+                auto const blocks = static_cast<std::uint64_t>(words.size() / block_words);
+                auto const block = words.data() + block_words * static_cast<std::size_t>(((h >> 32) * blocks) >> 32);
+                auto const key = static_cast<std::uint32_t>(h);
+                std::uint32_t missing = 0;
+                for(std::size_t i = 0; i < block_words; ++i) {
+                    auto const bit = std::uint32_t(1) << ((key * salt(i)) >> 27);
+                    missing |= ~block[i] & bit;
+                    block[i] |= bit;
+                }
+                return missing != 0;
+            }
+
+            std::size_t size_in_bytes() const { return words.size() * sizeof(std::uint32_t); }
+
+        private:
+            std::vector<std::uint32_t> words;
+
+            static std::uint32_t salt(std::size_t i) {
+                static constexpr std::uint32_t salts[block_words] = {
+                    0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du, 0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u,
+                };
+                return salts[i];
+            }
+        };
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_BLOOM_FILTER_HPP
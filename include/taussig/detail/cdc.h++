@@ -0,0 +1,79 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Gear rolling hash and content-defined cut points
+
+#ifndef TAUSSIG_DETAIL_CDC_HPP
+#define TAUSSIG_DETAIL_CDC_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+
+namespace seq {
+    namespace detail {
+        struct gear_table {
+            gear_table() {
+                // splitmix64, so the table is the same everywhere without shipping 2KiB of constants
+                std::uint64_t state = 0;
+                for(auto& g : values) {
+                    std::uint64_t z = (state += 0x9E3779B97F4A7C15u);
+                    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+                    z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+                    g = z ^ (z >> 31);
+                }
+            }
+
+            std::uint64_t values[256];
+        };
+
+        //! {function}
+        //! *Returns*: the random values the Gear hash adds for each byte.
+        inline std::uint64_t const* gear() {
+            static gear_table const table;
+            return table.values;
+        }
+
+        //! {function}
+        //! *Returns*: a mask of the `bits` highest bits, which depend on the most bytes of a Gear hash.
+        inline std::uint64_t gear_mask(unsigned bits) {
+            return bits == 0? 0 : bits >= 64? ~std::uint64_t(0) : ~std::uint64_t(0) << (64 - bits);
+        }
+
+        //! {function}
+        //! *Requires*: `p` points to at least `n` bytes [undefined]; `min <= avg <= max` [undefined].
+        //! *Returns*: the length of the chunk that starts at `p`: the position after the first
+        //!            byte past `min` where the Gear hash has all bits of the mask clear, using the
+        //!            stricter `mask_small` before `avg` and the looser `mask_large` after it, or
+        //!            `min(n, max)` if there is none.
+        //! *Note*: the first `min` bytes are skipped, since no cut can happen there.
+        template <typename Byte>
+        std::size_t cdc_cut(Byte const* p, std::size_t n, std::size_t min, std::size_t avg, std::size_t max,
+                            std::uint64_t mask_small, std::uint64_t mask_large) {
+            if(n <= min) return n;
+            if(n > max) n = max;
+            std::size_t const normal = n < avg? n : avg;
+            auto const g = gear();
+            std::uint64_t h = 0;
+            std::size_t i = min;
+            for(; i < normal; ++i) {
+                h = (h << 1) + g[static_cast<unsigned char>(p[i])];
+                if(!(h & mask_small)) return i + 1;
+            }
+            for(; i < n; ++i) {
+                h = (h << 1) + g[static_cast<unsigned char>(p[i])];
+                if(!(h & mask_large)) return i + 1;
+            }
+            return n;
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_CDC_HPP
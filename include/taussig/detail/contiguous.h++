@@ -0,0 +1,117 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Contiguous and random-access sequence traits
+
+#ifndef TAUSSIG_DETAIL_CONTIGUOUS_HPP
+#define TAUSSIG_DETAIL_CONTIGUOUS_HPP
+
+#include <taussig/detail/iterators.h++> // is_iterator, IteratorValueType
+#include <taussig/detail/characters.h++> // is_character
+
+#include <wheels/meta/all.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/unqual.h++>
+#include <wheels/meta/remove_reference.h++>
+
+#include <iterator> // random_access_iterator_tag
+#include <memory> // addressof
+#include <string> // basic_string
+#include <type_traits> // is_pointer, is_same, is_arithmetic
+#include <utility> // pair
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        template <typename I, typename V,
+                  bool = is_character<V>()>
+        struct is_string_iterator : wheels::meta::False {};
+        template <typename I, typename V>
+        struct is_string_iterator<I, V, true>
+        : wheels::meta::Bool<std::is_same<I, typename std::basic_string<V>::iterator>()
+                          || std::is_same<I, typename std::basic_string<V>::const_iterator>()> {};
+
+        template <typename I, typename V = wheels::meta::Unqual<IteratorValueType<I>>,
+                  bool = std::is_same<V, bool>()>
+        struct is_vector_iterator
+        : wheels::meta::Bool<std::is_same<I, typename std::vector<V>::iterator>()
+                          || std::is_same<I, typename std::vector<V>::const_iterator>()> {};
+        template <typename I, typename V>
+        struct is_vector_iterator<I, V, true> : wheels::meta::False {};
+
+        //! {trait}
+        //! *Returns*: `true` if `I` is known to iterate over elements stored contiguously in memory;
+        //!            `false` otherwise.
+        //! *Note*: C++11 has no way to tell, so this recognises pointers and the iterators of
+        //!         `std::vector` and `std::basic_string`.
+        template <typename I,
+                  bool = std::is_pointer<I>(),
+                  bool = is_iterator<I, std::random_access_iterator_tag>()>
+        struct is_contiguous_iterator : wheels::meta::False {};
+        template <typename I, bool R>
+        struct is_contiguous_iterator<I, true, R> : wheels::meta::True {};
+        template <typename I>
+        struct is_contiguous_iterator<I, false, true>
+        : wheels::meta::Bool<is_vector_iterator<I>()
+                          || is_string_iterator<I, wheels::meta::Unqual<IteratorValueType<I>>>()> {};
+
+        template <typename S>
+        struct is_contiguous_sequence_impl : wheels::meta::False {};
+        template <typename I>
+        struct is_contiguous_sequence_impl<std::pair<I, I>> : is_contiguous_iterator<I> {};
+
+        //! {trait}
+        //! *Returns*: `true` if `S` is a sequence whose elements are stored contiguously in memory;
+        //!            `false` otherwise.
+        template <typename S>
+        struct is_contiguous_sequence : is_contiguous_sequence_impl<wheels::meta::Unqual<S>> {};
+
+        template <typename S>
+        struct is_random_access_sequence_impl : wheels::meta::False {};
+        template <typename I>
+        struct is_random_access_sequence_impl<std::pair<I, I>> : is_iterator<I, std::random_access_iterator_tag> {};
+
+        //! {trait}
+        //! *Returns*: `true` if `S` is a sequence that supports constant time indexing and slicing;
+        //!            `false` otherwise.
+        template <typename S>
+        struct is_random_access_sequence : is_random_access_sequence_impl<wheels::meta::Unqual<S>> {};
+
+        //! {trait}
+        //! *Returns*: `true` if `S` is a contiguous sequence of arithmetic values of type `V`;
+        //!            `false` otherwise.
+        template <typename S, typename V>
+        struct is_contiguous_sequence_of
+        : wheels::meta::All<
+            is_contiguous_sequence<S>,
+            std::is_same<wheels::meta::Unqual<IteratorValueType<typename wheels::meta::Unqual<S>::first_type>>, V>
+        > {};
+
+        //! {function}
+        //! *Requires*: `p` is a contiguous sequence [hard].
+        //! *Returns*: the number of elements in `p`.
+        template <typename I>
+        std::size_t contiguous_size(std::pair<I, I> const& p) {
+            return static_cast<std::size_t>(p.second - p.first);
+        }
+
+        //! {function}
+        //! *Requires*: `p` is a contiguous sequence [hard].
+        //! *Returns*: a pointer to the first element of `p`, or a null pointer if `p` is empty.
+        template <typename I>
+        wheels::meta::RemoveReference<IteratorReferenceType<I>>* contiguous_data(std::pair<I, I> const& p) {
+            return p.first == p.second? nullptr : std::addressof(*p.first);
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_CONTIGUOUS_HPP
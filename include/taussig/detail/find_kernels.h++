@@ -0,0 +1,206 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Element search kernels for contiguous buffers
+
+#ifndef TAUSSIG_DETAIL_FIND_KERNELS_HPP
+#define TAUSSIG_DETAIL_FIND_KERNELS_HPP
+
+#include <taussig/detail/simd.h++>
+
+#include <wheels/meta/bool.h++>
+
+#include <cstddef> // size_t
+#include <cstdint> // uintN_t
+#include <cstring> // memchr, memcpy
+
+namespace seq {
+    namespace detail {
+        template <std::size_t Size>
+        struct unsigned_of_size {};
+        template <> struct unsigned_of_size<1> { using type = std::uint8_t; };
+        template <> struct unsigned_of_size<2> { using type = std::uint16_t; };
+        template <> struct unsigned_of_size<4> { using type = std::uint32_t; };
+        template <> struct unsigned_of_size<8> { using type = std::uint64_t; };
+
+        //! {function}
+        //! *Returns*: the object representation of `v` as an unsigned integer of the same size.
+        template <typename V>
+        typename unsigned_of_size<sizeof(V)>::type to_bits(V v) {
+            typename unsigned_of_size<sizeof(V)>::type bits;
+            std::memcpy(&bits, &v, sizeof(V));
+            return bits;
+        }
+
+        //! {traits}
+        //! *Note*: each lane set provides `splat` to broadcast a value to all lanes, and `match` to
+        //!         compare a block against a broadcast value, returning one mask bit per matching byte.
+        template <std::size_t Size>
+        struct sse2_lanes { static constexpr bool enabled = false; };
+        template <std::size_t Size>
+        struct avx2_lanes { static constexpr bool enabled = false; };
+
+#if defined(TAUSSIG_HAS_SSE2)
+        struct sse2_lanes_base {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t width = 16;
+            using vector = __m128i;
+            static __m128i load(void const* p) { return _mm_loadu_si128(static_cast<__m128i const*>(p)); }
+        };
+        template <>
+        struct sse2_lanes<1> : sse2_lanes_base {
+            static __m128i splat(std::uint8_t b) { return _mm_set1_epi8(static_cast<char>(b)); }
+            static std::uint32_t match(void const* p, __m128i n) { return _mm_movemask_epi8(_mm_cmpeq_epi8(load(p), n)); }
+        };
+        template <>
+        struct sse2_lanes<2> : sse2_lanes_base {
+            static __m128i splat(std::uint16_t b) { return _mm_set1_epi16(static_cast<short>(b)); }
+            static std::uint32_t match(void const* p, __m128i n) { return _mm_movemask_epi8(_mm_cmpeq_epi16(load(p), n)); }
+        };
+        template <>
+        struct sse2_lanes<4> : sse2_lanes_base {
+            static __m128i splat(std::uint32_t b) { return _mm_set1_epi32(static_cast<int>(b)); }
+            static std::uint32_t match(void const* p, __m128i n) { return _mm_movemask_epi8(_mm_cmpeq_epi32(load(p), n)); }
+        };
+#endif // TAUSSIG_HAS_SSE2
+
+#if defined(TAUSSIG_HAS_AVX2)
+        struct avx2_lanes_base {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t width = 32;
+            using vector = __m256i;
+            static __m256i load(void const* p) { return _mm256_loadu_si256(static_cast<__m256i const*>(p)); }
+        };
+        template <>
+        struct avx2_lanes<1> : avx2_lanes_base {
+            static __m256i splat(std::uint8_t b) { return _mm256_set1_epi8(static_cast<char>(b)); }
+            static std::uint32_t match(void const* p, __m256i n) { return _mm256_movemask_epi8(_mm256_cmpeq_epi8(load(p), n)); }
+        };
+        template <>
+        struct avx2_lanes<2> : avx2_lanes_base {
+            static __m256i splat(std::uint16_t b) { return _mm256_set1_epi16(static_cast<short>(b)); }
+            static std::uint32_t match(void const* p, __m256i n) { return _mm256_movemask_epi8(_mm256_cmpeq_epi16(load(p), n)); }
+        };
+        template <>
+        struct avx2_lanes<4> : avx2_lanes_base {
+            static __m256i splat(std::uint32_t b) { return _mm256_set1_epi32(static_cast<int>(b)); }
+            static std::uint32_t match(void const* p, __m256i n) { return _mm256_movemask_epi8(_mm256_cmpeq_epi32(load(p), n)); }
+        };
+        template <>
+        struct avx2_lanes<8> : avx2_lanes_base {
+            static __m256i splat(std::uint64_t b) { return _mm256_set1_epi64x(static_cast<long long>(b)); }
+            static std::uint32_t match(void const* p, __m256i n) { return _mm256_movemask_epi8(_mm256_cmpeq_epi64(load(p), n)); }
+        };
+#endif // TAUSSIG_HAS_AVX2
+
+        template <typename Lanes, typename V>
+        bool find_blocks(V const*, std::size_t, V, std::size_t&, wheels::meta::False) { return false; }
+        template <typename Lanes, typename V>
+        bool find_blocks(V const* p, std::size_t n, V v, std::size_t& i, wheels::meta::True) {
+            std::size_t const step = Lanes::width / sizeof(V);
+            auto const needle = Lanes::splat(to_bits(v));
+            for(; n - i >= step; i += step) {
+                std::uint32_t mask = Lanes::match(p + i, needle);
+                if(mask) {
+                    i += count_trailing_zeros(mask) / sizeof(V);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename Lanes, typename V>
+        std::size_t count_blocks(V const*, std::size_t, V, std::size_t&, wheels::meta::False) { return 0; }
+        template <typename Lanes, typename V>
+        std::size_t count_blocks(V const* p, std::size_t n, V v, std::size_t& i, wheels::meta::True) {
+            std::size_t const step = Lanes::width / sizeof(V);
+            auto const needle = Lanes::splat(to_bits(v));
+            std::size_t bits = 0;
+            for(; n - i >= step; i += step) {
+                bits += popcount(Lanes::match(p + i, needle));
+            }
+            // each matching element sets one mask bit per byte
+            return bits / sizeof(V);
+        }
+
+        template <typename Lanes, typename V>
+        bool boundary_blocks(V const*, std::size_t, std::size_t&, wheels::meta::False) { return false; }
+        template <typename Lanes, typename V>
+        bool boundary_blocks(V const* p, std::size_t n, std::size_t& i, wheels::meta::True) {
+            std::size_t const step = Lanes::width / sizeof(V);
+            auto const lanes = static_cast<std::uint32_t>((std::uint64_t(1) << Lanes::width) - 1);
+            // each block is compared with itself shifted back by one element
+            for(; n - i >= step; i += step) {
+                std::uint32_t mask = ~Lanes::match(p + i, Lanes::load(p + i - 1)) & lanes;
+                if(mask) {
+                    i += count_trailing_zeros(mask) / sizeof(V);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //! {function}
+        //! *Requires*: `V` is an integral type; `p` points to at least `n` elements [undefined].
+        //! *Returns*: the index of the first element equal to `v`, or `n` if there is none.
+        template <typename V>
+        std::size_t find_value(V const* p, std::size_t n, V v) {
+            if(n == 0) return 0;
+            if(sizeof(V) == 1) {
+                auto r = std::memchr(p, to_bits(v), n);
+                return r? static_cast<V const*>(r) - p : n;
+            }
+            std::size_t i = 0;
+            using avx2 = avx2_lanes<sizeof(V)>;
+            using sse2 = sse2_lanes<sizeof(V)>;
+            if(find_blocks<avx2>(p, n, v, i, wheels::meta::Bool<avx2::enabled>{})) return i;
+            if(find_blocks<sse2>(p, n, v, i, wheels::meta::Bool<sse2::enabled>{})) return i;
+            for(; i < n; ++i) {
+                if(p[i] == v) return i;
+            }
+            return n;
+        }
+
+        //! {function}
+        //! *Requires*: `V` is an integral type; `p` points to at least `n` elements; `0 < i <= n` [undefined].
+        //! *Returns*: the index of the first element from `i` on that differs from the one before
+        //!            it, or `n` if there is none.
+        template <typename V>
+        std::size_t find_run_end(V const* p, std::size_t n, std::size_t i) {
+            using avx2 = avx2_lanes<sizeof(V)>;
+            using sse2 = sse2_lanes<sizeof(V)>;
+            if(boundary_blocks<avx2>(p, n, i, wheels::meta::Bool<avx2::enabled>{})) return i;
+            if(boundary_blocks<sse2>(p, n, i, wheels::meta::Bool<sse2::enabled>{})) return i;
+            for(; i < n; ++i) {
+                if(p[i] != p[i - 1]) return i;
+            }
+            return n;
+        }
+
+        //! {function}
+        //! *Requires*: `V` is an integral type; `p` points to at least `n` elements [undefined].
+        //! *Returns*: the number of elements equal to `v`.
+        template <typename V>
+        std::size_t count_value(V const* p, std::size_t n, V v) {
+            std::size_t i = 0;
+            using avx2 = avx2_lanes<sizeof(V)>;
+            using sse2 = sse2_lanes<sizeof(V)>;
+            std::size_t c = count_blocks<avx2>(p, n, v, i, wheels::meta::Bool<avx2::enabled>{});
+            c += count_blocks<sse2>(p, n, v, i, wheels::meta::Bool<sse2::enabled>{});
+            for(; i < n; ++i) {
+                c += p[i] == v;
+            }
+            return c;
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_FIND_KERNELS_HPP
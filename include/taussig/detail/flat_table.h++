@@ -0,0 +1,190 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Open-addressing hash table with SIMD-probed control bytes
+
+#ifndef TAUSSIG_DETAIL_FLAT_TABLE_HPP
+#define TAUSSIG_DETAIL_FLAT_TABLE_HPP
+
+#include <taussig/detail/find_kernels.h++> // sse2_lanes
+#include <taussig/detail/simd.h++> // count_trailing_zeros
+
+#include <wheels/meta/bool.h++>
+
+#include <memory> // allocator
+#include <utility> // forward, move, swap, pair
+#include <vector>
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint32_t, uint64_t
+
+namespace seq {
+    namespace detail {
+        //! {function}
+        //! *Returns*: `h` with its bits mixed, so that tables can use both its low and high bits.
+        inline std::uint64_t mix_hash(std::uint64_t h) {
+            h = (h ^ (h >> 32)) * 0x9E3779B97F4A7C15u;
+            return h ^ (h >> 32);
+        }
+
+        // Each control byte is either empty or holds the low seven bits of the hash of its slot.
+        // Slots are probed a group of sixteen at a time: one SIMD compare finds the candidates for
+        // a key in a group, and another finds the empty slots. Groups are visited in triangular
+        // order, which reaches every group of a power-of-two table. There is no deletion, so the
+        // first group with an empty slot ends a probe.
+        constexpr std::size_t table_group = 16;
+        constexpr std::uint8_t empty_control = 0x80;
+
+        template <typename Lanes>
+        std::uint32_t match_group(std::uint8_t const* group, std::uint8_t b, wheels::meta::True) {
+            return Lanes::match(group, Lanes::splat(b));
+        }
+        template <typename Lanes>
+        std::uint32_t match_group(std::uint8_t const* group, std::uint8_t b, wheels::meta::False) {
+            std::uint32_t mask = 0;
+            for(std::size_t i = 0; i < table_group; ++i) {
+                mask |= std::uint32_t(group[i] == b) << i;
+            }
+            return mask;
+        }
+        inline std::uint32_t match_group(std::uint8_t const* group, std::uint8_t b) {
+            return match_group<sse2_lanes<1>>(group, b, wheels::meta::Bool<sse2_lanes<1>::enabled>{});
+        }
+
+        //! {class}
+        //! A hash table of `Slot`s identified by the keys `KeyOf` extracts from them, with no erasure.
+        //! *Note*: `Hash` hashes keys; `Eq` compares a stored key with a probed one.
+        template <typename Slot, typename KeyOf, typename Hash, typename Eq>
+        class flat_table {
+        public:
+            flat_table() = default;
+            explicit flat_table(std::size_t expected) { reserve(expected); }
+            flat_table(Hash hash, Eq eq) : hash(std::move(hash)), eq(std::move(eq)) {}
+
+            flat_table(flat_table const& that) : flat_table(that.hash, that.eq) {
+                if(that.capacity() == 0) return;
+                control.assign(that.capacity(), empty_control);
+                slots = allocator().allocate(capacity());
+                for(std::size_t i = 0; i < capacity(); ++i) {
+                    if(that.control[i] == empty_control) continue;
+                    allocator().construct(slots + i, that.slots[i]);
+                    control[i] = that.control[i];
+                    ++count;
+                }
+            }
+            flat_table& operator=(flat_table const& that) {
+                flat_table copy(that);
+                swap(copy);
+                return *this;
+            }
+            flat_table(flat_table&& that)
+            : control(std::move(that.control)), slots(that.slots), count(that.count), hash(std::move(that.hash)), eq(std::move(that.eq)) {
+                that.slots = nullptr;
+                that.count = 0;
+                that.control.clear();
+            }
+            flat_table& operator=(flat_table&& that) {
+                flat_table moved(std::move(that));
+                swap(moved);
+                return *this;
+            }
+            ~flat_table() { release(); }
+
+            void swap(flat_table& that) {
+                using std::swap;
+                swap(control, that.control);
+                swap(slots, that.slots);
+                swap(count, that.count);
+                swap(hash, that.hash);
+                swap(eq, that.eq);
+            }
+
+            std::size_t size() const { return count; }
+            std::size_t capacity() const { return control.size(); }
+
+            //! {function}
+            //! *Effects*: makes room for `n` slots without growing.
+            void reserve(std::size_t n) {
+                std::size_t c = table_group;
+                while(c * 7 / 8 < n) c *= 2;
+                if(c > capacity()) rehash(c);
+            }
+
+            //! {function}
+            //! *Requires*: `make()` returns a `Slot` whose key is equal to `key` [undefined].
+            //! *Effects*: inserts `make()` if no slot has a key equal to `key`.
+            //! *Returns*: the slot with that key, and whether it was inserted.
+            template <typename Key, typename Make>
+            std::pair<Slot*, bool> insert(Key const& key, Make&& make) {
+                return insert(key, mix_hash(hash(key)), std::forward<Make>(make));
+            }
+            template <typename Key, typename Make>
+            std::pair<Slot*, bool> insert(Key const& key, std::uint64_t mixed, Make&& make) {
+                if(count + 1 > capacity() * 7 / 8) rehash(capacity() == 0? table_group : 2 * capacity());
+                auto const h2 = static_cast<std::uint8_t>(mixed & 0x7F);
+                auto const groups = capacity() / table_group;
+                auto g = static_cast<std::size_t>(mixed >> 7) & (groups - 1);
+                for(std::size_t step = 1;; g = (g + step++) & (groups - 1)) {
+                    auto const group = control.data() + g * table_group;
+                    for(auto mask = match_group(group, h2); mask; mask &= mask - 1) {
+                        auto const i = g * table_group + count_trailing_zeros(mask);
+                        if(eq(KeyOf{}(slots[i]), key)) return { slots + i, false };
+                    }
+                    if(auto empties = match_group(group, empty_control)) {
+                        auto const i = g * table_group + count_trailing_zeros(empties);
+                        allocator().construct(slots + i, std::forward<Make>(make)());
+                        control[i] = h2;
+                        ++count;
+                        return { slots + i, true };
+                    }
+                }
+            }
+
+            //! {function}
+            //! *Effects*: calls `f` with each slot, in no particular order.
+            template <typename F>
+            void for_each(F&& f) {
+                for(std::size_t i = 0; i < capacity(); ++i) {
+                    if(control[i] != empty_control) f(slots[i]);
+                }
+            }
+
+        private:
+            std::vector<std::uint8_t> control;
+            Slot* slots = nullptr;
+            std::size_t count = 0;
+            Hash hash;
+            Eq eq;
+
+            static std::allocator<Slot> allocator() { return {}; }
+
+            void release() {
+                for(std::size_t i = 0; i < capacity(); ++i) {
+                    if(control[i] != empty_control) allocator().destroy(slots + i);
+                }
+                if(slots) allocator().deallocate(slots, capacity());
+            }
+
+            void rehash(std::size_t c) {
+                flat_table bigger(hash, eq);
+                bigger.control.assign(c, empty_control);
+                bigger.slots = allocator().allocate(c);
+                for(std::size_t i = 0; i < capacity(); ++i) {
+                    if(control[i] == empty_control) continue;
+                    auto& slot = slots[i];
+                    bigger.insert(KeyOf{}(slot), mix_hash(hash(KeyOf{}(slot))), [&slot]() -> Slot&& { return std::move(slot); });
+                }
+                swap(bigger);
+            }
+        };
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_FLAT_TABLE_HPP
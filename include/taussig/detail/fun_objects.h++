@@ -21,6 +21,13 @@
 
 namespace seq {
     namespace detail {
+        struct identity {
+            template <typename T>
+            T&& operator()(T&& t) const {
+                return std::forward<T>(t);
+            }
+        };
+
         struct equal_to {
             template <typename T, typename U>
             bool operator()(T&& t, U&& u) const {
@@ -28,6 +35,23 @@ namespace seq {
             }
         };
 
+        struct less {
+            template <typename T, typename U>
+            bool operator()(T&& t, U&& u) const {
+                return std::forward<T>(t) < std::forward<U>(u);
+            }
+        };
+
+        template <typename Pred>
+        struct negation {
+            template <typename... T>
+            bool operator()(T&&... t) {
+                return !pred(std::forward<T>(t)...);
+            }
+
+            Pred pred;
+        };
+
         struct predicate_test {
             template <typename T, typename... Args>
             std::is_convertible<decltype(std::declval<T>()(std::declval<Args>()...)), bool> static test(int);
@@ -0,0 +1,44 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Compile-time index lists
+
+#ifndef TAUSSIG_DETAIL_INDICES_HPP
+#define TAUSSIG_DETAIL_INDICES_HPP
+
+#include <wheels/meta/invoke.h++>
+
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        template <std::size_t... I>
+        struct indices { using type = indices; };
+
+        template <std::size_t N, std::size_t... I>
+        struct build_indices : build_indices<N - 1, N - 1, I...> {};
+        template <std::size_t... I>
+        struct build_indices<0, I...> : indices<I...> {};
+
+        //! {metafunction}
+        //! *Returns*: `indices<0, 1, ..., N-1>`.
+        template <std::size_t N>
+        using IndicesFor = wheels::meta::Invoke<build_indices<N>>;
+
+        // expands a pack of expressions in order, for their side effects
+        struct swallow {
+            template <typename... T>
+            swallow(T&&...) {}
+        };
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_INDICES_HPP
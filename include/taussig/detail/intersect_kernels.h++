@@ -0,0 +1,62 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Block intersection kernel for sorted integer buffers
+
+#ifndef TAUSSIG_DETAIL_INTERSECT_KERNELS_HPP
+#define TAUSSIG_DETAIL_INTERSECT_KERNELS_HPP
+
+#include <taussig/detail/simd.h++>
+
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t
+
+namespace seq {
+    namespace detail {
+        //! {function}
+        //! *Requires*: `a[0..na)` and `b[0..nb)` are sorted [undefined]; `i <= na` and `j <= nb` [undefined].
+        //! *Effects*: advances `i` and `j` four elements at a time past blocks that have no elements in
+        //!            common. Stops on the first common element of `a[i..na)` and `b[j..nb)`, or once
+        //!            fewer than four elements are left in either.
+        //! *Note*: each step compares all sixteen pairs of a block of `a` and a block of `b`, and then
+        //!         skips the block with the smaller last element; they can only be equal if the blocks
+        //!         have an element in common. Without SIMD support this does nothing.
+        inline void skip_disjoint_blocks(std::uint32_t const* a, std::size_t na, std::size_t& i,
+                                         std::uint32_t const* b, std::size_t nb, std::size_t& j) {
+#if defined(TAUSSIG_HAS_SSE2)
+            while(i + 4 <= na && j + 4 <= nb) {
+                auto const va = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i));
+                auto const vb = _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + j));
+                auto const matches = _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi32(va, vb),
+                                     _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+                        _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                                     _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+                auto const mask = static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(matches)));
+                if(mask) {
+                    i += count_trailing_zeros(mask);
+                    auto const found = _mm_cmpeq_epi32(vb, _mm_set1_epi32(static_cast<int>(a[i])));
+                    j += count_trailing_zeros(static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(found))));
+                    return;
+                }
+                auto const a_last = a[i + 3];
+                auto const b_last = b[j + 3];
+                i += 4 * (a_last < b_last);
+                j += 4 * (b_last < a_last);
+            }
+#else
+            (void)a; (void)na; (void)i; (void)b; (void)nb; (void)j;
+#endif
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_INTERSECT_KERNELS_HPP
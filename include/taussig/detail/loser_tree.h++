@@ -0,0 +1,74 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tournament tree of losers for k-way merges
+
+#ifndef TAUSSIG_DETAIL_LOSER_TREE_HPP
+#define TAUSSIG_DETAIL_LOSER_TREE_HPP
+
+#include <utility> // swap
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        //! {class}
+        //! Picks the least of `k` sources, replaying only the matches of the source that changed.
+        //! *Note*: sources are identified by index; the functions take `less(i, j)`, which says
+        //!         whether source `i` currently goes before source `j`. It must place exhausted
+        //!         sources after all others, so the winner is only exhausted once all are.
+        //!         Each internal node keeps the loser of the match played there, and node zero
+        //!         keeps the overall winner; after the winner changes, it plays one match per
+        //!         level on its way back to the root, against losers that are already known.
+        class loser_tree {
+        public:
+            //! {function}
+            //! *Requires*: `k > 0` [undefined].
+            //! *Effects*: plays the whole tournament between sources `0` to `k - 1`.
+            template <typename Less>
+            void build(std::size_t k, Less&& less) {
+                nodes.assign(k, 0);
+                nodes[0] = play(1, less);
+            }
+
+            //! {function}
+            //! *Returns*: the index of the source that goes first.
+            std::size_t winner() const { return nodes[0]; }
+
+            //! {function}
+            //! *Effects*: restores the tournament after the winner changed.
+            template <typename Less>
+            void replay(Less&& less) {
+                auto w = nodes[0];
+                for(auto node = (w + nodes.size()) / 2; node > 0; node /= 2) {
+                    if(less(nodes[node], w)) std::swap(nodes[node], w);
+                }
+                nodes[0] = w;
+            }
+
+        private:
+            // leaves are the positions k to 2k - 1 of an implicit complete binary tree
+            std::vector<std::size_t> nodes;
+
+            template <typename Less>
+            std::size_t play(std::size_t node, Less& less) {
+                if(node >= nodes.size()) return node - nodes.size();
+                auto a = play(2 * node, less);
+                auto b = play(2 * node + 1, less);
+                if(less(b, a)) std::swap(a, b);
+                nodes[node] = b;
+                return a;
+            }
+        };
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_LOSER_TREE_HPP
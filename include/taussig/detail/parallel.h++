@@ -0,0 +1,72 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Parallel execution policy and chunked work distribution
+
+#ifndef TAUSSIG_DETAIL_PARALLEL_HPP
+#define TAUSSIG_DETAIL_PARALLEL_HPP
+
+#include <algorithm> // min, max
+#include <cstddef> // size_t
+#include <future> // async, future
+#include <thread> // hardware_concurrency
+#include <utility> // move
+#include <vector>
+
+namespace seq {
+    //! {class}
+    //! Requests that an algorithm spreads its work over several threads.
+    //! *Note*: `threads` is the most threads to use, or zero for one per hardware thread; `grain`
+    //!         is the fewest elements worth giving a thread of their own.
+    struct parallel_policy {
+        unsigned threads;
+        std::size_t grain;
+    };
+
+    //! {tag}
+    //! The default parallel policy.
+    constexpr parallel_policy parallel { 0, 1 << 14 };
+
+    namespace detail {
+        //! {function}
+        //! *Returns*: how many chunks `n` elements should be split into under `policy`; at least one.
+        inline std::size_t chunk_count(parallel_policy policy, std::size_t n) {
+            std::size_t threads = policy.threads? policy.threads : std::thread::hardware_concurrency();
+            std::size_t const by_grain = policy.grain? n / policy.grain : n;
+            return std::max<std::size_t>(1, std::min(std::max<std::size_t>(threads, 1), by_grain));
+        }
+
+        //! {function}
+        //! *Effects*: calls `f(i, first, last)` for each of `chunks` consecutive slices `[first, last)` of
+        //!            `[0, n)`, the last one on the calling thread and the others on their own threads.
+        //! *Returns*: the results of the calls, in slice order.
+        //! *Throws*: an exception thrown by one of the calls, once all of them have finished.
+        template <typename F>
+        auto for_each_chunk(std::size_t n, std::size_t chunks, F f) -> std::vector<decltype(f(0, 0, 0))> {
+            using result = decltype(f(0, 0, 0));
+            auto bound = [n, chunks](std::size_t i) { return n / chunks * i + std::min(i, n % chunks); };
+            std::vector<std::future<result>> pending;
+            pending.reserve(chunks - 1);
+            for(std::size_t i = 0; i + 1 < chunks; ++i) {
+                pending.push_back(std::async(std::launch::async, f, i, bound(i), bound(i + 1)));
+            }
+            std::vector<result> results;
+            results.reserve(chunks);
+            // if this throws, destroying the futures still waits for the other threads
+            auto last = f(chunks - 1, bound(chunks - 1), n);
+            for(auto& p : pending) results.push_back(p.get());
+            results.push_back(std::move(last));
+            return results;
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_PARALLEL_HPP
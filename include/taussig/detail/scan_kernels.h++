@@ -0,0 +1,140 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Prefix sum kernels for contiguous buffers
+
+#ifndef TAUSSIG_DETAIL_SCAN_KERNELS_HPP
+#define TAUSSIG_DETAIL_SCAN_KERNELS_HPP
+
+#include <taussig/detail/find_kernels.h++> // to_bits, unsigned_of_size
+#include <taussig/detail/simd.h++>
+
+#include <wheels/meta/bool.h++>
+
+#include <cstddef> // size_t
+#include <cstdint> // uintN_t
+#include <cstring> // memcpy
+
+namespace seq {
+    namespace detail {
+        // In-register prefix sums: each step adds the block to itself shifted by a growing number
+        // of lanes, so after log2(lanes) steps every lane holds the sum of the lanes up to it.
+        // The last lane is then broadcast as the carry into the next block.
+        // Exclusive sums subtract the original block from the inclusive ones.
+
+        template <std::size_t Size>
+        struct sse2_scan_lanes { static constexpr bool enabled = false; };
+        template <std::size_t Size>
+        struct avx2_scan_lanes { static constexpr bool enabled = false; };
+
+#if defined(TAUSSIG_HAS_SSE2)
+        struct sse2_scan_lanes_base {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t width = 16;
+            using vector = __m128i;
+            static __m128i load(void const* p) { return _mm_loadu_si128(static_cast<__m128i const*>(p)); }
+            static void store(void* p, __m128i x) { _mm_storeu_si128(static_cast<__m128i*>(p), x); }
+        };
+        template <>
+        struct sse2_scan_lanes<4> : sse2_scan_lanes_base {
+            static __m128i splat(std::uint32_t b) { return _mm_set1_epi32(static_cast<int>(b)); }
+            static __m128i add(__m128i a, __m128i b) { return _mm_add_epi32(a, b); }
+            static __m128i sub(__m128i a, __m128i b) { return _mm_sub_epi32(a, b); }
+            static __m128i prefix(__m128i x) {
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+                return _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            }
+            static __m128i last(__m128i x) { return _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3)); }
+            static std::uint32_t first(__m128i x) { return static_cast<std::uint32_t>(_mm_cvtsi128_si32(x)); }
+        };
+        template <>
+        struct sse2_scan_lanes<8> : sse2_scan_lanes_base {
+            static __m128i splat(std::uint64_t b) {
+                return _mm_set_epi32(static_cast<int>(b >> 32), static_cast<int>(b), static_cast<int>(b >> 32), static_cast<int>(b));
+            }
+            static __m128i add(__m128i a, __m128i b) { return _mm_add_epi64(a, b); }
+            static __m128i sub(__m128i a, __m128i b) { return _mm_sub_epi64(a, b); }
+            static __m128i prefix(__m128i x) { return _mm_add_epi64(x, _mm_slli_si128(x, 8)); }
+            static __m128i last(__m128i x) { return _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 2, 3, 2)); }
+            static std::uint64_t first(__m128i x) {
+                std::uint64_t bits;
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(&bits), x);
+                return bits;
+            }
+        };
+#endif // TAUSSIG_HAS_SSE2
+
+#if defined(TAUSSIG_HAS_AVX2)
+        template <>
+        struct avx2_scan_lanes<4> {
+            static constexpr bool enabled = true;
+            static constexpr std::size_t width = 32;
+            using vector = __m256i;
+            static __m256i load(void const* p) { return _mm256_loadu_si256(static_cast<__m256i const*>(p)); }
+            static void store(void* p, __m256i x) { _mm256_storeu_si256(static_cast<__m256i*>(p), x); }
+            static __m256i splat(std::uint32_t b) { return _mm256_set1_epi32(static_cast<int>(b)); }
+            static __m256i add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+            static __m256i sub(__m256i a, __m256i b) { return _mm256_sub_epi32(a, b); }
+            static __m256i prefix(__m256i x) {
+                // the shifts stay within each 128-bit half, so the low half's total is added to the high half last
+                x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+                x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+                auto const low_total = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+                return _mm256_add_epi32(x, _mm256_permute2x128_si256(low_total, low_total, 0x08));
+            }
+            static __m256i last(__m256i x) { return _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7)); }
+            static std::uint32_t first(__m256i x) { return static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm256_castsi256_si128(x))); }
+        };
+#endif // TAUSSIG_HAS_AVX2
+
+        template <typename Lanes, bool Inclusive, typename V>
+        V prefix_sum_blocks(V const*, V*, std::size_t, V carry, std::size_t&, wheels::meta::False) { return carry; }
+        template <typename Lanes, bool Inclusive, typename V>
+        V prefix_sum_blocks(V const* in, V* out, std::size_t n, V carry, std::size_t& i, wheels::meta::True) {
+            std::size_t const step = Lanes::width / sizeof(V);
+            auto sum = Lanes::splat(to_bits(carry));
+            for(; n - i >= step; i += step) {
+                auto const x = Lanes::load(in + i);
+                sum = Lanes::add(Lanes::prefix(x), sum);
+                Lanes::store(out + i, Inclusive? sum : Lanes::sub(sum, x));
+                sum = Lanes::last(sum);
+            }
+            auto const bits = Lanes::first(sum);
+            std::memcpy(&carry, &bits, sizeof(V));
+            return carry;
+        }
+
+        //! {function}
+        //! *Requires*: `V` is an integral type; `in` and `out` point to at least `n` elements, and are
+        //!             either equal or do not overlap [undefined].
+        //! *Effects*: writes to each `out[i]` the sum of `carry` and the elements of `in` before `i`,
+        //!            including `in[i]` itself if `Inclusive`.
+        //! *Returns*: the sum of `carry` and all elements of `in`.
+        //! *Note*: the sums wrap around like unsigned arithmetic.
+        template <bool Inclusive, typename V>
+        V prefix_sum(V const* in, V* out, std::size_t n, V carry) {
+            using bits = typename unsigned_of_size<sizeof(V)>::type;
+            std::size_t i = 0;
+            using avx2 = avx2_scan_lanes<sizeof(V)>;
+            using sse2 = sse2_scan_lanes<sizeof(V)>;
+            carry = prefix_sum_blocks<avx2, Inclusive>(in, out, n, carry, i, wheels::meta::Bool<avx2::enabled>{});
+            carry = prefix_sum_blocks<sse2, Inclusive>(in, out, n, carry, i, wheels::meta::Bool<sse2::enabled>{});
+            for(; i < n; ++i) {
+                auto const next = static_cast<V>(static_cast<bits>(carry) + static_cast<bits>(in[i]));
+                out[i] = Inclusive? next : carry;
+                carry = next;
+            }
+            return carry;
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_SCAN_KERNELS_HPP
@@ -0,0 +1,153 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Substring search kernels
+
+#ifndef TAUSSIG_DETAIL_SEARCH_KERNELS_HPP
+#define TAUSSIG_DETAIL_SEARCH_KERNELS_HPP
+
+#include <taussig/detail/find_kernels.h++>
+#include <taussig/detail/fun_objects.h++>
+#include <taussig/detail/simd.h++>
+
+#include <wheels/meta/bool.h++>
+
+#include <algorithm> // equal, max
+#include <type_traits> // conditional
+#include <cstddef> // size_t, ptrdiff_t
+#include <cstdint> // uint32_t
+#include <cstring> // memcmp
+
+namespace seq {
+    namespace detail {
+        //! {function}
+        //! *Requires*: `H` and `N` are random-access iterators; the values in `[nfirst, nlast)` are totally ordered.
+        //! *Returns*: an iterator to the first occurrence of `[nfirst, nlast)` in `[first, last)`, or `last` if there is none.
+        //! *Complexity*: linear in both lengths, with constant extra space (Crochemore-Perrin Two-Way).
+        template <typename H, typename N>
+        H two_way_search(H first, H last, N nfirst, N nlast) {
+            using diff = std::ptrdiff_t;
+            diff const l = nlast - nfirst;
+            if(l == 0) return first;
+
+            // critical factorization: maximal suffixes under both orderings
+            diff ip = -1, jp = 0, k = 1, p = 1;
+            while(jp + k < l) {
+                if(nfirst[ip + k] == nfirst[jp + k]) {
+                    if(k == p) {
+                        jp += p;
+                        k = 1;
+                    } else ++k;
+                } else if(nfirst[jp + k] < nfirst[ip + k]) {
+                    jp += k;
+                    k = 1;
+                    p = jp - ip;
+                } else {
+                    ip = jp++;
+                    k = p = 1;
+                }
+            }
+            diff ms = ip;
+            diff const p0 = p;
+
+            ip = -1; jp = 0; k = p = 1;
+            while(jp + k < l) {
+                if(nfirst[ip + k] == nfirst[jp + k]) {
+                    if(k == p) {
+                        jp += p;
+                        k = 1;
+                    } else ++k;
+                } else if(nfirst[ip + k] < nfirst[jp + k]) {
+                    jp += k;
+                    k = 1;
+                    p = jp - ip;
+                } else {
+                    ip = jp++;
+                    k = p = 1;
+                }
+            }
+            if(ip + 1 > ms + 1) ms = ip;
+            else p = p0;
+
+            // periodic needles remember how much of the left half is already known to match
+            diff mem0;
+            if(!std::equal(nfirst, nfirst + ms + 1, nfirst + p)) {
+                mem0 = 0;
+                p = std::max(ms, l - ms - 1) + 1;
+            } else {
+                mem0 = l - p;
+            }
+
+            diff mem = 0;
+            H h = first;
+            while(last - h >= l) {
+                for(k = std::max(ms + 1, mem); k < l && detail::equal_to{}(h[k], nfirst[k]); ++k) {}
+                if(k < l) {
+                    h += k - ms;
+                    mem = 0;
+                    continue;
+                }
+                for(k = ms + 1; k > mem && detail::equal_to{}(h[k - 1], nfirst[k - 1]); --k) {}
+                if(k <= mem) return h;
+                h += p;
+                mem = mem0;
+            }
+            return last;
+        }
+
+        template <typename Lanes, typename V>
+        bool search_blocks(V const*, std::size_t, V const*, std::size_t, std::size_t&, wheels::meta::False) { return false; }
+        template <typename Lanes, typename V>
+        bool search_blocks(V const* h, std::size_t n, V const* needle, std::size_t m, std::size_t& i, wheels::meta::True) {
+            std::size_t const step = Lanes::width / sizeof(V);
+            std::uint32_t const group = (1u << sizeof(V)) - 1;
+            auto const first = Lanes::splat(to_bits(needle[0]));
+            auto const last = Lanes::splat(to_bits(needle[m - 1]));
+            std::size_t work = 0;
+            for(; n - i >= m - 1 + step; i += step) {
+                // degenerate inputs with many false candidates: let the caller switch to Two-Way
+                if(work > 8 * i + 4096) return false;
+                std::uint32_t mask = Lanes::match(h + i, first) & Lanes::match(h + i + m - 1, last);
+                while(mask) {
+                    std::size_t const k = count_trailing_zeros(mask) / sizeof(V);
+                    if(std::memcmp(h + i + k + 1, needle + 1, (m - 2) * sizeof(V)) == 0) {
+                        i += k;
+                        return true;
+                    }
+                    work += m;
+                    mask &= ~(group << (k * sizeof(V)));
+                }
+            }
+            return false;
+        }
+
+        //! {function}
+        //! *Requires*: `V` is an integral type; `h` points to at least `n` elements and `needle` to at least `m` [undefined].
+        //! *Returns*: the index of the first occurrence of `needle` in `h`, or `n` if there is none.
+        //! *Note*: uses a vectorised first/last element filter and verifies candidates with `memcmp`,
+        //!         falling back to Two-Way when the filter lets through too many candidates.
+        template <typename V>
+        std::size_t search_values(V const* h, std::size_t n, V const* needle, std::size_t m) {
+            if(m == 0) return 0;
+            if(m > n) return n;
+            if(m == 1) return find_value(h, n, needle[0]);
+
+            std::size_t i = 0;
+            using avx2 = avx2_lanes<sizeof(V)>;
+            using sse2 = sse2_lanes<sizeof(V)>;
+            using lanes = typename std::conditional<avx2::enabled, avx2, sse2>::type;
+            if(search_blocks<lanes>(h, n, needle, m, i, wheels::meta::Bool<lanes::enabled>{})) return i;
+            return i + (two_way_search(h + i, h + n, needle, needle + m) - (h + i));
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_SEARCH_KERNELS_HPP
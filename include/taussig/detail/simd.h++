@@ -0,0 +1,81 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// SIMD configuration and bit manipulation helpers
+
+#ifndef TAUSSIG_DETAIL_SIMD_HPP
+#define TAUSSIG_DETAIL_SIMD_HPP
+
+// Define TAUSSIG_NO_SIMD to force the scalar implementations everywhere.
+#if !defined(TAUSSIG_NO_SIMD)
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define TAUSSIG_HAS_SSE2 1
+#   endif
+#   if defined(__AVX2__)
+#       define TAUSSIG_HAS_AVX2 1
+#   endif
+#endif
+
+#if defined(TAUSSIG_HAS_SSE2)
+#   include <emmintrin.h>
+#endif
+#if defined(TAUSSIG_HAS_AVX2)
+#   include <immintrin.h>
+#endif
+
+#include <cstdint> // uint32_t, uint64_t
+
+namespace seq {
+    namespace detail {
+        //! {function}
+        //! *Returns*: the number of bits set in `x`.
+        inline int popcount(std::uint32_t x) {
+#if defined(__GNUC__)
+            return __builtin_popcount(x);
+#else
+            x = x - ((x >> 1) & 0x55555555u);
+            x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+            return static_cast<int>((((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#endif
+        }
+
+        //! {function}
+        //! *Requires*: `x != 0` [undefined].
+        //! *Returns*: the index of the lowest bit set in `x`.
+        inline int count_trailing_zeros(std::uint32_t x) {
+#if defined(__GNUC__)
+            return __builtin_ctz(x);
+#else
+            int n = 0;
+            while(!(x & 1u)) {
+                x >>= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
+
+        //! {function}
+        //! *Requires*: `x != 0` [undefined].
+        //! *Returns*: the index of the highest bit set in `x`.
+        inline int highest_bit(std::uint32_t x) {
+#if defined(__GNUC__)
+            return 31 - __builtin_clz(x);
+#else
+            int n = 0;
+            while(x >>= 1) ++n;
+            return n;
+#endif
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_SIMD_HPP
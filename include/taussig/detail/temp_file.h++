@@ -0,0 +1,102 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Anonymous temporary files
+
+#ifndef TAUSSIG_DETAIL_TEMP_FILE_HPP
+#define TAUSSIG_DETAIL_TEMP_FILE_HPP
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <stdlib.h> // mkstemp
+#   include <unistd.h> // unlink, close
+#   include <sys/types.h> // off_t
+#   define TAUSSIG_HAS_MKSTEMP 1
+#endif
+
+#include <cerrno>
+#include <cstdint> // uint64_t
+#include <cstdio> // FILE, tmpfile, fclose, fdopen, fseek
+#include <limits>
+#include <memory> // shared_ptr
+#include <string>
+#include <system_error> // system_error, generic_category
+
+namespace seq {
+    namespace detail {
+        using file_handle = std::shared_ptr<std::FILE>;
+
+        //! {function}
+        //! *Throws*: `std::system_error` with the current `errno`, or `EIO` if it is not set.
+        [[noreturn]] inline void throw_io_error(char const* what) {
+            throw std::system_error(errno? errno : EIO, std::generic_category(), what);
+        }
+
+        //! {function}
+        //! *Effects*: moves the position of `f` to `offset` bytes from its start.
+        //! *Returns*: `true` on success; `false` otherwise, with `errno` set to `EOVERFLOW` if the
+        //!            platform cannot seek that far.
+        //! *Note*: uses 64-bit file offsets where the platform has them, so offsets past 2GB work
+        //!         even where `long` has 32 bits.
+        inline bool seek_file(std::FILE* f, std::uint64_t offset) {
+#if defined(_MSC_VER)
+            using offset_type = __int64;
+#elif defined(TAUSSIG_HAS_MKSTEMP)
+            using offset_type = ::off_t;
+#else
+            using offset_type = long;
+#endif
+            if(offset > static_cast<std::uint64_t>(std::numeric_limits<offset_type>::max())) {
+                errno = EOVERFLOW;
+                return false;
+            }
+#if defined(_MSC_VER)
+            return ::_fseeki64(f, static_cast<offset_type>(offset), SEEK_SET) == 0;
+#elif defined(TAUSSIG_HAS_MKSTEMP)
+            return ::fseeko(f, static_cast<offset_type>(offset), SEEK_SET) == 0;
+#else
+            return std::fseek(f, static_cast<offset_type>(offset), SEEK_SET) == 0;
+#endif
+        }
+
+        //! {function}
+        //! *Returns*: a new empty file open for binary reading and writing, that is removed once
+        //!            the last handle to it is gone.
+        //! *Note*: the file is created in `dir`, or where `std::tmpfile` puts files if `dir` is empty
+        //!         or the platform has no `mkstemp`.
+        //! *Throws*: `std::system_error` if the file cannot be created.
+        inline file_handle make_temp_file(std::string const& dir) {
+            std::FILE* f = nullptr;
+#if defined(TAUSSIG_HAS_MKSTEMP)
+            if(!dir.empty()) {
+                std::string path = dir + "/taussig-XXXXXX";
+                int fd = ::mkstemp(&path[0]);
+                if(fd != -1) {
+                    // the name is not needed: the file lives on until it is closed
+                    ::unlink(path.c_str());
+                    f = ::fdopen(fd, "w+b");
+                    if(!f) {
+                        auto error = errno;
+                        ::close(fd);
+                        errno = error;
+                    }
+                }
+            } else f = std::tmpfile();
+#else
+            (void)dir;
+            f = std::tmpfile();
+#endif
+            if(!f) throw_io_error("cannot create a temporary file");
+            return file_handle(f, [](std::FILE* f) { std::fclose(f); });
+        }
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_TEMP_FILE_HPP
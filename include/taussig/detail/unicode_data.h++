@@ -0,0 +1,98 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Unicode normalization properties
+
+#ifndef TAUSSIG_DETAIL_UNICODE_DATA_HPP
+#define TAUSSIG_DETAIL_UNICODE_DATA_HPP
+
+#include <algorithm> // lower_bound
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint16_t
+
+namespace seq {
+    namespace detail {
+        namespace ucd {
+            //! {class}
+            //! Normalization properties shared by a group of code points.
+            struct record {
+                std::uint16_t decomposition; // offset into `decompositions`
+                std::uint16_t composition; // offset into `compositions`
+                std::uint8_t combining_class;
+                std::uint8_t flags;
+                std::uint8_t decomposition_length; // full canonical decomposition
+                std::uint8_t composition_count; // pairs starting with this code point
+            };
+
+            //! {class}
+            //! A primary composite, keyed by the second code point of its canonical decomposition.
+            struct composition {
+                char32_t second;
+                char32_t composite;
+            };
+
+            enum : std::uint8_t {
+                nfc_no = 1,
+                nfc_maybe = 2,
+                nfd_no = 4,
+                nfd_boundary = 8, // starter whose decomposition also begins with a starter
+            };
+
+            // Two-level table: stage1[cp >> block_shift] selects a block in stage2,
+            // which maps the low bits to an index into records.
+            // Defined in src/unicode_data.c++, generated by tools/gen_unicode_data.py.
+            constexpr int block_shift = 7;
+            extern std::uint16_t const stage1[];
+            extern std::uint16_t const stage2[];
+            extern record const records[];
+            extern char32_t const decompositions[];
+            extern composition const compositions[];
+
+            constexpr char32_t max_code_point = 0x10FFFF;
+
+            //! {function}
+            //! *Returns*: the normalization properties of the code point `u`.
+            inline record const& lookup(char32_t u) {
+                if(u > max_code_point) u = 0xFFFF; // treat invalid values like unassigned noncharacters
+                auto const block = stage1[u >> block_shift];
+                return records[stage2[(static_cast<std::size_t>(block) << block_shift) | (u & ((1u << block_shift) - 1))]];
+            }
+
+            namespace hangul {
+                constexpr char32_t s_base = 0xAC00, l_base = 0x1100, v_base = 0x1161, t_base = 0x11A7;
+                constexpr char32_t l_count = 19, v_count = 21, t_count = 28;
+                constexpr char32_t n_count = v_count * t_count, s_count = l_count * n_count;
+
+                inline bool is_syllable(char32_t u) { return u - s_base < s_count; }
+            } // namespace hangul
+
+            //! {function}
+            //! *Returns*: the primary composite of `first` and `second`, or `0` if there is none.
+            inline char32_t compose(char32_t first, char32_t second) {
+                using namespace hangul;
+                if(first - l_base < l_count && second - v_base < v_count) {
+                    return s_base + ((first - l_base) * v_count + (second - v_base)) * t_count;
+                }
+                if(is_syllable(first) && (first - s_base) % t_count == 0 && second - t_base - 1 < t_count - 1) {
+                    return first + (second - t_base);
+                }
+                auto const& r = lookup(first);
+                auto const begin = compositions + r.composition;
+                auto const end = begin + r.composition_count;
+                auto it = std::lower_bound(begin, end, second,
+                                           [](composition const& c, char32_t s) { return c.second < s; });
+                return it != end && it->second == second? it->composite : 0;
+            }
+        } // namespace ucd
+    } // namespace detail
+} // namespace seq
+
+#endif // TAUSSIG_DETAIL_UNICODE_DATA_HPP
@@ -16,5 +16,6 @@
 
 #include <taussig/interop/begin_end.h++>
 #include <taussig/interop/materialize.h++>
+#include <taussig/interop/materialize_soa.h++>
 
 #endif // TAUSSIG_INTEROP_HPP
@@ -19,12 +19,28 @@
 
 #include <taussig/interop/begin_end.h++>
 
+#include <taussig/detail/contiguous.h++>
+
+#include <wheels/meta/bool.h++>
 #include <wheels/meta/enable_if.h++>
 #include <wheels/meta/is_deduced.h++>
 
 #include <utility> // forward
 
 namespace seq {
+    namespace detail {
+        template <typename C, typename S>
+        C materialize_from(S&& s, wheels::meta::False) {
+            // asymmetry in forward because end doesn't use the argument, and only begin owns it
+            return C(seq::begin(std::forward<S>(s)), seq::end(s));
+        }
+        template <typename C, typename S>
+        C materialize_from(S&& s, wheels::meta::True) {
+            // the underlying iterators let the container allocate once for the known size
+            return C(s.first, s.second);
+        }
+    } // namespace detail
+
     //! {function}
     //! *Requires*: `S` is a sequence [soft];
     //!             `C` is a container.
@@ -33,8 +49,7 @@ namespace seq {
               typename S,
               wheels::meta::EnableIf<is_sequence<S>>...>
     C materialize(S&& s) {
-        // asymmetry in forward because end doesn't use the argument, and only begin owns it
-        return C(seq::begin(std::forward<S>(s)), seq::end(s));
+        return detail::materialize_from<C>(std::forward<S>(s), detail::is_random_access_sequence<S>{});
     }
 
     //! {function}
@@ -0,0 +1,93 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Materialization of sequences of tuples into one container per column
+
+#ifndef TAUSSIG_INTEROP_MATERIALIZE_SOA_HPP
+#define TAUSSIG_INTEROP_MATERIALIZE_SOA_HPP
+
+#include <taussig/algorithms/zip.h++>
+
+#include <taussig/primitives/empty.h++>
+#include <taussig/primitives/front.h++>
+#include <taussig/primitives/pop_front.h++>
+#include <taussig/traits/is_sequence.h++>
+#include <taussig/traits/reference_type.h++>
+#include <taussig/traits/value_type.h++>
+
+#include <taussig/detail/contiguous.h++>
+#include <taussig/detail/indices.h++>
+
+#include <wheels/meta/all.h++>
+#include <wheels/meta/bool.h++>
+#include <wheels/meta/decay.h++>
+#include <wheels/meta/enable_if.h++>
+#include <wheels/meta/unqual.h++>
+
+#include <algorithm> // min
+#include <tuple>
+#include <vector>
+#include <cstddef> // size_t
+
+namespace seq {
+    namespace detail {
+        template <typename T>
+        struct columns_of {};
+        template <typename... T>
+        struct columns_of<std::tuple<T...>> {
+            using type = std::tuple<std::vector<T>...>;
+        };
+        template <typename T>
+        using ColumnsOf = typename columns_of<T>::type;
+
+        template <typename S>
+        struct is_random_access_zip : wheels::meta::False {};
+        template <typename... Seqs>
+        struct is_random_access_zip<zip_sequence<Seqs...>>
+        : wheels::meta::All<is_random_access_sequence<wheels::meta::Decay<Seqs>>...> {};
+
+        template <typename C, typename S, std::size_t... I>
+        void materialize_columns(C& columns, S& s, indices<I...>, wheels::meta::False) {
+            for(; !seq::empty(s); seq::pop_front(s)) {
+                ReferenceType<S> row = seq::front(s);
+                swallow { (std::get<I>(columns).push_back(std::get<I>(row)), 0)... };
+            }
+        }
+        template <typename C, typename S, std::size_t... I>
+        void materialize_columns(C& columns, S& s, indices<I...>, wheels::meta::True) {
+            // each column is copied in one go from its own sequence, up to the shortest one
+            auto const& seqs = s.sequences();
+            auto n = static_cast<std::size_t>(-1);
+            for(std::size_t size : { static_cast<std::size_t>(std::get<I>(seqs).second - std::get<I>(seqs).first)... }) {
+                n = std::min(n, size);
+            }
+            swallow { (std::get<I>(columns).assign(std::get<I>(seqs).first, std::get<I>(seqs).first + n), 0)... };
+        }
+    } // namespace detail
+
+    //! {function}
+    //! *Requires*: `S` is a sequence of `std::tuple`s [soft], like the result of `zip`.
+    //! *Returns*: a tuple with one `std::vector` per element of the tuples, holding that element
+    //!            from each tuple in `s`, in order.
+    //! *Note*: zips of random-access sequences are copied a whole column at a time.
+    template <typename S,
+              wheels::meta::EnableIf<is_sequence<S>>...>
+    detail::ColumnsOf<ValueType<wheels::meta::Decay<S>>> materialize_soa(S&& s) {
+        using seq_type = wheels::meta::Decay<S>;
+        detail::ColumnsOf<ValueType<seq_type>> columns;
+        seq_type copy(std::forward<S>(s));
+        detail::materialize_columns(columns, copy, detail::IndicesFor<std::tuple_size<ValueType<seq_type>>::value>{},
+                                    detail::is_random_access_zip<seq_type>{});
+        return columns;
+    }
+} // namespace seq
+
+#endif // TAUSSIG_INTEROP_MATERIALIZE_SOA_HPP
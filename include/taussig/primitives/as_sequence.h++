@@ -28,6 +28,7 @@
 #include <wheels/optional.h++>
 
 #include <iterator> // forward_iterator_tag, begin, end
+#include <type_traits> // conditional
 #include <utility> // forward, pair
 #include <string> // char_traits
 #include <cstddef> // size_t
@@ -61,31 +62,46 @@ namespace seq {
         struct null_terminated_tag { using type = null_terminated_tag; };
         struct adapted_source_tag { using type = adapted_source_tag; };
 
+        // Each kind is only tested once the ones before it are ruled out, so the common cases (true
+        // sequences and iterables) do not pay for the tests that come after them.
+        template <typename T,
+                  bool = is_null_terminated_string<wheels::meta::Unqual<T>>()>
+        struct null_terminated_kind_of : null_terminated_tag {};
+        template <typename T>
+        struct null_terminated_kind_of<T, false> : wheels::meta::id<void> {};
+
+        template <typename T,
+                  bool = is_iterator_pair<T>()>
+        struct iterator_pair_kind_of : iterator_pair_tag {};
+        template <typename T>
+        struct iterator_pair_kind_of<T, false> : null_terminated_kind_of<T> {};
+
+        template <typename T,
+                  bool = has_begin_end<T, std::forward_iterator_tag>()>
+        struct iterable_kind_of : iterator_pair_kind_of<T> {};
+        template <typename T>
+        struct iterable_kind_of<T, true>
+        : std::conditional<is_null_terminated_string<wheels::meta::Unqual<T>>::value, null_terminated_tag, iterable_tag>::type {};
+
         template <typename T,
-                  bool = is_true_sequence<wheels::meta::Unqual<T>>(),
-                  bool = is_optional<wheels::meta::Unqual<T>>(),
-                  bool = has_begin_end<T, std::forward_iterator_tag>(),
-                  bool = is_iterator_pair<T>(),
-                  bool = is_null_terminated_string<wheels::meta::Unqual<T>>(),
                   bool = is_adapted_source<T>()>
-        struct source_kind_of : wheels::meta::id<void> {};
+        struct adapted_source_kind_of : iterable_kind_of<T> {};
         template <typename T>
-        using SourceKindOf = wheels::meta::Invoke<source_kind_of<T>>;
+        struct adapted_source_kind_of<T, true> : adapted_source_tag {};
+
+        template <typename T,
+                  bool = is_optional<wheels::meta::Unqual<T>>()>
+        struct optional_kind_of : adapted_source_kind_of<T> {};
+        template <typename T>
+        struct optional_kind_of<T, true> : optional_tag {};
 
-        template <typename T, bool O, bool I, bool P, bool Z, bool A>
-        struct source_kind_of<T, true, O, I, P, Z, A> : true_sequence_tag {};
-        template <typename T, bool I, bool P, bool Z, bool A>
-        struct source_kind_of<T, false, true, I, P, Z, A> : optional_tag {};
-        template <typename T, bool O, bool I, bool P, bool Z>
-        struct source_kind_of<T, false, O, I, P, Z, true> : adapted_source_tag {};
-        template <typename T, bool P>
-        struct source_kind_of<T, false, false, true, P, true, false> : null_terminated_tag {};
-        template <typename T, bool P>
-        struct source_kind_of<T, false, false, true, P, false, false> : iterable_tag {};
-        template <typename T, bool Z>
-        struct source_kind_of<T, false, false, false, true, Z, false> : iterator_pair_tag {};
+        template <typename T,
+                  bool = is_true_sequence<wheels::meta::Unqual<T>>()>
+        struct source_kind_of : optional_kind_of<T> {};
         template <typename T>
-        struct source_kind_of<T, false, false, false, false, true, false> : null_terminated_tag {};
+        struct source_kind_of<T, true> : true_sequence_tag {};
+        template <typename T>
+        using SourceKindOf = wheels::meta::Invoke<source_kind_of<T>>;
 
         //! {traits}
         //! *Note*: implementation backend for `as_sequence` and `result_of::as_sequence`.
@@ -19,6 +19,7 @@
 #include <wheels/meta/bool.h++>
 #include <wheels/meta/depend_on.h++>
 #include <wheels/meta/trait_of.h++>
+#include <wheels/meta/unqual.h++>
 
 namespace seq {
     namespace detail {
@@ -28,13 +29,17 @@ namespace seq {
             template <typename...>
             wheels::meta::False static test(...);
         };
+
+        template <typename S>
+        struct is_sequence_unqual : wheels::meta::TraitOf<sequence_test, S> {};
     } // namespace detail
 
     //! {trait}
     //! *Returns*: `true` if `S` is a sequence;
     //!            `false` otherwise.
+    //! *Note*: references and cv-qualified types share the instantiations of the plain type.
     template <typename S>
-    struct is_sequence : wheels::meta::TraitOf<detail::sequence_test, S> {};
+    struct is_sequence : detail::is_sequence_unqual<wheels::meta::Unqual<S>> {};
 } // namespace seq
 
 #endif // TAUSSIG_TRAITS_IS_SEQUENCE_HPP
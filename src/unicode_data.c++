@@ -0,0 +1,2842 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Unicode normalization data (Unicode 14.0.0)
+//
+// Generated by tools/gen_unicode_data.py; do not edit.
+
+#include <taussig/detail/unicode_data.h++>
+
+namespace seq {
+    namespace detail {
+        namespace ucd {
+            static_assert(block_shift == 7, "generated data does not match block_shift");
+
+            std::uint16_t const stage1[8704] = {
+                0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+                32, 33, 34, 35, 10, 10, 36, 10, 10, 10, 10, 10, 10, 10, 37, 38,
+                10, 39, 40, 10, 41, 42, 43, 44, 45, 46, 10, 47, 48, 49, 50, 51,
+                52, 53, 54, 55, 56, 57, 58, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 59, 10, 10, 10, 60, 61, 62, 10, 10, 10, 10,
+                63, 64, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 65, 66, 10, 10,
+                67, 68, 69, 70, 10, 71, 10, 72, 73, 73, 73, 73, 73, 73, 73, 73,
+                73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+                73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+                73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+                73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+                73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 74,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 75, 76, 77, 78, 79, 10, 10, 10, 10, 10, 80, 10, 10, 10,
+                10, 10, 10, 81, 10, 82, 83, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 84, 85, 10, 10, 10, 10, 86, 10, 10, 87, 88, 89,
+                90, 91, 92, 93, 94, 95, 96, 10, 97, 98, 10, 99, 100, 101, 102, 10,
+                103, 10, 104, 105, 106, 107, 10, 10, 100, 10, 108, 109, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 110, 111, 10, 10, 10, 10, 10, 10, 10, 10, 112,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 113, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 114, 115, 116, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                117, 10, 111, 10, 10, 118, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 119, 120, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                121, 122, 123, 124, 125, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            };
+            std::uint16_t const stage2[16128] = {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0,
+                0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+                19, 0, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0,
+                0, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+                44, 0, 45, 46, 47, 48, 49, 50, 51, 52, 53, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70,
+                0, 71, 72, 73, 74, 75, 76, 0, 77, 78, 79, 80, 81, 82, 0, 0,
+                83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98,
+                0, 99, 100, 101, 102, 103, 104, 0, 105, 106, 107, 108, 109, 110, 0, 111,
+                112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+                0, 0, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+                142, 143, 144, 145, 146, 147, 0, 0, 148, 149, 150, 151, 152, 153, 154, 155,
+                156, 0, 0, 0, 157, 158, 159, 160, 0, 161, 162, 163, 164, 165, 166, 0,
+                0, 0, 0, 167, 168, 169, 170, 171, 172, 0, 0, 0, 173, 174, 175, 176,
+                177, 178, 0, 0, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+                191, 192, 193, 194, 195, 196, 0, 0, 197, 198, 199, 200, 201, 202, 203, 204,
+                205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                221, 222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223,
+                224, 0, 0, 0, 0, 0, 0, 225, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 226, 227, 228,
+                229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 0, 242, 243,
+                244, 245, 246, 247, 0, 0, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+                258, 0, 0, 0, 259, 260, 0, 0, 261, 262, 263, 264, 265, 266, 267, 268,
+                269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
+                285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 0, 0, 297, 298,
+                0, 0, 0, 0, 0, 0, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+                309, 310, 311, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 313, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                314, 314, 314, 314, 314, 315, 314, 314, 314, 314, 314, 314, 314, 315, 315, 314,
+                315, 314, 315, 314, 314, 316, 317, 317, 317, 317, 316, 318, 317, 317, 317, 317,
+                317, 319, 319, 320, 320, 320, 320, 321, 321, 317, 317, 317, 317, 320, 320, 317,
+                320, 320, 317, 317, 322, 322, 322, 322, 323, 317, 317, 317, 317, 315, 315, 315,
+                324, 325, 314, 326, 327, 328, 315, 317, 317, 317, 315, 315, 315, 317, 317, 0,
+                315, 315, 315, 317, 317, 317, 317, 315, 316, 317, 317, 315, 329, 330, 330, 329,
+                330, 330, 329, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+                0, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 332, 0,
+                0, 0, 0, 0, 0, 333, 334, 335, 336, 337, 338, 0, 339, 0, 340, 341,
+                342, 343, 0, 0, 0, 344, 0, 345, 0, 346, 0, 0, 0, 0, 0, 347,
+                0, 348, 0, 0, 0, 349, 0, 0, 0, 350, 351, 352, 353, 354, 355, 356,
+                357, 358, 0, 0, 0, 359, 0, 360, 0, 361, 0, 0, 0, 0, 0, 362,
+                0, 363, 0, 0, 0, 364, 0, 0, 0, 365, 366, 367, 368, 369, 370, 0,
+                0, 0, 371, 372, 373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                374, 375, 0, 376, 0, 0, 377, 378, 0, 0, 0, 0, 379, 380, 381, 0,
+                382, 0, 0, 383, 0, 384, 385, 386, 387, 388, 389, 0, 0, 0, 390, 0,
+                0, 0, 0, 391, 0, 0, 0, 392, 0, 0, 0, 393, 0, 394, 0, 0,
+                395, 0, 0, 396, 0, 397, 398, 399, 400, 401, 402, 0, 0, 0, 403, 0,
+                0, 0, 0, 404, 0, 0, 0, 405, 0, 0, 0, 406, 0, 407, 0, 0,
+                408, 409, 0, 410, 0, 0, 411, 412, 0, 0, 0, 0, 413, 414, 415, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 416, 417, 418, 419, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 315, 315, 315, 315, 315, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 420, 421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                422, 423, 424, 425, 0, 0, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+                0, 0, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+                450, 451, 452, 453, 454, 455, 0, 0, 456, 457, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 317, 315, 315, 315, 315, 317, 315, 315, 315, 458, 317, 315, 315, 315, 315,
+                315, 315, 317, 317, 317, 317, 317, 317, 315, 315, 317, 315, 315, 458, 459, 315,
+                460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 469, 470, 471, 472, 0, 473,
+                0, 474, 475, 0, 315, 317, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 315, 315, 315, 315, 315, 476, 477, 478, 0, 0, 0, 0, 0,
+                0, 0, 479, 480, 481, 482, 483, 484, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 485, 0, 486, 487, 488, 489, 476, 477,
+                478, 490, 491, 314, 314, 320, 317, 315, 315, 315, 315, 315, 317, 315, 315, 317,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                492, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                493, 494, 495, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 496, 497, 0, 498, 315, 315, 315, 315, 315, 315, 315, 0, 0, 315,
+                315, 315, 315, 317, 315, 0, 0, 315, 315, 0, 317, 315, 315, 317, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 499, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 317, 315, 315, 317, 315, 315, 317, 317, 317, 315, 317, 317, 315, 317, 315,
+                315, 315, 317, 315, 317, 315, 317, 315, 317, 315, 315, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 315, 315, 315, 315,
+                315, 315, 317, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 317, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 315, 315, 315, 315, 0, 315, 315, 315, 315, 315,
+                315, 315, 315, 315, 0, 315, 315, 315, 0, 315, 315, 315, 315, 315, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 317, 317, 317, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 315, 317, 317, 317, 315, 315, 315, 315,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 315, 315, 315, 315, 317,
+                317, 317, 317, 317, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+                315, 315, 0, 317, 315, 315, 317, 315, 315, 317, 315, 315, 315, 317, 317, 317,
+                487, 488, 489, 315, 315, 315, 317, 315, 315, 317, 317, 315, 315, 315, 315, 315,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 500, 501, 0, 0, 0, 0, 0, 0,
+                502, 503, 0, 504, 505, 0, 0, 0, 0, 0, 0, 0, 506, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 0,
+                0, 315, 317, 315, 315, 0, 0, 0, 508, 509, 510, 511, 512, 513, 514, 515,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 517, 0,
+                0, 0, 0, 0, 0, 0, 0, 518, 0, 0, 0, 519, 520, 507, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0, 521, 522, 0, 523,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 524, 0, 0, 525, 0, 0, 0, 0, 0, 516, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 526, 527, 528, 0, 0, 529, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 517, 0,
+                0, 0, 0, 0, 0, 0, 0, 530, 531, 0, 0, 532, 533, 507, 0, 0,
+                0, 0, 0, 0, 0, 0, 517, 517, 0, 0, 0, 0, 534, 535, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 536, 0, 537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 517, 0,
+                0, 0, 0, 0, 0, 0, 538, 539, 0, 0, 540, 541, 542, 507, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 543, 0, 544, 0, 0, 0, 0, 507, 0, 0,
+                0, 0, 0, 0, 0, 545, 546, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 547,
+                548, 0, 517, 0, 0, 0, 549, 550, 551, 0, 552, 553, 0, 507, 0, 0,
+                0, 0, 0, 0, 0, 517, 517, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 507, 0, 517, 0,
+                0, 0, 0, 0, 0, 0, 554, 555, 0, 0, 556, 557, 558, 507, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 559, 0, 0, 0, 0, 517,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 560, 561, 0, 562, 563, 564, 517,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 565, 565, 507, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 566, 566, 566, 566, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 567, 567, 507, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 568, 568, 568, 568, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 317, 317, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 317, 0, 317, 0, 569, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 570, 0, 0, 0, 0, 0, 0, 0, 0, 0, 571, 0, 0,
+                0, 0, 572, 0, 0, 0, 0, 573, 0, 0, 0, 0, 574, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 575, 0, 0, 0, 0, 0, 0,
+                0, 576, 577, 578, 579, 580, 581, 0, 582, 0, 577, 577, 577, 577, 0, 0,
+                577, 583, 315, 315, 507, 0, 315, 315, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0,
+                0, 0, 586, 0, 0, 0, 0, 587, 0, 0, 0, 0, 588, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 589, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 317, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 590, 591, 0, 0, 0, 0, 0, 0, 0, 517, 0,
+                0, 0, 0, 0, 0, 0, 0, 516, 0, 507, 507, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 317, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+                517, 517, 517, 517, 517, 517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 517, 517, 517, 517, 517, 517, 517, 517,
+                517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+                517, 517, 517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 315, 315,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 507, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 458, 315, 317, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 315, 317, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 315, 315, 315, 315, 315, 315, 315, 315, 0, 0, 317,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 315, 315, 317, 317, 317, 317, 317, 317, 315, 315, 317, 0, 317,
+                317, 315, 315, 317, 317, 315, 315, 315, 315, 315, 317, 315, 315, 315, 315, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 0,
+                0, 602, 603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 516, 517, 0, 0, 0, 0, 604, 605, 606, 607, 608, 609,
+                610, 611, 612, 613, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 317, 315, 315, 315,
+                315, 315, 315, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 507, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 507, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 0, 322, 317, 317, 317, 317, 317, 315, 315, 317, 317, 317, 317,
+                315, 0, 322, 322, 322, 322, 322, 322, 322, 0, 0, 0, 0, 317, 0, 0,
+                0, 0, 0, 0, 315, 0, 0, 0, 315, 315, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 317, 315, 315, 315, 315, 315, 315, 315, 317, 315, 315, 330, 614, 317,
+                319, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+                315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+                315, 315, 315, 315, 315, 315, 316, 459, 459, 317, 615, 315, 329, 317, 315, 317,
+                616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631,
+                632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+                648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663,
+                664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679,
+                680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695,
+                696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711,
+                712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727,
+                728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743,
+                744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759,
+                760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 0, 770, 0, 0, 0, 0,
+                771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786,
+                787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802,
+                803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818,
+                819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834,
+                835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850,
+                851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 0, 0, 0, 0, 0, 0,
+                861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876,
+                877, 878, 879, 880, 881, 882, 0, 0, 883, 884, 885, 886, 887, 888, 0, 0,
+                889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904,
+                905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920,
+                921, 922, 923, 924, 925, 926, 0, 0, 927, 928, 929, 930, 931, 932, 0, 0,
+                933, 934, 935, 936, 937, 938, 939, 940, 0, 941, 0, 942, 0, 943, 0, 944,
+                945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960,
+                961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 0, 0,
+                975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990,
+                991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+                1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+                1023, 1024, 1025, 1026, 1027, 0, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 0, 1035, 1036,
+                0, 1037, 1038, 1039, 1040, 0, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050,
+                1051, 1052, 1053, 1054, 0, 0, 1055, 1056, 1057, 1058, 1059, 1060, 0, 1061, 1062, 1063,
+                1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
+                0, 0, 1080, 1081, 1082, 0, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 0,
+                1092, 1093, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 322, 322, 315, 315, 315, 315, 322, 322, 322, 315, 315, 0, 0, 0,
+                0, 315, 0, 0, 0, 322, 322, 315, 317, 315, 322, 322, 317, 317, 317, 317,
+                315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1094, 0, 0, 0, 1095, 1096, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1097, 0, 1098, 0, 1099, 0, 0, 0, 0, 0, 1100, 1101, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1102, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1103, 1104, 1105,
+                1106, 0, 1107, 0, 1108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 1109, 1110, 0, 0, 0, 1111, 1112, 0, 1113, 1114, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 1115, 1116, 1117, 1118, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1119, 0, 0, 0,
+                0, 1120, 0, 1121, 1122, 1123, 0, 1124, 1125, 1126, 0, 0, 0, 1127, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1128, 1129, 1130, 0, 1131, 1132, 0, 0, 0, 0, 0, 0, 0, 1133, 1134, 1135,
+                1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 0, 0,
+                1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 0, 0, 0, 0, 0, 0,
+                0, 1160, 1161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 1162, 0, 0, 0, 0, 0, 1163, 1164, 0, 1165, 1166, 1167, 1168, 1169,
+                0, 0, 1170, 1171, 1172, 1173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1174, 1175, 1176, 1177, 0, 0, 0, 0, 0, 0, 1178, 1179, 1180, 1181, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 1182, 1183, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1184, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315,
+                315, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+                315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 459, 316, 458, 1185, 1185,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1186, 0, 0, 0, 0, 1187, 1188, 1189, 1190, 1191,
+                1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207,
+                1208, 1209, 1210, 0, 1211, 1212, 1213, 1214, 1215, 1216, 0, 0, 0, 0, 0, 1217,
+                1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 1232, 0, 0, 0, 0, 1233, 1233, 0, 0, 1234, 1235, 0,
+                0, 0, 0, 0, 0, 0, 1236, 0, 0, 0, 0, 1237, 1238, 1239, 1240, 1241,
+                1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
+                1258, 1259, 1260, 0, 1261, 1262, 1263, 1264, 1265, 1266, 0, 0, 0, 0, 0, 1267,
+                1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1282,
+                1283, 1284, 1285, 0, 1286, 0, 0, 1287, 1288, 1289, 1290, 0, 0, 1291, 1292, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315,
+                0, 0, 0, 0, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 315,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+                315, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 317, 317, 317, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 0, 315, 315, 317, 0, 0, 315, 315, 0, 0, 0, 0, 0, 315, 315,
+                0, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+                1293, 1293, 1293, 1293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+                1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
+                1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341,
+                1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357,
+                1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+                1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+                1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405,
+                1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
+                1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437,
+                1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453,
+                1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
+                1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
+                1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
+                1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+                1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533,
+                1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549,
+                1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 0, 0,
+                1564, 0, 1565, 0, 0, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 0,
+                1576, 0, 1577, 0, 0, 1578, 1579, 0, 0, 0, 1580, 1581, 1582, 1583, 1584, 1585,
+                1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601,
+                1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617,
+                1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633,
+                1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 0, 0,
+                1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+                1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679,
+                1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
+                1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
+                1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+                1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+                1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1754, 1755, 1756,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1757, 1758, 1759, 1760, 1761, 1762,
+                1763, 1764, 1765, 1766, 1767, 1768, 1769, 0, 1770, 1771, 1772, 1773, 1774, 0, 1775, 0,
+                1776, 1777, 0, 1778, 1779, 0, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 315, 315, 315, 315, 317, 317, 317, 317, 317, 317, 317, 315, 315,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 317, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 315, 315, 315, 315, 315, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 317, 0, 315,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 315, 322, 317, 0, 0, 0, 0, 507,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 315, 317, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 315, 315, 315, 315, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 315, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 317, 317, 315, 315, 315, 317, 315, 317, 317, 317,
+                317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 315, 317, 315, 317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 1789, 1790, 1791, 1792, 0, 0, 0,
+                0, 0, 0, 0, 0, 1793, 0, 0, 0, 0, 0, 1794, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 506, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0, 0, 0, 1795, 1796,
+                0, 1797, 1798, 507, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 507, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 507, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 516, 0, 517, 0,
+                0, 0, 0, 0, 0, 0, 0, 1799, 0, 0, 0, 1800, 1801, 507, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 315, 315, 315, 315, 315, 315, 315, 0, 0, 0,
+                315, 315, 315, 315, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 507, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                517, 0, 0, 0, 0, 0, 0, 0, 0, 1802, 517, 1803, 1804, 517, 1805, 0,
+                0, 0, 507, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 517,
+                0, 0, 0, 0, 0, 0, 0, 0, 1806, 1807, 1808, 1809, 0, 0, 0, 507,
+                516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 507, 516, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 516, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                517, 0, 0, 0, 0, 1810, 0, 0, 1811, 0, 0, 0, 0, 507, 507, 0,
+                0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 516, 0, 507, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                322, 322, 322, 322, 322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 315, 315, 315, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1812, 1812, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 322, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1813, 1814,
+                1815, 1816, 1817, 1818, 1819, 569, 569, 322, 322, 322, 0, 0, 0, 1820, 569, 569,
+                569, 569, 569, 0, 0, 0, 0, 0, 0, 0, 0, 317, 317, 317, 317, 317,
+                317, 317, 317, 0, 0, 315, 315, 315, 315, 315, 317, 317, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 315, 315, 315, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1821, 1822, 1823, 1824, 1825,
+                1826, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 315, 315, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                315, 315, 315, 315, 315, 315, 315, 0, 315, 315, 315, 315, 315, 315, 315, 315,
+                315, 315, 315, 315, 315, 315, 315, 315, 315, 0, 0, 315, 315, 315, 315, 315,
+                315, 315, 0, 315, 315, 0, 315, 315, 315, 315, 315, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 315, 315, 315,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                317, 317, 317, 317, 317, 317, 317, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 315, 315, 315, 315, 315, 315, 516, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842,
+                1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858,
+                1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874,
+                1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890,
+                1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906,
+                1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922,
+                1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938,
+                1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954,
+                1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970,
+                1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986,
+                1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002,
+                2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018,
+                2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+                2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050,
+                2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066,
+                2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082,
+                2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098,
+                2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114,
+                2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130,
+                2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146,
+                2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162,
+                2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178,
+                2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194,
+                2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210,
+                2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226,
+                2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242,
+                2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258,
+                2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274,
+                2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290,
+                2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306,
+                2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322,
+                2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338,
+                2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354,
+                2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            };
+            record const records[2369] = {
+                { 0, 0, 0, 8, 0, 0 }, { 0, 0, 0, 8, 0, 1 }, { 0, 1, 0, 8, 0, 1 }, { 0, 2, 0, 8, 0, 1 },
+                { 0, 3, 0, 8, 0, 16 }, { 0, 19, 0, 8, 0, 3 }, { 0, 22, 0, 8, 0, 5 }, { 0, 27, 0, 8, 0, 6 },
+                { 0, 33, 0, 8, 0, 17 }, { 0, 50, 0, 8, 0, 1 }, { 0, 51, 0, 8, 0, 7 }, { 0, 58, 0, 8, 0, 7 },
+                { 0, 65, 0, 8, 0, 15 }, { 0, 80, 0, 8, 0, 1 }, { 0, 81, 0, 8, 0, 5 }, { 0, 86, 0, 8, 0, 6 },
+                { 0, 92, 0, 8, 0, 3 }, { 0, 95, 0, 8, 0, 9 }, { 0, 104, 0, 8, 0, 16 }, { 0, 120, 0, 8, 0, 2 },
+                { 0, 122, 0, 8, 0, 8 }, { 0, 130, 0, 8, 0, 7 }, { 0, 137, 0, 8, 0, 7 }, { 0, 144, 0, 8, 0, 19 },
+                { 0, 163, 0, 8, 0, 2 }, { 0, 165, 0, 8, 0, 6 }, { 0, 171, 0, 8, 0, 2 }, { 0, 173, 0, 8, 0, 9 },
+                { 0, 182, 0, 8, 0, 6 }, { 0, 188, 0, 8, 0, 16 }, { 0, 204, 0, 8, 0, 3 }, { 0, 207, 0, 8, 0, 5 },
+                { 0, 212, 0, 8, 0, 6 }, { 0, 218, 0, 8, 0, 17 }, { 0, 235, 0, 8, 0, 1 }, { 0, 236, 0, 8, 0, 7 },
+                { 0, 243, 0, 8, 0, 8 }, { 0, 251, 0, 8, 0, 14 }, { 0, 265, 0, 8, 0, 2 }, { 0, 267, 0, 8, 0, 5 },
+                { 0, 272, 0, 8, 0, 6 }, { 0, 278, 0, 8, 0, 3 }, { 0, 281, 0, 8, 0, 9 }, { 0, 290, 0, 8, 0, 16 },
+                { 0, 306, 0, 8, 0, 2 }, { 0, 308, 0, 8, 0, 8 }, { 0, 316, 0, 8, 0, 7 }, { 0, 323, 0, 8, 0, 8 },
+                { 0, 331, 0, 8, 0, 19 }, { 0, 350, 0, 8, 0, 2 }, { 0, 352, 0, 8, 0, 7 }, { 0, 359, 0, 8, 0, 2 },
+                { 0, 361, 0, 8, 0, 10 }, { 0, 371, 0, 8, 0, 6 }, { 0, 377, 0, 8, 0, 3 }, { 0, 0, 0, 12, 2, 0 },
+                { 2, 0, 0, 12, 2, 0 }, { 4, 380, 0, 12, 2, 4 }, { 6, 0, 0, 12, 2, 0 }, { 8, 384, 0, 12, 2, 1 },
+                { 10, 385, 0, 12, 2, 1 }, { 0, 386, 0, 8, 0, 2 }, { 12, 388, 0, 12, 2, 1 }, { 14, 0, 0, 12, 2, 0 },
+                { 16, 0, 0, 12, 2, 0 }, { 18, 389, 0, 12, 2, 4 }, { 20, 0, 0, 12, 2, 0 }, { 22, 0, 0, 12, 2, 0 },
+                { 24, 0, 0, 12, 2, 0 }, { 26, 0, 0, 12, 2, 0 }, { 28, 393, 0, 12, 2, 1 }, { 30, 0, 0, 12, 2, 0 },
+                { 32, 0, 0, 12, 2, 0 }, { 34, 0, 0, 12, 2, 0 }, { 36, 394, 0, 12, 2, 4 }, { 38, 398, 0, 12, 2, 3 },
+                { 40, 401, 0, 12, 2, 1 }, { 0, 402, 0, 8, 0, 1 }, { 42, 0, 0, 12, 2, 0 }, { 44, 0, 0, 12, 2, 0 },
+                { 46, 0, 0, 12, 2, 0 }, { 48, 403, 0, 12, 2, 4 }, { 50, 0, 0, 12, 2, 0 }, { 52, 0, 0, 12, 2, 0 },
+                { 54, 0, 0, 12, 2, 0 }, { 56, 407, 0, 12, 2, 4 }, { 58, 0, 0, 12, 2, 0 }, { 60, 411, 0, 12, 2, 1 },
+                { 62, 412, 0, 12, 2, 1 }, { 0, 413, 0, 8, 0, 2 }, { 64, 415, 0, 12, 2, 1 }, { 66, 0, 0, 12, 2, 0 },
+                { 68, 0, 0, 12, 2, 0 }, { 70, 416, 0, 12, 2, 4 }, { 72, 0, 0, 12, 2, 0 }, { 74, 0, 0, 12, 2, 0 },
+                { 76, 0, 0, 12, 2, 0 }, { 78, 0, 0, 12, 2, 0 }, { 80, 420, 0, 12, 2, 1 }, { 82, 0, 0, 12, 2, 0 },
+                { 84, 0, 0, 12, 2, 0 }, { 86, 0, 0, 12, 2, 0 }, { 88, 421, 0, 12, 2, 4 }, { 90, 425, 0, 12, 2, 3 },
+                { 92, 428, 0, 12, 2, 1 }, { 0, 429, 0, 8, 0, 1 }, { 94, 0, 0, 12, 2, 0 }, { 96, 0, 0, 12, 2, 0 },
+                { 98, 0, 0, 12, 2, 0 }, { 100, 430, 0, 12, 2, 4 }, { 102, 0, 0, 12, 2, 0 }, { 104, 0, 0, 12, 2, 0 },
+                { 106, 0, 0, 12, 2, 0 }, { 108, 0, 0, 12, 2, 0 }, { 110, 434, 0, 12, 2, 4 }, { 112, 438, 0, 12, 2, 4 },
+                { 114, 0, 0, 12, 2, 0 }, { 116, 0, 0, 12, 2, 0 }, { 118, 0, 0, 12, 2, 0 }, { 120, 0, 0, 12, 2, 0 },
+                { 122, 0, 0, 12, 2, 0 }, { 124, 0, 0, 12, 2, 0 }, { 126, 0, 0, 12, 2, 0 }, { 128, 0, 0, 12, 2, 0 },
+                { 130, 0, 0, 12, 2, 0 }, { 132, 0, 0, 12, 2, 0 }, { 134, 0, 0, 12, 2, 0 }, { 136, 0, 0, 12, 2, 0 },
+                { 138, 442, 0, 12, 2, 2 }, { 140, 444, 0, 12, 2, 2 }, { 142, 0, 0, 12, 2, 0 }, { 144, 0, 0, 12, 2, 0 },
+                { 146, 0, 0, 12, 2, 0 }, { 148, 0, 0, 12, 2, 0 }, { 150, 0, 0, 12, 2, 0 }, { 152, 0, 0, 12, 2, 0 },
+                { 154, 0, 0, 12, 2, 0 }, { 156, 0, 0, 12, 2, 0 }, { 158, 0, 0, 12, 2, 0 }, { 160, 0, 0, 12, 2, 0 },
+                { 162, 0, 0, 12, 2, 0 }, { 164, 0, 0, 12, 2, 0 }, { 166, 0, 0, 12, 2, 0 }, { 168, 0, 0, 12, 2, 0 },
+                { 170, 0, 0, 12, 2, 0 }, { 172, 0, 0, 12, 2, 0 }, { 174, 0, 0, 12, 2, 0 }, { 176, 0, 0, 12, 2, 0 },
+                { 178, 0, 0, 12, 2, 0 }, { 180, 0, 0, 12, 2, 0 }, { 182, 0, 0, 12, 2, 0 }, { 184, 0, 0, 12, 2, 0 },
+                { 186, 0, 0, 12, 2, 0 }, { 188, 0, 0, 12, 2, 0 }, { 190, 0, 0, 12, 2, 0 }, { 192, 0, 0, 12, 2, 0 },
+                { 194, 0, 0, 12, 2, 0 }, { 196, 0, 0, 12, 2, 0 }, { 198, 0, 0, 12, 2, 0 }, { 200, 0, 0, 12, 2, 0 },
+                { 202, 0, 0, 12, 2, 0 }, { 204, 0, 0, 12, 2, 0 }, { 206, 0, 0, 12, 2, 0 }, { 208, 0, 0, 12, 2, 0 },
+                { 210, 0, 0, 12, 2, 0 }, { 212, 0, 0, 12, 2, 0 }, { 214, 0, 0, 12, 2, 0 }, { 216, 0, 0, 12, 2, 0 },
+                { 218, 0, 0, 12, 2, 0 }, { 220, 0, 0, 12, 2, 0 }, { 222, 0, 0, 12, 2, 0 }, { 224, 0, 0, 12, 2, 0 },
+                { 226, 0, 0, 12, 2, 0 }, { 228, 446, 0, 12, 2, 2 }, { 230, 448, 0, 12, 2, 2 }, { 232, 0, 0, 12, 2, 0 },
+                { 234, 0, 0, 12, 2, 0 }, { 236, 0, 0, 12, 2, 0 }, { 238, 0, 0, 12, 2, 0 }, { 240, 0, 0, 12, 2, 0 },
+                { 242, 0, 0, 12, 2, 0 }, { 244, 0, 0, 12, 2, 0 }, { 246, 0, 0, 12, 2, 0 }, { 248, 0, 0, 12, 2, 0 },
+                { 250, 0, 0, 12, 2, 0 }, { 252, 450, 0, 12, 2, 1 }, { 254, 451, 0, 12, 2, 1 }, { 256, 0, 0, 12, 2, 0 },
+                { 258, 0, 0, 12, 2, 0 }, { 260, 0, 0, 12, 2, 0 }, { 262, 0, 0, 12, 2, 0 }, { 264, 452, 0, 12, 2, 1 },
+                { 266, 453, 0, 12, 2, 1 }, { 268, 0, 0, 12, 2, 0 }, { 270, 0, 0, 12, 2, 0 }, { 272, 0, 0, 12, 2, 0 },
+                { 274, 0, 0, 12, 2, 0 }, { 276, 454, 0, 12, 2, 1 }, { 278, 455, 0, 12, 2, 1 }, { 280, 456, 0, 12, 2, 1 },
+                { 282, 457, 0, 12, 2, 1 }, { 284, 0, 0, 12, 2, 0 }, { 286, 0, 0, 12, 2, 0 }, { 288, 0, 0, 12, 2, 0 },
+                { 290, 0, 0, 12, 2, 0 }, { 292, 0, 0, 12, 2, 0 }, { 294, 0, 0, 12, 2, 0 }, { 296, 0, 0, 12, 2, 0 },
+                { 298, 0, 0, 12, 2, 0 }, { 300, 0, 0, 12, 2, 0 }, { 302, 0, 0, 12, 2, 0 }, { 304, 0, 0, 12, 2, 0 },
+                { 306, 0, 0, 12, 2, 0 }, { 308, 0, 0, 12, 2, 0 }, { 310, 0, 0, 12, 2, 0 }, { 312, 0, 0, 12, 2, 0 },
+                { 314, 0, 0, 12, 2, 0 }, { 316, 0, 0, 12, 2, 0 }, { 318, 0, 0, 12, 2, 0 }, { 320, 0, 0, 12, 2, 0 },
+                { 0, 458, 0, 8, 0, 1 }, { 322, 459, 0, 12, 2, 5 }, { 324, 464, 0, 12, 2, 5 }, { 326, 469, 0, 12, 2, 5 },
+                { 328, 474, 0, 12, 2, 5 }, { 0, 479, 0, 8, 0, 1 }, { 330, 0, 0, 12, 2, 0 }, { 332, 0, 0, 12, 2, 0 },
+                { 334, 0, 0, 12, 2, 0 }, { 336, 0, 0, 12, 2, 0 }, { 338, 0, 0, 12, 2, 0 }, { 340, 0, 0, 12, 2, 0 },
+                { 342, 0, 0, 12, 2, 0 }, { 344, 0, 0, 12, 2, 0 }, { 346, 0, 0, 12, 3, 0 }, { 349, 0, 0, 12, 3, 0 },
+                { 352, 0, 0, 12, 3, 0 }, { 355, 0, 0, 12, 3, 0 }, { 358, 0, 0, 12, 3, 0 }, { 361, 0, 0, 12, 3, 0 },
+                { 364, 0, 0, 12, 3, 0 }, { 367, 0, 0, 12, 3, 0 }, { 370, 0, 0, 12, 3, 0 }, { 373, 0, 0, 12, 3, 0 },
+                { 376, 0, 0, 12, 3, 0 }, { 379, 0, 0, 12, 3, 0 }, { 382, 0, 0, 12, 2, 0 }, { 384, 0, 0, 12, 2, 0 },
+                { 386, 0, 0, 12, 2, 0 }, { 388, 0, 0, 12, 2, 0 }, { 390, 0, 0, 12, 2, 0 }, { 392, 0, 0, 12, 2, 0 },
+                { 394, 480, 0, 12, 2, 1 }, { 396, 481, 0, 12, 2, 1 }, { 398, 0, 0, 12, 3, 0 }, { 401, 0, 0, 12, 3, 0 },
+                { 404, 0, 0, 12, 2, 0 }, { 406, 0, 0, 12, 2, 0 }, { 408, 0, 0, 12, 2, 0 }, { 410, 0, 0, 12, 2, 0 },
+                { 412, 0, 0, 12, 2, 0 }, { 414, 0, 0, 12, 2, 0 }, { 416, 0, 0, 12, 2, 0 }, { 418, 0, 0, 12, 3, 0 },
+                { 421, 0, 0, 12, 3, 0 }, { 424, 0, 0, 12, 2, 0 }, { 426, 0, 0, 12, 2, 0 }, { 428, 0, 0, 12, 2, 0 },
+                { 430, 0, 0, 12, 2, 0 }, { 432, 0, 0, 12, 2, 0 }, { 434, 0, 0, 12, 2, 0 }, { 436, 0, 0, 12, 2, 0 },
+                { 438, 0, 0, 12, 2, 0 }, { 440, 0, 0, 12, 2, 0 }, { 442, 0, 0, 12, 2, 0 }, { 444, 0, 0, 12, 2, 0 },
+                { 446, 0, 0, 12, 2, 0 }, { 448, 0, 0, 12, 2, 0 }, { 450, 0, 0, 12, 2, 0 }, { 452, 0, 0, 12, 2, 0 },
+                { 454, 0, 0, 12, 2, 0 }, { 456, 0, 0, 12, 2, 0 }, { 458, 0, 0, 12, 2, 0 }, { 460, 0, 0, 12, 2, 0 },
+                { 462, 0, 0, 12, 2, 0 }, { 464, 0, 0, 12, 2, 0 }, { 466, 0, 0, 12, 2, 0 }, { 468, 0, 0, 12, 2, 0 },
+                { 470, 0, 0, 12, 2, 0 }, { 472, 0, 0, 12, 2, 0 }, { 474, 0, 0, 12, 2, 0 }, { 476, 0, 0, 12, 2, 0 },
+                { 478, 0, 0, 12, 2, 0 }, { 480, 0, 0, 12, 2, 0 }, { 482, 0, 0, 12, 2, 0 }, { 484, 0, 0, 12, 2, 0 },
+                { 486, 0, 0, 12, 2, 0 }, { 488, 0, 0, 12, 2, 0 }, { 490, 0, 0, 12, 2, 0 }, { 492, 482, 0, 12, 2, 1 },
+                { 494, 483, 0, 12, 2, 1 }, { 496, 484, 0, 12, 2, 1 }, { 498, 485, 0, 12, 2, 1 }, { 500, 0, 0, 12, 3, 0 },
+                { 503, 0, 0, 12, 3, 0 }, { 506, 0, 0, 12, 3, 0 }, { 509, 0, 0, 12, 3, 0 }, { 512, 486, 0, 12, 2, 1 },
+                { 514, 487, 0, 12, 2, 1 }, { 516, 0, 0, 12, 3, 0 }, { 519, 0, 0, 12, 3, 0 }, { 522, 0, 0, 12, 2, 0 },
+                { 524, 0, 0, 12, 2, 0 }, { 0, 488, 0, 8, 0, 1 }, { 0, 0, 230, 2, 0, 0 }, { 0, 0, 230, 0, 0, 0 },
+                { 0, 0, 232, 0, 0, 0 }, { 0, 0, 220, 0, 0, 0 }, { 0, 0, 216, 2, 0, 0 }, { 0, 0, 202, 0, 0, 0 },
+                { 0, 0, 220, 2, 0, 0 }, { 0, 0, 202, 2, 0, 0 }, { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 2, 0, 0 },
+                { 526, 0, 230, 5, 1, 0 }, { 527, 0, 230, 5, 1, 0 }, { 528, 0, 230, 5, 1, 0 }, { 529, 0, 230, 5, 2, 0 },
+                { 0, 0, 240, 2, 0, 0 }, { 0, 0, 233, 0, 0, 0 }, { 0, 0, 234, 0, 0, 0 }, { 531, 0, 0, 13, 1, 0 },
+                { 532, 0, 0, 13, 1, 0 }, { 533, 0, 0, 12, 2, 0 }, { 535, 0, 0, 12, 2, 0 }, { 537, 0, 0, 13, 1, 0 },
+                { 538, 0, 0, 12, 2, 0 }, { 540, 0, 0, 12, 2, 0 }, { 542, 0, 0, 12, 2, 0 }, { 544, 0, 0, 12, 2, 0 },
+                { 546, 0, 0, 12, 2, 0 }, { 548, 0, 0, 12, 2, 0 }, { 550, 0, 0, 12, 3, 0 }, { 0, 489, 0, 8, 0, 7 },
+                { 0, 496, 0, 8, 0, 4 }, { 0, 500, 0, 8, 0, 5 }, { 0, 505, 0, 8, 0, 7 }, { 0, 512, 0, 8, 0, 4 },
+                { 0, 516, 0, 8, 0, 1 }, { 0, 517, 0, 8, 0, 6 }, { 0, 523, 0, 8, 0, 5 }, { 553, 0, 0, 12, 2, 0 },
+                { 555, 0, 0, 12, 2, 0 }, { 557, 528, 0, 12, 2, 1 }, { 559, 0, 0, 12, 2, 0 }, { 561, 529, 0, 12, 2, 1 },
+                { 563, 0, 0, 12, 2, 0 }, { 565, 0, 0, 12, 3, 0 }, { 0, 530, 0, 8, 0, 8 }, { 0, 538, 0, 8, 0, 4 },
+                { 0, 542, 0, 8, 0, 6 }, { 0, 548, 0, 8, 0, 8 }, { 0, 556, 0, 8, 0, 4 }, { 0, 560, 0, 8, 0, 2 },
+                { 0, 562, 0, 8, 0, 8 }, { 0, 570, 0, 8, 0, 6 }, { 568, 576, 0, 12, 2, 3 }, { 570, 579, 0, 12, 2, 3 },
+                { 572, 0, 0, 12, 2, 0 }, { 574, 0, 0, 12, 2, 0 }, { 576, 582, 0, 12, 2, 1 }, { 0, 583, 0, 8, 0, 2 },
+                { 578, 0, 0, 12, 2, 0 }, { 580, 0, 0, 12, 2, 0 }, { 582, 0, 0, 12, 2, 0 }, { 584, 0, 0, 12, 2, 0 },
+                { 586, 0, 0, 12, 2, 0 }, { 0, 585, 0, 8, 0, 1 }, { 588, 0, 0, 12, 2, 0 }, { 590, 0, 0, 12, 2, 0 },
+                { 592, 0, 0, 12, 2, 0 }, { 594, 0, 0, 12, 2, 0 }, { 0, 586, 0, 8, 0, 2 }, { 0, 588, 0, 8, 0, 1 },
+                { 0, 589, 0, 8, 0, 3 }, { 0, 592, 0, 8, 0, 2 }, { 0, 594, 0, 8, 0, 1 }, { 0, 595, 0, 8, 0, 4 },
+                { 596, 0, 0, 12, 2, 0 }, { 0, 599, 0, 8, 0, 1 }, { 0, 600, 0, 8, 0, 1 }, { 0, 601, 0, 8, 0, 4 },
+                { 0, 605, 0, 8, 0, 1 }, { 0, 606, 0, 8, 0, 1 }, { 0, 607, 0, 8, 0, 1 }, { 0, 608, 0, 8, 0, 2 },
+                { 0, 610, 0, 8, 0, 1 }, { 0, 611, 0, 8, 0, 3 }, { 0, 614, 0, 8, 0, 2 }, { 0, 616, 0, 8, 0, 1 },
+                { 0, 617, 0, 8, 0, 4 }, { 598, 0, 0, 12, 2, 0 }, { 0, 621, 0, 8, 0, 1 }, { 0, 622, 0, 8, 0, 1 },
+                { 0, 623, 0, 8, 0, 4 }, { 0, 627, 0, 8, 0, 1 }, { 0, 628, 0, 8, 0, 1 }, { 0, 629, 0, 8, 0, 1 },
+                { 600, 0, 0, 12, 2, 0 }, { 602, 0, 0, 12, 2, 0 }, { 604, 0, 0, 12, 2, 0 }, { 0, 630, 0, 8, 0, 1 },
+                { 606, 0, 0, 12, 2, 0 }, { 608, 0, 0, 12, 2, 0 }, { 610, 0, 0, 12, 2, 0 }, { 612, 0, 0, 12, 2, 0 },
+                { 0, 631, 0, 8, 0, 1 }, { 0, 632, 0, 8, 0, 1 }, { 614, 0, 0, 12, 2, 0 }, { 616, 0, 0, 12, 2, 0 },
+                { 618, 0, 0, 12, 2, 0 }, { 620, 0, 0, 12, 2, 0 }, { 622, 0, 0, 12, 2, 0 }, { 624, 0, 0, 12, 2, 0 },
+                { 626, 0, 0, 12, 2, 0 }, { 628, 0, 0, 12, 2, 0 }, { 630, 0, 0, 12, 2, 0 }, { 632, 0, 0, 12, 2, 0 },
+                { 0, 633, 0, 8, 0, 1 }, { 0, 634, 0, 8, 0, 1 }, { 634, 0, 0, 12, 2, 0 }, { 636, 0, 0, 12, 2, 0 },
+                { 638, 0, 0, 12, 2, 0 }, { 640, 0, 0, 12, 2, 0 }, { 642, 0, 0, 12, 2, 0 }, { 644, 0, 0, 12, 2, 0 },
+                { 646, 0, 0, 12, 2, 0 }, { 648, 0, 0, 12, 2, 0 }, { 650, 0, 0, 12, 2, 0 }, { 652, 0, 0, 12, 2, 0 },
+                { 654, 0, 0, 12, 2, 0 }, { 656, 0, 0, 12, 2, 0 }, { 0, 635, 0, 8, 0, 1 }, { 0, 636, 0, 8, 0, 1 },
+                { 658, 0, 0, 12, 2, 0 }, { 660, 0, 0, 12, 2, 0 }, { 662, 0, 0, 12, 2, 0 }, { 664, 0, 0, 12, 2, 0 },
+                { 666, 0, 0, 12, 2, 0 }, { 668, 0, 0, 12, 2, 0 }, { 670, 0, 0, 12, 2, 0 }, { 672, 0, 0, 12, 2, 0 },
+                { 674, 0, 0, 12, 2, 0 }, { 676, 0, 0, 12, 2, 0 }, { 678, 0, 0, 12, 2, 0 }, { 680, 0, 0, 12, 2, 0 },
+                { 682, 0, 0, 12, 2, 0 }, { 684, 0, 0, 12, 2, 0 }, { 0, 0, 222, 0, 0, 0 }, { 0, 0, 228, 0, 0, 0 },
+                { 0, 0, 10, 0, 0, 0 }, { 0, 0, 11, 0, 0, 0 }, { 0, 0, 12, 0, 0, 0 }, { 0, 0, 13, 0, 0, 0 },
+                { 0, 0, 14, 0, 0, 0 }, { 0, 0, 15, 0, 0, 0 }, { 0, 0, 16, 0, 0, 0 }, { 0, 0, 17, 0, 0, 0 },
+                { 0, 0, 18, 0, 0, 0 }, { 0, 0, 19, 0, 0, 0 }, { 0, 0, 20, 0, 0, 0 }, { 0, 0, 21, 0, 0, 0 },
+                { 0, 0, 22, 0, 0, 0 }, { 0, 0, 23, 0, 0, 0 }, { 0, 0, 24, 0, 0, 0 }, { 0, 0, 25, 0, 0, 0 },
+                { 0, 0, 30, 0, 0, 0 }, { 0, 0, 31, 0, 0, 0 }, { 0, 0, 32, 0, 0, 0 }, { 686, 0, 0, 12, 2, 0 },
+                { 688, 0, 0, 12, 2, 0 }, { 690, 0, 0, 12, 2, 0 }, { 692, 0, 0, 12, 2, 0 }, { 694, 0, 0, 12, 2, 0 },
+                { 0, 637, 0, 8, 0, 3 }, { 0, 640, 0, 8, 0, 1 }, { 0, 641, 0, 8, 0, 1 }, { 0, 0, 27, 0, 0, 0 },
+                { 0, 0, 28, 0, 0, 0 }, { 0, 0, 29, 0, 0, 0 }, { 0, 0, 33, 0, 0, 0 }, { 0, 0, 34, 0, 0, 0 },
+                { 0, 0, 35, 0, 0, 0 }, { 696, 0, 0, 12, 2, 0 }, { 0, 642, 0, 8, 0, 1 }, { 698, 0, 0, 12, 2, 0 },
+                { 0, 643, 0, 8, 0, 1 }, { 700, 0, 0, 12, 2, 0 }, { 0, 644, 0, 8, 0, 1 }, { 0, 0, 36, 0, 0, 0 },
+                { 0, 645, 0, 8, 0, 1 }, { 702, 0, 0, 12, 2, 0 }, { 0, 646, 0, 8, 0, 1 }, { 704, 0, 0, 12, 2, 0 },
+                { 0, 647, 0, 8, 0, 1 }, { 706, 0, 0, 12, 2, 0 }, { 0, 0, 7, 2, 0, 0 }, { 0, 0, 9, 0, 0, 0 },
+                { 708, 0, 0, 13, 2, 0 }, { 710, 0, 0, 13, 2, 0 }, { 712, 0, 0, 13, 2, 0 }, { 714, 0, 0, 13, 2, 0 },
+                { 716, 0, 0, 13, 2, 0 }, { 718, 0, 0, 13, 2, 0 }, { 720, 0, 0, 13, 2, 0 }, { 722, 0, 0, 13, 2, 0 },
+                { 0, 0, 7, 0, 0, 0 }, { 0, 0, 0, 10, 0, 0 }, { 0, 648, 0, 8, 0, 2 }, { 724, 0, 0, 12, 2, 0 },
+                { 726, 0, 0, 12, 2, 0 }, { 728, 0, 0, 13, 2, 0 }, { 730, 0, 0, 13, 2, 0 }, { 732, 0, 0, 13, 2, 0 },
+                { 734, 0, 0, 13, 2, 0 }, { 736, 0, 0, 13, 2, 0 }, { 738, 0, 0, 13, 2, 0 }, { 740, 0, 0, 13, 2, 0 },
+                { 742, 0, 0, 13, 2, 0 }, { 744, 0, 0, 13, 2, 0 }, { 0, 650, 0, 8, 0, 3 }, { 746, 0, 0, 12, 2, 0 },
+                { 748, 0, 0, 12, 2, 0 }, { 750, 0, 0, 12, 2, 0 }, { 752, 0, 0, 13, 2, 0 }, { 754, 0, 0, 13, 2, 0 },
+                { 0, 653, 0, 8, 0, 1 }, { 756, 0, 0, 12, 2, 0 }, { 0, 654, 0, 8, 0, 2 }, { 0, 656, 0, 8, 0, 1 },
+                { 758, 0, 0, 12, 2, 0 }, { 760, 0, 0, 12, 2, 0 }, { 762, 0, 0, 12, 2, 0 }, { 0, 657, 0, 8, 0, 1 },
+                { 764, 0, 0, 12, 2, 0 }, { 0, 0, 84, 0, 0, 0 }, { 0, 0, 91, 2, 0, 0 }, { 0, 658, 0, 8, 0, 1 },
+                { 766, 0, 0, 12, 2, 0 }, { 0, 659, 0, 8, 0, 3 }, { 768, 0, 0, 12, 2, 0 }, { 770, 0, 0, 12, 2, 0 },
+                { 772, 662, 0, 12, 2, 1 }, { 774, 0, 0, 12, 3, 0 }, { 0, 663, 0, 8, 0, 2 }, { 0, 665, 0, 8, 0, 1 },
+                { 777, 0, 0, 12, 2, 0 }, { 779, 0, 0, 12, 2, 0 }, { 781, 0, 0, 12, 2, 0 }, { 0, 0, 9, 2, 0, 0 },
+                { 0, 666, 0, 8, 0, 3 }, { 783, 0, 0, 12, 2, 0 }, { 785, 669, 0, 12, 2, 1 }, { 787, 0, 0, 12, 3, 0 },
+                { 790, 0, 0, 12, 2, 0 }, { 0, 0, 103, 0, 0, 0 }, { 0, 0, 107, 0, 0, 0 }, { 0, 0, 118, 0, 0, 0 },
+                { 0, 0, 122, 0, 0, 0 }, { 0, 0, 216, 0, 0, 0 }, { 792, 0, 0, 13, 2, 0 }, { 794, 0, 0, 13, 2, 0 },
+                { 796, 0, 0, 13, 2, 0 }, { 798, 0, 0, 13, 2, 0 }, { 800, 0, 0, 13, 2, 0 }, { 802, 0, 0, 13, 2, 0 },
+                { 0, 0, 129, 0, 0, 0 }, { 0, 0, 130, 0, 0, 0 }, { 804, 0, 0, 5, 2, 0 }, { 0, 0, 132, 0, 0, 0 },
+                { 806, 0, 0, 5, 2, 0 }, { 808, 0, 0, 13, 2, 0 }, { 810, 0, 0, 13, 2, 0 }, { 812, 0, 0, 5, 2, 0 },
+                { 814, 0, 0, 13, 2, 0 }, { 816, 0, 0, 13, 2, 0 }, { 818, 0, 0, 13, 2, 0 }, { 820, 0, 0, 13, 2, 0 },
+                { 822, 0, 0, 13, 2, 0 }, { 824, 0, 0, 13, 2, 0 }, { 0, 670, 0, 8, 0, 1 }, { 826, 0, 0, 12, 2, 0 },
+                { 0, 671, 0, 8, 0, 1 }, { 828, 0, 0, 12, 2, 0 }, { 0, 672, 0, 8, 0, 1 }, { 830, 0, 0, 12, 2, 0 },
+                { 0, 673, 0, 8, 0, 1 }, { 832, 0, 0, 12, 2, 0 }, { 0, 674, 0, 8, 0, 1 }, { 834, 0, 0, 12, 2, 0 },
+                { 0, 675, 0, 8, 0, 1 }, { 836, 0, 0, 12, 2, 0 }, { 0, 676, 0, 8, 0, 1 }, { 838, 0, 0, 12, 2, 0 },
+                { 0, 677, 0, 8, 0, 1 }, { 840, 0, 0, 12, 2, 0 }, { 0, 678, 0, 8, 0, 1 }, { 842, 0, 0, 12, 2, 0 },
+                { 0, 679, 0, 8, 0, 1 }, { 0, 680, 0, 8, 0, 1 }, { 844, 0, 0, 12, 2, 0 }, { 846, 0, 0, 12, 2, 0 },
+                { 0, 681, 0, 8, 0, 1 }, { 848, 0, 0, 12, 2, 0 }, { 0, 0, 214, 0, 0, 0 }, { 0, 0, 218, 0, 0, 0 },
+                { 850, 0, 0, 12, 2, 0 }, { 852, 0, 0, 12, 2, 0 }, { 854, 0, 0, 12, 2, 0 }, { 856, 0, 0, 12, 2, 0 },
+                { 858, 0, 0, 12, 2, 0 }, { 860, 0, 0, 12, 2, 0 }, { 862, 0, 0, 12, 2, 0 }, { 864, 0, 0, 12, 2, 0 },
+                { 866, 0, 0, 12, 3, 0 }, { 869, 0, 0, 12, 3, 0 }, { 872, 0, 0, 12, 2, 0 }, { 874, 0, 0, 12, 2, 0 },
+                { 876, 0, 0, 12, 2, 0 }, { 878, 0, 0, 12, 2, 0 }, { 880, 0, 0, 12, 2, 0 }, { 882, 0, 0, 12, 2, 0 },
+                { 884, 0, 0, 12, 2, 0 }, { 886, 0, 0, 12, 2, 0 }, { 888, 0, 0, 12, 2, 0 }, { 890, 0, 0, 12, 2, 0 },
+                { 892, 0, 0, 12, 3, 0 }, { 895, 0, 0, 12, 3, 0 }, { 898, 0, 0, 12, 3, 0 }, { 901, 0, 0, 12, 3, 0 },
+                { 904, 0, 0, 12, 2, 0 }, { 906, 0, 0, 12, 2, 0 }, { 908, 0, 0, 12, 2, 0 }, { 910, 0, 0, 12, 2, 0 },
+                { 912, 0, 0, 12, 3, 0 }, { 915, 0, 0, 12, 3, 0 }, { 918, 0, 0, 12, 2, 0 }, { 920, 0, 0, 12, 2, 0 },
+                { 922, 0, 0, 12, 2, 0 }, { 924, 0, 0, 12, 2, 0 }, { 926, 0, 0, 12, 2, 0 }, { 928, 0, 0, 12, 2, 0 },
+                { 930, 0, 0, 12, 2, 0 }, { 932, 0, 0, 12, 2, 0 }, { 934, 0, 0, 12, 2, 0 }, { 936, 0, 0, 12, 2, 0 },
+                { 938, 0, 0, 12, 2, 0 }, { 940, 0, 0, 12, 2, 0 }, { 942, 0, 0, 12, 2, 0 }, { 944, 0, 0, 12, 2, 0 },
+                { 946, 0, 0, 12, 2, 0 }, { 948, 0, 0, 12, 2, 0 }, { 950, 0, 0, 12, 3, 0 }, { 953, 0, 0, 12, 3, 0 },
+                { 956, 0, 0, 12, 2, 0 }, { 958, 0, 0, 12, 2, 0 }, { 960, 0, 0, 12, 2, 0 }, { 962, 0, 0, 12, 2, 0 },
+                { 964, 0, 0, 12, 2, 0 }, { 966, 0, 0, 12, 2, 0 }, { 968, 682, 0, 12, 2, 1 }, { 970, 683, 0, 12, 2, 1 },
+                { 972, 0, 0, 12, 3, 0 }, { 975, 0, 0, 12, 3, 0 }, { 978, 0, 0, 12, 2, 0 }, { 980, 0, 0, 12, 2, 0 },
+                { 982, 0, 0, 12, 2, 0 }, { 984, 0, 0, 12, 2, 0 }, { 986, 0, 0, 12, 2, 0 }, { 988, 0, 0, 12, 2, 0 },
+                { 990, 0, 0, 12, 2, 0 }, { 992, 0, 0, 12, 2, 0 }, { 994, 0, 0, 12, 2, 0 }, { 996, 0, 0, 12, 2, 0 },
+                { 998, 0, 0, 12, 2, 0 }, { 1000, 0, 0, 12, 2, 0 }, { 1002, 0, 0, 12, 2, 0 }, { 1004, 0, 0, 12, 2, 0 },
+                { 1006, 0, 0, 12, 2, 0 }, { 1008, 0, 0, 12, 2, 0 }, { 1010, 0, 0, 12, 2, 0 }, { 1012, 0, 0, 12, 2, 0 },
+                { 1014, 0, 0, 12, 3, 0 }, { 1017, 0, 0, 12, 3, 0 }, { 1020, 0, 0, 12, 3, 0 }, { 1023, 0, 0, 12, 3, 0 },
+                { 1026, 0, 0, 12, 3, 0 }, { 1029, 0, 0, 12, 3, 0 }, { 1032, 0, 0, 12, 3, 0 }, { 1035, 0, 0, 12, 3, 0 },
+                { 1038, 0, 0, 12, 2, 0 }, { 1040, 0, 0, 12, 2, 0 }, { 1042, 0, 0, 12, 2, 0 }, { 1044, 0, 0, 12, 2, 0 },
+                { 1046, 0, 0, 12, 2, 0 }, { 1048, 0, 0, 12, 2, 0 }, { 1050, 684, 0, 12, 2, 1 }, { 1052, 685, 0, 12, 2, 1 },
+                { 1054, 0, 0, 12, 3, 0 }, { 1057, 0, 0, 12, 3, 0 }, { 1060, 0, 0, 12, 2, 0 }, { 1062, 0, 0, 12, 2, 0 },
+                { 1064, 0, 0, 12, 2, 0 }, { 1066, 0, 0, 12, 2, 0 }, { 1068, 686, 0, 12, 2, 1 }, { 1070, 687, 0, 12, 2, 1 },
+                { 1072, 0, 0, 12, 3, 0 }, { 1075, 0, 0, 12, 3, 0 }, { 1078, 0, 0, 12, 3, 0 }, { 1081, 0, 0, 12, 3, 0 },
+                { 1084, 0, 0, 12, 3, 0 }, { 1087, 0, 0, 12, 3, 0 }, { 1090, 0, 0, 12, 2, 0 }, { 1092, 0, 0, 12, 2, 0 },
+                { 1094, 0, 0, 12, 2, 0 }, { 1096, 0, 0, 12, 2, 0 }, { 1098, 0, 0, 12, 2, 0 }, { 1100, 0, 0, 12, 2, 0 },
+                { 1102, 0, 0, 12, 2, 0 }, { 1104, 0, 0, 12, 2, 0 }, { 1106, 0, 0, 12, 2, 0 }, { 1108, 0, 0, 12, 2, 0 },
+                { 1110, 0, 0, 12, 2, 0 }, { 1112, 0, 0, 12, 2, 0 }, { 1114, 0, 0, 12, 2, 0 }, { 1116, 0, 0, 12, 2, 0 },
+                { 1118, 0, 0, 12, 3, 0 }, { 1121, 0, 0, 12, 3, 0 }, { 1124, 0, 0, 12, 3, 0 }, { 1127, 0, 0, 12, 3, 0 },
+                { 1130, 0, 0, 12, 2, 0 }, { 1132, 0, 0, 12, 2, 0 }, { 1134, 0, 0, 12, 2, 0 }, { 1136, 0, 0, 12, 2, 0 },
+                { 1138, 0, 0, 12, 2, 0 }, { 1140, 0, 0, 12, 2, 0 }, { 1142, 0, 0, 12, 2, 0 }, { 1144, 0, 0, 12, 2, 0 },
+                { 1146, 0, 0, 12, 2, 0 }, { 1148, 0, 0, 12, 2, 0 }, { 1150, 0, 0, 12, 2, 0 }, { 1152, 0, 0, 12, 2, 0 },
+                { 1154, 0, 0, 12, 2, 0 }, { 1156, 0, 0, 12, 2, 0 }, { 1158, 0, 0, 12, 2, 0 }, { 1160, 0, 0, 12, 2, 0 },
+                { 1162, 0, 0, 12, 2, 0 }, { 1164, 0, 0, 12, 2, 0 }, { 1166, 0, 0, 12, 2, 0 }, { 1168, 0, 0, 12, 2, 0 },
+                { 1170, 0, 0, 12, 2, 0 }, { 1172, 0, 0, 12, 2, 0 }, { 1174, 0, 0, 12, 2, 0 }, { 1176, 0, 0, 12, 2, 0 },
+                { 1178, 0, 0, 12, 2, 0 }, { 1180, 0, 0, 12, 2, 0 }, { 1182, 0, 0, 12, 2, 0 }, { 1184, 0, 0, 12, 2, 0 },
+                { 1186, 0, 0, 12, 2, 0 }, { 1188, 0, 0, 12, 2, 0 }, { 1190, 0, 0, 12, 2, 0 }, { 1192, 688, 0, 12, 2, 2 },
+                { 1194, 690, 0, 12, 2, 2 }, { 1196, 0, 0, 12, 2, 0 }, { 1198, 0, 0, 12, 2, 0 }, { 1200, 0, 0, 12, 3, 0 },
+                { 1203, 0, 0, 12, 3, 0 }, { 1206, 0, 0, 12, 3, 0 }, { 1209, 0, 0, 12, 3, 0 }, { 1212, 0, 0, 12, 3, 0 },
+                { 1215, 0, 0, 12, 3, 0 }, { 1218, 0, 0, 12, 3, 0 }, { 1221, 0, 0, 12, 3, 0 }, { 1224, 0, 0, 12, 3, 0 },
+                { 1227, 0, 0, 12, 3, 0 }, { 1230, 0, 0, 12, 3, 0 }, { 1233, 0, 0, 12, 3, 0 }, { 1236, 0, 0, 12, 3, 0 },
+                { 1239, 0, 0, 12, 3, 0 }, { 1242, 0, 0, 12, 3, 0 }, { 1245, 0, 0, 12, 3, 0 }, { 1248, 0, 0, 12, 3, 0 },
+                { 1251, 0, 0, 12, 3, 0 }, { 1254, 0, 0, 12, 3, 0 }, { 1257, 0, 0, 12, 3, 0 }, { 1260, 692, 0, 12, 2, 1 },
+                { 1262, 693, 0, 12, 2, 1 }, { 1264, 0, 0, 12, 2, 0 }, { 1266, 0, 0, 12, 2, 0 }, { 1268, 0, 0, 12, 2, 0 },
+                { 1270, 0, 0, 12, 2, 0 }, { 1272, 0, 0, 12, 3, 0 }, { 1275, 0, 0, 12, 3, 0 }, { 1278, 0, 0, 12, 3, 0 },
+                { 1281, 0, 0, 12, 3, 0 }, { 1284, 0, 0, 12, 3, 0 }, { 1287, 0, 0, 12, 3, 0 }, { 1290, 0, 0, 12, 3, 0 },
+                { 1293, 0, 0, 12, 3, 0 }, { 1296, 0, 0, 12, 3, 0 }, { 1299, 0, 0, 12, 3, 0 }, { 1302, 0, 0, 12, 2, 0 },
+                { 1304, 0, 0, 12, 2, 0 }, { 1306, 0, 0, 12, 2, 0 }, { 1308, 0, 0, 12, 2, 0 }, { 1310, 694, 0, 12, 2, 1 },
+                { 1312, 695, 0, 12, 2, 1 }, { 1314, 0, 0, 12, 2, 0 }, { 1316, 0, 0, 12, 2, 0 }, { 1318, 0, 0, 12, 3, 0 },
+                { 1321, 0, 0, 12, 3, 0 }, { 1324, 0, 0, 12, 3, 0 }, { 1327, 0, 0, 12, 3, 0 }, { 1330, 0, 0, 12, 3, 0 },
+                { 1333, 0, 0, 12, 3, 0 }, { 1336, 0, 0, 12, 3, 0 }, { 1339, 0, 0, 12, 3, 0 }, { 1342, 0, 0, 12, 3, 0 },
+                { 1345, 0, 0, 12, 3, 0 }, { 1348, 0, 0, 12, 3, 0 }, { 1351, 0, 0, 12, 3, 0 }, { 1354, 0, 0, 12, 3, 0 },
+                { 1357, 0, 0, 12, 3, 0 }, { 1360, 0, 0, 12, 3, 0 }, { 1363, 0, 0, 12, 3, 0 }, { 1366, 0, 0, 12, 3, 0 },
+                { 1369, 0, 0, 12, 3, 0 }, { 1372, 0, 0, 12, 3, 0 }, { 1375, 0, 0, 12, 3, 0 }, { 1378, 0, 0, 12, 2, 0 },
+                { 1380, 0, 0, 12, 2, 0 }, { 1382, 0, 0, 12, 2, 0 }, { 1384, 0, 0, 12, 2, 0 }, { 1386, 0, 0, 12, 3, 0 },
+                { 1389, 0, 0, 12, 3, 0 }, { 1392, 0, 0, 12, 3, 0 }, { 1395, 0, 0, 12, 3, 0 }, { 1398, 0, 0, 12, 3, 0 },
+                { 1401, 0, 0, 12, 3, 0 }, { 1404, 0, 0, 12, 3, 0 }, { 1407, 0, 0, 12, 3, 0 }, { 1410, 0, 0, 12, 3, 0 },
+                { 1413, 0, 0, 12, 3, 0 }, { 1416, 0, 0, 12, 2, 0 }, { 1418, 0, 0, 12, 2, 0 }, { 1420, 0, 0, 12, 2, 0 },
+                { 1422, 0, 0, 12, 2, 0 }, { 1424, 0, 0, 12, 2, 0 }, { 1426, 0, 0, 12, 2, 0 }, { 1428, 0, 0, 12, 2, 0 },
+                { 1430, 0, 0, 12, 2, 0 }, { 1432, 696, 0, 12, 2, 4 }, { 1434, 700, 0, 12, 2, 4 }, { 1436, 704, 0, 12, 3, 1 },
+                { 1439, 705, 0, 12, 3, 1 }, { 1442, 706, 0, 12, 3, 1 }, { 1445, 707, 0, 12, 3, 1 }, { 1448, 708, 0, 12, 3, 1 },
+                { 1451, 709, 0, 12, 3, 1 }, { 1454, 710, 0, 12, 2, 4 }, { 1456, 714, 0, 12, 2, 4 }, { 1458, 718, 0, 12, 3, 1 },
+                { 1461, 719, 0, 12, 3, 1 }, { 1464, 720, 0, 12, 3, 1 }, { 1467, 721, 0, 12, 3, 1 }, { 1470, 722, 0, 12, 3, 1 },
+                { 1473, 723, 0, 12, 3, 1 }, { 1476, 724, 0, 12, 2, 2 }, { 1478, 726, 0, 12, 2, 2 }, { 1480, 0, 0, 12, 3, 0 },
+                { 1483, 0, 0, 12, 3, 0 }, { 1486, 0, 0, 12, 3, 0 }, { 1489, 0, 0, 12, 3, 0 }, { 1492, 728, 0, 12, 2, 2 },
+                { 1494, 730, 0, 12, 2, 2 }, { 1496, 0, 0, 12, 3, 0 }, { 1499, 0, 0, 12, 3, 0 }, { 1502, 0, 0, 12, 3, 0 },
+                { 1505, 0, 0, 12, 3, 0 }, { 1508, 732, 0, 12, 2, 4 }, { 1510, 736, 0, 12, 2, 4 }, { 1512, 740, 0, 12, 3, 1 },
+                { 1515, 741, 0, 12, 3, 1 }, { 1518, 742, 0, 12, 3, 1 }, { 1521, 743, 0, 12, 3, 1 }, { 1524, 744, 0, 12, 3, 1 },
+                { 1527, 745, 0, 12, 3, 1 }, { 1530, 746, 0, 12, 2, 4 }, { 1532, 750, 0, 12, 2, 4 }, { 1534, 754, 0, 12, 3, 1 },
+                { 1537, 755, 0, 12, 3, 1 }, { 1540, 756, 0, 12, 3, 1 }, { 1543, 757, 0, 12, 3, 1 }, { 1546, 758, 0, 12, 3, 1 },
+                { 1549, 759, 0, 12, 3, 1 }, { 1552, 760, 0, 12, 2, 3 }, { 1554, 763, 0, 12, 2, 3 }, { 1556, 0, 0, 12, 3, 0 },
+                { 1559, 0, 0, 12, 3, 0 }, { 1562, 0, 0, 12, 3, 0 }, { 1565, 0, 0, 12, 3, 0 }, { 1568, 0, 0, 12, 3, 0 },
+                { 1571, 0, 0, 12, 3, 0 }, { 1574, 766, 0, 12, 2, 3 }, { 1576, 769, 0, 12, 2, 3 }, { 1578, 0, 0, 12, 3, 0 },
+                { 1581, 0, 0, 12, 3, 0 }, { 1584, 0, 0, 12, 3, 0 }, { 1587, 0, 0, 12, 3, 0 }, { 1590, 0, 0, 12, 3, 0 },
+                { 1593, 0, 0, 12, 3, 0 }, { 1596, 772, 0, 12, 2, 2 }, { 1598, 774, 0, 12, 2, 2 }, { 1600, 0, 0, 12, 3, 0 },
+                { 1603, 0, 0, 12, 3, 0 }, { 1606, 0, 0, 12, 3, 0 }, { 1609, 0, 0, 12, 3, 0 }, { 1612, 776, 0, 12, 2, 2 },
+                { 1614, 778, 0, 12, 2, 2 }, { 1616, 0, 0, 12, 3, 0 }, { 1619, 0, 0, 12, 3, 0 }, { 1622, 0, 0, 12, 3, 0 },
+                { 1625, 0, 0, 12, 3, 0 }, { 1628, 780, 0, 12, 2, 3 }, { 1630, 783, 0, 12, 2, 3 }, { 1632, 0, 0, 12, 3, 0 },
+                { 1635, 0, 0, 12, 3, 0 }, { 1638, 0, 0, 12, 3, 0 }, { 1641, 0, 0, 12, 3, 0 }, { 1644, 0, 0, 12, 3, 0 },
+                { 1647, 0, 0, 12, 3, 0 }, { 1650, 786, 0, 12, 2, 3 }, { 1652, 0, 0, 12, 3, 0 }, { 1655, 0, 0, 12, 3, 0 },
+                { 1658, 0, 0, 12, 3, 0 }, { 1661, 789, 0, 12, 2, 4 }, { 1663, 793, 0, 12, 2, 4 }, { 1665, 797, 0, 12, 3, 1 },
+                { 1668, 798, 0, 12, 3, 1 }, { 1671, 799, 0, 12, 3, 1 }, { 1674, 800, 0, 12, 3, 1 }, { 1677, 801, 0, 12, 3, 1 },
+                { 1680, 802, 0, 12, 3, 1 }, { 1683, 803, 0, 12, 2, 4 }, { 1685, 807, 0, 12, 2, 4 }, { 1687, 811, 0, 12, 3, 1 },
+                { 1690, 812, 0, 12, 3, 1 }, { 1693, 813, 0, 12, 3, 1 }, { 1696, 814, 0, 12, 3, 1 }, { 1699, 815, 0, 12, 3, 1 },
+                { 1702, 816, 0, 12, 3, 1 }, { 1705, 817, 0, 12, 2, 1 }, { 1707, 0, 0, 13, 2, 0 }, { 1709, 0, 0, 12, 2, 0 },
+                { 1711, 0, 0, 13, 2, 0 }, { 1713, 818, 0, 12, 2, 1 }, { 1715, 0, 0, 13, 2, 0 }, { 1717, 0, 0, 12, 2, 0 },
+                { 1719, 0, 0, 13, 2, 0 }, { 1721, 0, 0, 12, 2, 0 }, { 1723, 0, 0, 13, 2, 0 }, { 1725, 0, 0, 12, 2, 0 },
+                { 1727, 0, 0, 13, 2, 0 }, { 1729, 819, 0, 12, 2, 1 }, { 1731, 0, 0, 13, 2, 0 }, { 1733, 0, 0, 12, 3, 0 },
+                { 1736, 0, 0, 12, 3, 0 }, { 1739, 0, 0, 12, 4, 0 }, { 1743, 0, 0, 12, 4, 0 }, { 1747, 0, 0, 12, 4, 0 },
+                { 1751, 0, 0, 12, 4, 0 }, { 1755, 0, 0, 12, 4, 0 }, { 1759, 0, 0, 12, 4, 0 }, { 1763, 0, 0, 12, 3, 0 },
+                { 1766, 0, 0, 12, 3, 0 }, { 1769, 0, 0, 12, 4, 0 }, { 1773, 0, 0, 12, 4, 0 }, { 1777, 0, 0, 12, 4, 0 },
+                { 1781, 0, 0, 12, 4, 0 }, { 1785, 0, 0, 12, 4, 0 }, { 1789, 0, 0, 12, 4, 0 }, { 1793, 0, 0, 12, 3, 0 },
+                { 1796, 0, 0, 12, 3, 0 }, { 1799, 0, 0, 12, 4, 0 }, { 1803, 0, 0, 12, 4, 0 }, { 1807, 0, 0, 12, 4, 0 },
+                { 1811, 0, 0, 12, 4, 0 }, { 1815, 0, 0, 12, 4, 0 }, { 1819, 0, 0, 12, 4, 0 }, { 1823, 0, 0, 12, 3, 0 },
+                { 1826, 0, 0, 12, 3, 0 }, { 1829, 0, 0, 12, 4, 0 }, { 1833, 0, 0, 12, 4, 0 }, { 1837, 0, 0, 12, 4, 0 },
+                { 1841, 0, 0, 12, 4, 0 }, { 1845, 0, 0, 12, 4, 0 }, { 1849, 0, 0, 12, 4, 0 }, { 1853, 0, 0, 12, 3, 0 },
+                { 1856, 0, 0, 12, 3, 0 }, { 1859, 0, 0, 12, 4, 0 }, { 1863, 0, 0, 12, 4, 0 }, { 1867, 0, 0, 12, 4, 0 },
+                { 1871, 0, 0, 12, 4, 0 }, { 1875, 0, 0, 12, 4, 0 }, { 1879, 0, 0, 12, 4, 0 }, { 1883, 0, 0, 12, 3, 0 },
+                { 1886, 0, 0, 12, 3, 0 }, { 1889, 0, 0, 12, 4, 0 }, { 1893, 0, 0, 12, 4, 0 }, { 1897, 0, 0, 12, 4, 0 },
+                { 1901, 0, 0, 12, 4, 0 }, { 1905, 0, 0, 12, 4, 0 }, { 1909, 0, 0, 12, 4, 0 }, { 1913, 0, 0, 12, 2, 0 },
+                { 1915, 0, 0, 12, 2, 0 }, { 1917, 0, 0, 12, 3, 0 }, { 1920, 0, 0, 12, 2, 0 }, { 1922, 0, 0, 12, 3, 0 },
+                { 1925, 820, 0, 12, 2, 1 }, { 1927, 0, 0, 12, 3, 0 }, { 1930, 0, 0, 12, 2, 0 }, { 1932, 0, 0, 12, 2, 0 },
+                { 1934, 0, 0, 12, 2, 0 }, { 1936, 0, 0, 13, 2, 0 }, { 1938, 0, 0, 12, 2, 0 }, { 1940, 0, 0, 13, 1, 0 },
+                { 0, 821, 0, 8, 0, 3 }, { 1941, 0, 0, 12, 2, 0 }, { 1943, 0, 0, 12, 3, 0 }, { 1946, 0, 0, 12, 2, 0 },
+                { 1948, 0, 0, 12, 3, 0 }, { 1951, 824, 0, 12, 2, 1 }, { 1953, 0, 0, 12, 3, 0 }, { 1956, 0, 0, 12, 2, 0 },
+                { 1958, 0, 0, 13, 2, 0 }, { 1960, 0, 0, 12, 2, 0 }, { 1962, 0, 0, 13, 2, 0 }, { 1964, 0, 0, 12, 2, 0 },
+                { 1966, 0, 0, 12, 2, 0 }, { 1968, 0, 0, 12, 2, 0 }, { 1970, 0, 0, 12, 2, 0 }, { 1972, 0, 0, 12, 2, 0 },
+                { 1974, 0, 0, 12, 2, 0 }, { 1976, 0, 0, 12, 3, 0 }, { 1979, 0, 0, 13, 3, 0 }, { 1982, 0, 0, 12, 2, 0 },
+                { 1984, 0, 0, 12, 3, 0 }, { 1987, 0, 0, 12, 2, 0 }, { 1989, 0, 0, 12, 2, 0 }, { 1991, 0, 0, 12, 2, 0 },
+                { 1993, 0, 0, 13, 2, 0 }, { 1995, 0, 0, 12, 2, 0 }, { 1997, 0, 0, 12, 2, 0 }, { 1999, 0, 0, 12, 2, 0 },
+                { 2001, 0, 0, 12, 2, 0 }, { 2003, 0, 0, 12, 2, 0 }, { 2005, 0, 0, 12, 3, 0 }, { 2008, 0, 0, 13, 3, 0 },
+                { 2011, 0, 0, 12, 2, 0 }, { 2013, 0, 0, 12, 2, 0 }, { 2015, 0, 0, 12, 2, 0 }, { 2017, 0, 0, 12, 3, 0 },
+                { 2020, 0, 0, 12, 2, 0 }, { 2022, 0, 0, 12, 2, 0 }, { 2024, 0, 0, 12, 2, 0 }, { 2026, 0, 0, 13, 2, 0 },
+                { 2028, 0, 0, 12, 2, 0 }, { 2030, 0, 0, 12, 2, 0 }, { 2032, 0, 0, 13, 2, 0 }, { 2034, 0, 0, 13, 1, 0 },
+                { 2035, 0, 0, 12, 3, 0 }, { 2038, 0, 0, 12, 2, 0 }, { 2040, 0, 0, 12, 3, 0 }, { 2043, 825, 0, 12, 2, 1 },
+                { 2045, 0, 0, 12, 3, 0 }, { 2048, 0, 0, 12, 2, 0 }, { 2050, 0, 0, 13, 2, 0 }, { 2052, 0, 0, 12, 2, 0 },
+                { 2054, 0, 0, 13, 2, 0 }, { 2056, 0, 0, 12, 2, 0 }, { 2058, 0, 0, 13, 1, 0 }, { 0, 826, 0, 8, 0, 3 },
+                { 2059, 0, 0, 13, 1, 0 }, { 2060, 0, 0, 13, 1, 0 }, { 2061, 0, 0, 13, 1, 0 }, { 2062, 0, 0, 13, 1, 0 },
+                { 2063, 0, 0, 13, 2, 0 }, { 0, 829, 0, 8, 0, 1 }, { 0, 830, 0, 8, 0, 1 }, { 0, 831, 0, 8, 0, 1 },
+                { 2065, 0, 0, 12, 2, 0 }, { 2067, 0, 0, 12, 2, 0 }, { 2069, 0, 0, 12, 2, 0 }, { 2071, 0, 0, 12, 2, 0 },
+                { 2073, 0, 0, 12, 2, 0 }, { 2075, 0, 0, 12, 2, 0 }, { 0, 832, 0, 8, 0, 1 }, { 0, 833, 0, 8, 0, 1 },
+                { 0, 834, 0, 8, 0, 1 }, { 0, 835, 0, 8, 0, 1 }, { 2077, 0, 0, 12, 2, 0 }, { 0, 836, 0, 8, 0, 1 },
+                { 2079, 0, 0, 12, 2, 0 }, { 0, 837, 0, 8, 0, 1 }, { 2081, 0, 0, 12, 2, 0 }, { 0, 838, 0, 8, 0, 1 },
+                { 2083, 0, 0, 12, 2, 0 }, { 0, 839, 0, 8, 0, 1 }, { 2085, 0, 0, 12, 2, 0 }, { 0, 840, 0, 8, 0, 1 },
+                { 2087, 0, 0, 12, 2, 0 }, { 0, 841, 0, 8, 0, 1 }, { 2089, 0, 0, 12, 2, 0 }, { 0, 842, 0, 8, 0, 1 },
+                { 2091, 0, 0, 12, 2, 0 }, { 0, 843, 0, 8, 0, 1 }, { 2093, 0, 0, 12, 2, 0 }, { 0, 844, 0, 8, 0, 1 },
+                { 2095, 0, 0, 12, 2, 0 }, { 0, 845, 0, 8, 0, 1 }, { 2097, 0, 0, 12, 2, 0 }, { 0, 846, 0, 8, 0, 1 },
+                { 0, 847, 0, 8, 0, 1 }, { 2099, 0, 0, 12, 2, 0 }, { 2101, 0, 0, 12, 2, 0 }, { 2103, 0, 0, 12, 2, 0 },
+                { 2105, 0, 0, 12, 2, 0 }, { 2107, 0, 0, 12, 2, 0 }, { 0, 848, 0, 8, 0, 1 }, { 0, 849, 0, 8, 0, 1 },
+                { 2109, 0, 0, 12, 2, 0 }, { 2111, 0, 0, 12, 2, 0 }, { 0, 850, 0, 8, 0, 1 }, { 0, 851, 0, 8, 0, 1 },
+                { 2113, 0, 0, 12, 2, 0 }, { 2115, 0, 0, 12, 2, 0 }, { 0, 852, 0, 8, 0, 1 }, { 0, 853, 0, 8, 0, 1 },
+                { 0, 854, 0, 8, 0, 1 }, { 0, 855, 0, 8, 0, 1 }, { 2117, 0, 0, 12, 2, 0 }, { 2119, 0, 0, 12, 2, 0 },
+                { 0, 856, 0, 8, 0, 1 }, { 0, 857, 0, 8, 0, 1 }, { 2121, 0, 0, 12, 2, 0 }, { 2123, 0, 0, 12, 2, 0 },
+                { 0, 858, 0, 8, 0, 1 }, { 0, 859, 0, 8, 0, 1 }, { 2125, 0, 0, 12, 2, 0 }, { 2127, 0, 0, 12, 2, 0 },
+                { 0, 860, 0, 8, 0, 1 }, { 0, 861, 0, 8, 0, 1 }, { 0, 862, 0, 8, 0, 1 }, { 0, 863, 0, 8, 0, 1 },
+                { 0, 864, 0, 8, 0, 1 }, { 0, 865, 0, 8, 0, 1 }, { 2129, 0, 0, 12, 2, 0 }, { 2131, 0, 0, 12, 2, 0 },
+                { 2133, 0, 0, 12, 2, 0 }, { 2135, 0, 0, 12, 2, 0 }, { 0, 866, 0, 8, 0, 1 }, { 0, 867, 0, 8, 0, 1 },
+                { 0, 868, 0, 8, 0, 1 }, { 0, 869, 0, 8, 0, 1 }, { 2137, 0, 0, 12, 2, 0 }, { 2139, 0, 0, 12, 2, 0 },
+                { 2141, 0, 0, 12, 2, 0 }, { 2143, 0, 0, 12, 2, 0 }, { 2145, 0, 0, 12, 2, 0 }, { 2147, 0, 0, 12, 2, 0 },
+                { 2149, 0, 0, 12, 2, 0 }, { 2151, 0, 0, 12, 2, 0 }, { 2153, 0, 0, 13, 1, 0 }, { 2154, 0, 0, 13, 1, 0 },
+                { 2155, 0, 0, 13, 2, 0 }, { 0, 0, 224, 0, 0, 0 }, { 0, 870, 0, 8, 0, 1 }, { 0, 871, 0, 8, 0, 1 },
+                { 2157, 0, 0, 12, 2, 0 }, { 0, 872, 0, 8, 0, 1 }, { 2159, 0, 0, 12, 2, 0 }, { 0, 873, 0, 8, 0, 1 },
+                { 2161, 0, 0, 12, 2, 0 }, { 0, 874, 0, 8, 0, 1 }, { 2163, 0, 0, 12, 2, 0 }, { 0, 875, 0, 8, 0, 1 },
+                { 2165, 0, 0, 12, 2, 0 }, { 0, 876, 0, 8, 0, 1 }, { 2167, 0, 0, 12, 2, 0 }, { 0, 877, 0, 8, 0, 1 },
+                { 2169, 0, 0, 12, 2, 0 }, { 0, 878, 0, 8, 0, 1 }, { 2171, 0, 0, 12, 2, 0 }, { 0, 879, 0, 8, 0, 1 },
+                { 2173, 0, 0, 12, 2, 0 }, { 0, 880, 0, 8, 0, 1 }, { 2175, 0, 0, 12, 2, 0 }, { 0, 881, 0, 8, 0, 1 },
+                { 2177, 0, 0, 12, 2, 0 }, { 0, 882, 0, 8, 0, 1 }, { 2179, 0, 0, 12, 2, 0 }, { 0, 883, 0, 8, 0, 1 },
+                { 2181, 0, 0, 12, 2, 0 }, { 0, 884, 0, 8, 0, 1 }, { 2183, 0, 0, 12, 2, 0 }, { 0, 885, 0, 8, 0, 1 },
+                { 2185, 0, 0, 12, 2, 0 }, { 0, 886, 0, 8, 0, 2 }, { 2187, 0, 0, 12, 2, 0 }, { 2189, 0, 0, 12, 2, 0 },
+                { 0, 888, 0, 8, 0, 2 }, { 2191, 0, 0, 12, 2, 0 }, { 2193, 0, 0, 12, 2, 0 }, { 0, 890, 0, 8, 0, 2 },
+                { 2195, 0, 0, 12, 2, 0 }, { 2197, 0, 0, 12, 2, 0 }, { 0, 892, 0, 8, 0, 2 }, { 2199, 0, 0, 12, 2, 0 },
+                { 2201, 0, 0, 12, 2, 0 }, { 0, 894, 0, 8, 0, 2 }, { 2203, 0, 0, 12, 2, 0 }, { 2205, 0, 0, 12, 2, 0 },
+                { 2207, 0, 0, 12, 2, 0 }, { 0, 0, 8, 2, 0, 0 }, { 0, 896, 0, 8, 0, 1 }, { 2209, 0, 0, 12, 2, 0 },
+                { 0, 897, 0, 8, 0, 1 }, { 0, 898, 0, 8, 0, 1 }, { 2211, 0, 0, 12, 2, 0 }, { 0, 899, 0, 8, 0, 1 },
+                { 2213, 0, 0, 12, 2, 0 }, { 0, 900, 0, 8, 0, 1 }, { 2215, 0, 0, 12, 2, 0 }, { 0, 901, 0, 8, 0, 1 },
+                { 2217, 0, 0, 12, 2, 0 }, { 0, 902, 0, 8, 0, 1 }, { 2219, 0, 0, 12, 2, 0 }, { 0, 903, 0, 8, 0, 1 },
+                { 2221, 0, 0, 12, 2, 0 }, { 0, 904, 0, 8, 0, 1 }, { 2223, 0, 0, 12, 2, 0 }, { 0, 905, 0, 8, 0, 1 },
+                { 2225, 0, 0, 12, 2, 0 }, { 0, 906, 0, 8, 0, 1 }, { 2227, 0, 0, 12, 2, 0 }, { 0, 907, 0, 8, 0, 1 },
+                { 2229, 0, 0, 12, 2, 0 }, { 0, 908, 0, 8, 0, 1 }, { 2231, 0, 0, 12, 2, 0 }, { 0, 909, 0, 8, 0, 1 },
+                { 2233, 0, 0, 12, 2, 0 }, { 0, 910, 0, 8, 0, 1 }, { 2235, 0, 0, 12, 2, 0 }, { 0, 911, 0, 8, 0, 1 },
+                { 2237, 0, 0, 12, 2, 0 }, { 0, 912, 0, 8, 0, 1 }, { 2239, 0, 0, 12, 2, 0 }, { 0, 913, 0, 8, 0, 2 },
+                { 2241, 0, 0, 12, 2, 0 }, { 2243, 0, 0, 12, 2, 0 }, { 0, 915, 0, 8, 0, 2 }, { 2245, 0, 0, 12, 2, 0 },
+                { 2247, 0, 0, 12, 2, 0 }, { 0, 917, 0, 8, 0, 2 }, { 2249, 0, 0, 12, 2, 0 }, { 2251, 0, 0, 12, 2, 0 },
+                { 0, 919, 0, 8, 0, 2 }, { 2253, 0, 0, 12, 2, 0 }, { 2255, 0, 0, 12, 2, 0 }, { 0, 921, 0, 8, 0, 2 },
+                { 2257, 0, 0, 12, 2, 0 }, { 2259, 0, 0, 12, 2, 0 }, { 0, 923, 0, 8, 0, 1 }, { 0, 924, 0, 8, 0, 1 },
+                { 0, 925, 0, 8, 0, 1 }, { 0, 926, 0, 8, 0, 1 }, { 2261, 0, 0, 12, 2, 0 }, { 2263, 0, 0, 12, 2, 0 },
+                { 2265, 0, 0, 12, 2, 0 }, { 2267, 0, 0, 12, 2, 0 }, { 2269, 0, 0, 12, 2, 0 }, { 0, 927, 0, 8, 0, 1 },
+                { 2271, 0, 0, 12, 2, 0 }, { 0, 0, 0, 12, 0, 0 }, { 2273, 0, 0, 13, 1, 0 }, { 2274, 0, 0, 13, 1, 0 },
+                { 2275, 0, 0, 13, 1, 0 }, { 2276, 0, 0, 13, 1, 0 }, { 2277, 0, 0, 13, 1, 0 }, { 2278, 0, 0, 13, 1, 0 },
+                { 2279, 0, 0, 13, 1, 0 }, { 2280, 0, 0, 13, 1, 0 }, { 2281, 0, 0, 13, 1, 0 }, { 2282, 0, 0, 13, 1, 0 },
+                { 2283, 0, 0, 13, 1, 0 }, { 2284, 0, 0, 13, 1, 0 }, { 2285, 0, 0, 13, 1, 0 }, { 2286, 0, 0, 13, 1, 0 },
+                { 2287, 0, 0, 13, 1, 0 }, { 2288, 0, 0, 13, 1, 0 }, { 2289, 0, 0, 13, 1, 0 }, { 2290, 0, 0, 13, 1, 0 },
+                { 2291, 0, 0, 13, 1, 0 }, { 2292, 0, 0, 13, 1, 0 }, { 2293, 0, 0, 13, 1, 0 }, { 2294, 0, 0, 13, 1, 0 },
+                { 2295, 0, 0, 13, 1, 0 }, { 2296, 0, 0, 13, 1, 0 }, { 2297, 0, 0, 13, 1, 0 }, { 2298, 0, 0, 13, 1, 0 },
+                { 2299, 0, 0, 13, 1, 0 }, { 2300, 0, 0, 13, 1, 0 }, { 2301, 0, 0, 13, 1, 0 }, { 2302, 0, 0, 13, 1, 0 },
+                { 2303, 0, 0, 13, 1, 0 }, { 2304, 0, 0, 13, 1, 0 }, { 2305, 0, 0, 13, 1, 0 }, { 2306, 0, 0, 13, 1, 0 },
+                { 2307, 0, 0, 13, 1, 0 }, { 2308, 0, 0, 13, 1, 0 }, { 2309, 0, 0, 13, 1, 0 }, { 2310, 0, 0, 13, 1, 0 },
+                { 2311, 0, 0, 13, 1, 0 }, { 2312, 0, 0, 13, 1, 0 }, { 2313, 0, 0, 13, 1, 0 }, { 2314, 0, 0, 13, 1, 0 },
+                { 2315, 0, 0, 13, 1, 0 }, { 2316, 0, 0, 13, 1, 0 }, { 2317, 0, 0, 13, 1, 0 }, { 2318, 0, 0, 13, 1, 0 },
+                { 2319, 0, 0, 13, 1, 0 }, { 2320, 0, 0, 13, 1, 0 }, { 2321, 0, 0, 13, 1, 0 }, { 2322, 0, 0, 13, 1, 0 },
+                { 2323, 0, 0, 13, 1, 0 }, { 2324, 0, 0, 13, 1, 0 }, { 2325, 0, 0, 13, 1, 0 }, { 2326, 0, 0, 13, 1, 0 },
+                { 2327, 0, 0, 13, 1, 0 }, { 2328, 0, 0, 13, 1, 0 }, { 2329, 0, 0, 13, 1, 0 }, { 2330, 0, 0, 13, 1, 0 },
+                { 2331, 0, 0, 13, 1, 0 }, { 2332, 0, 0, 13, 1, 0 }, { 2333, 0, 0, 13, 1, 0 }, { 2334, 0, 0, 13, 1, 0 },
+                { 2335, 0, 0, 13, 1, 0 }, { 2336, 0, 0, 13, 1, 0 }, { 2337, 0, 0, 13, 1, 0 }, { 2338, 0, 0, 13, 1, 0 },
+                { 2339, 0, 0, 13, 1, 0 }, { 2340, 0, 0, 13, 1, 0 }, { 2341, 0, 0, 13, 1, 0 }, { 2342, 0, 0, 13, 1, 0 },
+                { 2343, 0, 0, 13, 1, 0 }, { 2344, 0, 0, 13, 1, 0 }, { 2345, 0, 0, 13, 1, 0 }, { 2346, 0, 0, 13, 1, 0 },
+                { 2347, 0, 0, 13, 1, 0 }, { 2348, 0, 0, 13, 1, 0 }, { 2349, 0, 0, 13, 1, 0 }, { 2350, 0, 0, 13, 1, 0 },
+                { 2351, 0, 0, 13, 1, 0 }, { 2352, 0, 0, 13, 1, 0 }, { 2353, 0, 0, 13, 1, 0 }, { 2354, 0, 0, 13, 1, 0 },
+                { 2355, 0, 0, 13, 1, 0 }, { 2356, 0, 0, 13, 1, 0 }, { 2357, 0, 0, 13, 1, 0 }, { 2358, 0, 0, 13, 1, 0 },
+                { 2359, 0, 0, 13, 1, 0 }, { 2360, 0, 0, 13, 1, 0 }, { 2361, 0, 0, 13, 1, 0 }, { 2362, 0, 0, 13, 1, 0 },
+                { 2363, 0, 0, 13, 1, 0 }, { 2364, 0, 0, 13, 1, 0 }, { 2365, 0, 0, 13, 1, 0 }, { 2366, 0, 0, 13, 1, 0 },
+                { 2367, 0, 0, 13, 1, 0 }, { 2368, 0, 0, 13, 1, 0 }, { 2369, 0, 0, 13, 1, 0 }, { 2370, 0, 0, 13, 1, 0 },
+                { 2371, 0, 0, 13, 1, 0 }, { 2372, 0, 0, 13, 1, 0 }, { 2373, 0, 0, 13, 1, 0 }, { 2374, 0, 0, 13, 1, 0 },
+                { 2375, 0, 0, 13, 1, 0 }, { 2376, 0, 0, 13, 1, 0 }, { 2377, 0, 0, 13, 1, 0 }, { 2378, 0, 0, 13, 1, 0 },
+                { 2379, 0, 0, 13, 1, 0 }, { 2380, 0, 0, 13, 1, 0 }, { 2381, 0, 0, 13, 1, 0 }, { 2382, 0, 0, 13, 1, 0 },
+                { 2383, 0, 0, 13, 1, 0 }, { 2384, 0, 0, 13, 1, 0 }, { 2385, 0, 0, 13, 1, 0 }, { 2386, 0, 0, 13, 1, 0 },
+                { 2387, 0, 0, 13, 1, 0 }, { 2388, 0, 0, 13, 1, 0 }, { 2389, 0, 0, 13, 1, 0 }, { 2390, 0, 0, 13, 1, 0 },
+                { 2391, 0, 0, 13, 1, 0 }, { 2392, 0, 0, 13, 1, 0 }, { 2393, 0, 0, 13, 1, 0 }, { 2394, 0, 0, 13, 1, 0 },
+                { 2395, 0, 0, 13, 1, 0 }, { 2396, 0, 0, 13, 1, 0 }, { 2397, 0, 0, 13, 1, 0 }, { 2398, 0, 0, 13, 1, 0 },
+                { 2399, 0, 0, 13, 1, 0 }, { 2400, 0, 0, 13, 1, 0 }, { 2401, 0, 0, 13, 1, 0 }, { 2402, 0, 0, 13, 1, 0 },
+                { 2403, 0, 0, 13, 1, 0 }, { 2404, 0, 0, 13, 1, 0 }, { 2405, 0, 0, 13, 1, 0 }, { 2406, 0, 0, 13, 1, 0 },
+                { 2407, 0, 0, 13, 1, 0 }, { 2408, 0, 0, 13, 1, 0 }, { 2409, 0, 0, 13, 1, 0 }, { 2410, 0, 0, 13, 1, 0 },
+                { 2411, 0, 0, 13, 1, 0 }, { 2412, 0, 0, 13, 1, 0 }, { 2413, 0, 0, 13, 1, 0 }, { 2414, 0, 0, 13, 1, 0 },
+                { 2415, 0, 0, 13, 1, 0 }, { 2416, 0, 0, 13, 1, 0 }, { 2417, 0, 0, 13, 1, 0 }, { 2418, 0, 0, 13, 1, 0 },
+                { 2419, 0, 0, 13, 1, 0 }, { 2420, 0, 0, 13, 1, 0 }, { 2421, 0, 0, 13, 1, 0 }, { 2422, 0, 0, 13, 1, 0 },
+                { 2423, 0, 0, 13, 1, 0 }, { 2424, 0, 0, 13, 1, 0 }, { 2425, 0, 0, 13, 1, 0 }, { 2426, 0, 0, 13, 1, 0 },
+                { 2427, 0, 0, 13, 1, 0 }, { 2428, 0, 0, 13, 1, 0 }, { 2429, 0, 0, 13, 1, 0 }, { 2430, 0, 0, 13, 1, 0 },
+                { 2431, 0, 0, 13, 1, 0 }, { 2432, 0, 0, 13, 1, 0 }, { 2433, 0, 0, 13, 1, 0 }, { 2434, 0, 0, 13, 1, 0 },
+                { 2435, 0, 0, 13, 1, 0 }, { 2436, 0, 0, 13, 1, 0 }, { 2437, 0, 0, 13, 1, 0 }, { 2438, 0, 0, 13, 1, 0 },
+                { 2439, 0, 0, 13, 1, 0 }, { 2440, 0, 0, 13, 1, 0 }, { 2441, 0, 0, 13, 1, 0 }, { 2442, 0, 0, 13, 1, 0 },
+                { 2443, 0, 0, 13, 1, 0 }, { 2444, 0, 0, 13, 1, 0 }, { 2445, 0, 0, 13, 1, 0 }, { 2446, 0, 0, 13, 1, 0 },
+                { 2447, 0, 0, 13, 1, 0 }, { 2448, 0, 0, 13, 1, 0 }, { 2449, 0, 0, 13, 1, 0 }, { 2450, 0, 0, 13, 1, 0 },
+                { 2451, 0, 0, 13, 1, 0 }, { 2452, 0, 0, 13, 1, 0 }, { 2453, 0, 0, 13, 1, 0 }, { 2454, 0, 0, 13, 1, 0 },
+                { 2455, 0, 0, 13, 1, 0 }, { 2456, 0, 0, 13, 1, 0 }, { 2457, 0, 0, 13, 1, 0 }, { 2458, 0, 0, 13, 1, 0 },
+                { 2459, 0, 0, 13, 1, 0 }, { 2460, 0, 0, 13, 1, 0 }, { 2461, 0, 0, 13, 1, 0 }, { 2462, 0, 0, 13, 1, 0 },
+                { 2463, 0, 0, 13, 1, 0 }, { 2464, 0, 0, 13, 1, 0 }, { 2465, 0, 0, 13, 1, 0 }, { 2466, 0, 0, 13, 1, 0 },
+                { 2467, 0, 0, 13, 1, 0 }, { 2468, 0, 0, 13, 1, 0 }, { 2469, 0, 0, 13, 1, 0 }, { 2470, 0, 0, 13, 1, 0 },
+                { 2471, 0, 0, 13, 1, 0 }, { 2472, 0, 0, 13, 1, 0 }, { 2473, 0, 0, 13, 1, 0 }, { 2474, 0, 0, 13, 1, 0 },
+                { 2475, 0, 0, 13, 1, 0 }, { 2476, 0, 0, 13, 1, 0 }, { 2477, 0, 0, 13, 1, 0 }, { 2478, 0, 0, 13, 1, 0 },
+                { 2479, 0, 0, 13, 1, 0 }, { 2480, 0, 0, 13, 1, 0 }, { 2481, 0, 0, 13, 1, 0 }, { 2482, 0, 0, 13, 1, 0 },
+                { 2483, 0, 0, 13, 1, 0 }, { 2484, 0, 0, 13, 1, 0 }, { 2485, 0, 0, 13, 1, 0 }, { 2486, 0, 0, 13, 1, 0 },
+                { 2487, 0, 0, 13, 1, 0 }, { 2488, 0, 0, 13, 1, 0 }, { 2489, 0, 0, 13, 1, 0 }, { 2490, 0, 0, 13, 1, 0 },
+                { 2491, 0, 0, 13, 1, 0 }, { 2492, 0, 0, 13, 1, 0 }, { 2493, 0, 0, 13, 1, 0 }, { 2494, 0, 0, 13, 1, 0 },
+                { 2495, 0, 0, 13, 1, 0 }, { 2496, 0, 0, 13, 1, 0 }, { 2497, 0, 0, 13, 1, 0 }, { 2498, 0, 0, 13, 1, 0 },
+                { 2499, 0, 0, 13, 1, 0 }, { 2500, 0, 0, 13, 1, 0 }, { 2501, 0, 0, 13, 1, 0 }, { 2502, 0, 0, 13, 1, 0 },
+                { 2503, 0, 0, 13, 1, 0 }, { 2504, 0, 0, 13, 1, 0 }, { 2505, 0, 0, 13, 1, 0 }, { 2506, 0, 0, 13, 1, 0 },
+                { 2507, 0, 0, 13, 1, 0 }, { 2508, 0, 0, 13, 1, 0 }, { 2509, 0, 0, 13, 1, 0 }, { 2510, 0, 0, 13, 1, 0 },
+                { 2511, 0, 0, 13, 1, 0 }, { 2512, 0, 0, 13, 1, 0 }, { 2513, 0, 0, 13, 1, 0 }, { 2514, 0, 0, 13, 1, 0 },
+                { 2515, 0, 0, 13, 1, 0 }, { 2516, 0, 0, 13, 1, 0 }, { 2517, 0, 0, 13, 1, 0 }, { 2518, 0, 0, 13, 1, 0 },
+                { 2519, 0, 0, 13, 1, 0 }, { 2520, 0, 0, 13, 1, 0 }, { 2521, 0, 0, 13, 1, 0 }, { 2522, 0, 0, 13, 1, 0 },
+                { 2523, 0, 0, 13, 1, 0 }, { 2524, 0, 0, 13, 1, 0 }, { 2525, 0, 0, 13, 1, 0 }, { 2526, 0, 0, 13, 1, 0 },
+                { 2527, 0, 0, 13, 1, 0 }, { 2528, 0, 0, 13, 1, 0 }, { 2529, 0, 0, 13, 1, 0 }, { 2530, 0, 0, 13, 1, 0 },
+                { 2531, 0, 0, 13, 1, 0 }, { 2532, 0, 0, 13, 1, 0 }, { 2533, 0, 0, 13, 1, 0 }, { 2534, 0, 0, 13, 1, 0 },
+                { 2535, 0, 0, 13, 1, 0 }, { 2536, 0, 0, 13, 1, 0 }, { 2537, 0, 0, 13, 1, 0 }, { 2538, 0, 0, 13, 1, 0 },
+                { 2539, 0, 0, 13, 1, 0 }, { 2540, 0, 0, 13, 1, 0 }, { 2541, 0, 0, 13, 1, 0 }, { 2542, 0, 0, 13, 1, 0 },
+                { 2543, 0, 0, 13, 1, 0 }, { 2544, 0, 0, 13, 1, 0 }, { 2545, 0, 0, 13, 1, 0 }, { 2546, 0, 0, 13, 1, 0 },
+                { 2547, 0, 0, 13, 1, 0 }, { 2548, 0, 0, 13, 1, 0 }, { 2549, 0, 0, 13, 1, 0 }, { 2550, 0, 0, 13, 1, 0 },
+                { 2551, 0, 0, 13, 1, 0 }, { 2552, 0, 0, 13, 1, 0 }, { 2553, 0, 0, 13, 1, 0 }, { 2554, 0, 0, 13, 1, 0 },
+                { 2555, 0, 0, 13, 1, 0 }, { 2556, 0, 0, 13, 1, 0 }, { 2557, 0, 0, 13, 1, 0 }, { 2558, 0, 0, 13, 1, 0 },
+                { 2559, 0, 0, 13, 1, 0 }, { 2560, 0, 0, 13, 1, 0 }, { 2561, 0, 0, 13, 1, 0 }, { 2562, 0, 0, 13, 1, 0 },
+                { 2563, 0, 0, 13, 1, 0 }, { 2564, 0, 0, 13, 1, 0 }, { 2565, 0, 0, 13, 1, 0 }, { 2566, 0, 0, 13, 1, 0 },
+                { 2567, 0, 0, 13, 1, 0 }, { 2568, 0, 0, 13, 1, 0 }, { 2569, 0, 0, 13, 1, 0 }, { 2570, 0, 0, 13, 1, 0 },
+                { 2571, 0, 0, 13, 1, 0 }, { 2572, 0, 0, 13, 1, 0 }, { 2573, 0, 0, 13, 1, 0 }, { 2574, 0, 0, 13, 1, 0 },
+                { 2575, 0, 0, 13, 1, 0 }, { 2576, 0, 0, 13, 1, 0 }, { 2577, 0, 0, 13, 1, 0 }, { 2578, 0, 0, 13, 1, 0 },
+                { 2579, 0, 0, 13, 1, 0 }, { 2580, 0, 0, 13, 1, 0 }, { 2581, 0, 0, 13, 1, 0 }, { 2582, 0, 0, 13, 1, 0 },
+                { 2583, 0, 0, 13, 1, 0 }, { 2584, 0, 0, 13, 1, 0 }, { 2585, 0, 0, 13, 1, 0 }, { 2586, 0, 0, 13, 1, 0 },
+                { 2587, 0, 0, 13, 1, 0 }, { 2588, 0, 0, 13, 1, 0 }, { 2589, 0, 0, 13, 1, 0 }, { 2590, 0, 0, 13, 1, 0 },
+                { 2591, 0, 0, 13, 1, 0 }, { 2592, 0, 0, 13, 1, 0 }, { 2593, 0, 0, 13, 1, 0 }, { 2594, 0, 0, 13, 1, 0 },
+                { 2595, 0, 0, 13, 1, 0 }, { 2596, 0, 0, 13, 1, 0 }, { 2597, 0, 0, 13, 1, 0 }, { 2598, 0, 0, 13, 1, 0 },
+                { 2599, 0, 0, 13, 1, 0 }, { 2600, 0, 0, 13, 1, 0 }, { 2601, 0, 0, 13, 1, 0 }, { 2602, 0, 0, 13, 1, 0 },
+                { 2603, 0, 0, 13, 1, 0 }, { 2604, 0, 0, 13, 1, 0 }, { 2605, 0, 0, 13, 1, 0 }, { 2606, 0, 0, 13, 1, 0 },
+                { 2607, 0, 0, 13, 1, 0 }, { 2608, 0, 0, 13, 1, 0 }, { 2609, 0, 0, 13, 1, 0 }, { 2610, 0, 0, 13, 1, 0 },
+                { 2611, 0, 0, 13, 1, 0 }, { 2612, 0, 0, 13, 1, 0 }, { 2613, 0, 0, 13, 1, 0 }, { 2614, 0, 0, 13, 1, 0 },
+                { 2615, 0, 0, 13, 1, 0 }, { 2616, 0, 0, 13, 1, 0 }, { 2617, 0, 0, 13, 1, 0 }, { 2618, 0, 0, 13, 1, 0 },
+                { 2619, 0, 0, 13, 1, 0 }, { 2620, 0, 0, 13, 1, 0 }, { 2621, 0, 0, 13, 1, 0 }, { 2622, 0, 0, 13, 1, 0 },
+                { 2623, 0, 0, 13, 1, 0 }, { 2624, 0, 0, 13, 1, 0 }, { 2625, 0, 0, 13, 1, 0 }, { 2626, 0, 0, 13, 1, 0 },
+                { 2627, 0, 0, 13, 1, 0 }, { 2628, 0, 0, 13, 1, 0 }, { 2629, 0, 0, 13, 1, 0 }, { 2630, 0, 0, 13, 1, 0 },
+                { 2631, 0, 0, 13, 1, 0 }, { 2632, 0, 0, 13, 1, 0 }, { 2633, 0, 0, 13, 1, 0 }, { 2634, 0, 0, 13, 1, 0 },
+                { 2635, 0, 0, 13, 1, 0 }, { 2636, 0, 0, 13, 1, 0 }, { 2637, 0, 0, 13, 1, 0 }, { 2638, 0, 0, 13, 1, 0 },
+                { 2639, 0, 0, 13, 1, 0 }, { 2640, 0, 0, 13, 1, 0 }, { 2641, 0, 0, 13, 1, 0 }, { 2642, 0, 0, 13, 1, 0 },
+                { 2643, 0, 0, 13, 1, 0 }, { 2644, 0, 0, 13, 1, 0 }, { 2645, 0, 0, 13, 1, 0 }, { 2646, 0, 0, 13, 1, 0 },
+                { 2647, 0, 0, 13, 1, 0 }, { 2648, 0, 0, 13, 1, 0 }, { 2649, 0, 0, 13, 1, 0 }, { 2650, 0, 0, 13, 1, 0 },
+                { 2651, 0, 0, 13, 1, 0 }, { 2652, 0, 0, 13, 1, 0 }, { 2653, 0, 0, 13, 1, 0 }, { 2654, 0, 0, 13, 1, 0 },
+                { 2655, 0, 0, 13, 1, 0 }, { 2656, 0, 0, 13, 1, 0 }, { 2657, 0, 0, 13, 1, 0 }, { 2658, 0, 0, 13, 1, 0 },
+                { 2659, 0, 0, 13, 1, 0 }, { 2660, 0, 0, 13, 1, 0 }, { 2661, 0, 0, 13, 1, 0 }, { 2662, 0, 0, 13, 1, 0 },
+                { 2663, 0, 0, 13, 1, 0 }, { 2664, 0, 0, 13, 1, 0 }, { 2665, 0, 0, 13, 1, 0 }, { 2666, 0, 0, 13, 1, 0 },
+                { 2667, 0, 0, 13, 1, 0 }, { 2668, 0, 0, 13, 1, 0 }, { 2669, 0, 0, 13, 1, 0 }, { 2670, 0, 0, 13, 1, 0 },
+                { 2671, 0, 0, 13, 1, 0 }, { 2672, 0, 0, 13, 1, 0 }, { 2673, 0, 0, 13, 1, 0 }, { 2674, 0, 0, 13, 1, 0 },
+                { 2675, 0, 0, 13, 1, 0 }, { 2676, 0, 0, 13, 1, 0 }, { 2677, 0, 0, 13, 1, 0 }, { 2678, 0, 0, 13, 1, 0 },
+                { 2679, 0, 0, 13, 1, 0 }, { 2680, 0, 0, 13, 1, 0 }, { 2681, 0, 0, 13, 1, 0 }, { 2682, 0, 0, 13, 1, 0 },
+                { 2683, 0, 0, 13, 1, 0 }, { 2684, 0, 0, 13, 1, 0 }, { 2685, 0, 0, 13, 1, 0 }, { 2686, 0, 0, 13, 1, 0 },
+                { 2687, 0, 0, 13, 1, 0 }, { 2688, 0, 0, 13, 1, 0 }, { 2689, 0, 0, 13, 1, 0 }, { 2690, 0, 0, 13, 1, 0 },
+                { 2691, 0, 0, 13, 1, 0 }, { 2692, 0, 0, 13, 1, 0 }, { 2693, 0, 0, 13, 1, 0 }, { 2694, 0, 0, 13, 1, 0 },
+                { 2695, 0, 0, 13, 1, 0 }, { 2696, 0, 0, 13, 1, 0 }, { 2697, 0, 0, 13, 1, 0 }, { 2698, 0, 0, 13, 1, 0 },
+                { 2699, 0, 0, 13, 1, 0 }, { 2700, 0, 0, 13, 1, 0 }, { 2701, 0, 0, 13, 1, 0 }, { 2702, 0, 0, 13, 1, 0 },
+                { 2703, 0, 0, 13, 1, 0 }, { 2704, 0, 0, 13, 1, 0 }, { 2705, 0, 0, 13, 1, 0 }, { 2706, 0, 0, 13, 1, 0 },
+                { 2707, 0, 0, 13, 1, 0 }, { 2708, 0, 0, 13, 1, 0 }, { 2709, 0, 0, 13, 1, 0 }, { 2710, 0, 0, 13, 1, 0 },
+                { 2711, 0, 0, 13, 1, 0 }, { 2712, 0, 0, 13, 1, 0 }, { 2713, 0, 0, 13, 1, 0 }, { 2714, 0, 0, 13, 1, 0 },
+                { 2715, 0, 0, 13, 1, 0 }, { 2716, 0, 0, 13, 1, 0 }, { 2717, 0, 0, 13, 1, 0 }, { 2718, 0, 0, 13, 1, 0 },
+                { 2719, 0, 0, 13, 1, 0 }, { 2720, 0, 0, 13, 1, 0 }, { 2721, 0, 0, 13, 1, 0 }, { 2722, 0, 0, 13, 1, 0 },
+                { 2723, 0, 0, 13, 1, 0 }, { 2724, 0, 0, 13, 1, 0 }, { 2725, 0, 0, 13, 1, 0 }, { 2726, 0, 0, 13, 1, 0 },
+                { 2727, 0, 0, 13, 1, 0 }, { 2728, 0, 0, 13, 1, 0 }, { 2729, 0, 0, 13, 1, 0 }, { 2730, 0, 0, 13, 1, 0 },
+                { 2731, 0, 0, 13, 1, 0 }, { 2732, 0, 0, 13, 1, 0 }, { 2733, 0, 0, 13, 2, 0 }, { 0, 0, 26, 0, 0, 0 },
+                { 2735, 0, 0, 13, 2, 0 }, { 2737, 0, 0, 13, 2, 0 }, { 2739, 0, 0, 13, 2, 0 }, { 2741, 0, 0, 13, 3, 0 },
+                { 2744, 0, 0, 13, 3, 0 }, { 2747, 0, 0, 13, 2, 0 }, { 2749, 0, 0, 13, 2, 0 }, { 2751, 0, 0, 13, 2, 0 },
+                { 2753, 0, 0, 13, 2, 0 }, { 2755, 0, 0, 13, 2, 0 }, { 2757, 0, 0, 13, 2, 0 }, { 2759, 0, 0, 13, 2, 0 },
+                { 2761, 0, 0, 13, 2, 0 }, { 2763, 0, 0, 13, 2, 0 }, { 2765, 0, 0, 13, 2, 0 }, { 2767, 0, 0, 13, 2, 0 },
+                { 2769, 0, 0, 13, 2, 0 }, { 2771, 0, 0, 13, 2, 0 }, { 2773, 0, 0, 13, 2, 0 }, { 2775, 0, 0, 13, 2, 0 },
+                { 2777, 0, 0, 13, 2, 0 }, { 2779, 0, 0, 13, 2, 0 }, { 2781, 0, 0, 13, 2, 0 }, { 2783, 0, 0, 13, 2, 0 },
+                { 2785, 0, 0, 13, 2, 0 }, { 2787, 0, 0, 13, 2, 0 }, { 2789, 0, 0, 13, 2, 0 }, { 2791, 0, 0, 13, 2, 0 },
+                { 2793, 0, 0, 13, 2, 0 }, { 2795, 0, 0, 13, 2, 0 }, { 2797, 0, 0, 13, 2, 0 }, { 2799, 0, 0, 13, 2, 0 },
+                { 2801, 0, 0, 13, 2, 0 }, { 0, 928, 0, 8, 0, 1 }, { 2803, 0, 0, 12, 2, 0 }, { 0, 929, 0, 8, 0, 1 },
+                { 2805, 0, 0, 12, 2, 0 }, { 0, 930, 0, 8, 0, 1 }, { 2807, 0, 0, 12, 2, 0 }, { 2809, 0, 0, 12, 2, 0 },
+                { 2811, 0, 0, 12, 2, 0 }, { 0, 931, 0, 8, 0, 1 }, { 0, 932, 0, 8, 0, 1 }, { 0, 933, 0, 8, 0, 2 },
+                { 2813, 0, 0, 12, 2, 0 }, { 2815, 0, 0, 12, 2, 0 }, { 0, 935, 0, 8, 0, 3 }, { 2817, 0, 0, 12, 2, 0 },
+                { 2819, 0, 0, 12, 2, 0 }, { 2821, 0, 0, 12, 2, 0 }, { 0, 938, 0, 8, 0, 1 }, { 0, 939, 0, 8, 0, 1 },
+                { 2823, 0, 0, 12, 2, 0 }, { 2825, 0, 0, 12, 2, 0 }, { 0, 940, 0, 8, 0, 1 }, { 2827, 0, 0, 12, 2, 0 },
+                { 0, 0, 6, 0, 0, 0 }, { 2829, 0, 0, 13, 2, 0 }, { 2831, 0, 0, 13, 2, 0 }, { 2833, 0, 0, 13, 3, 0 },
+                { 2836, 0, 0, 13, 3, 0 }, { 2839, 0, 0, 13, 3, 0 }, { 2842, 0, 0, 13, 3, 0 }, { 2845, 0, 0, 13, 3, 0 },
+                { 0, 0, 226, 0, 0, 0 }, { 2848, 0, 0, 13, 2, 0 }, { 2850, 0, 0, 13, 2, 0 }, { 2852, 0, 0, 13, 3, 0 },
+                { 2855, 0, 0, 13, 3, 0 }, { 2858, 0, 0, 13, 3, 0 }, { 2861, 0, 0, 13, 3, 0 }, { 2864, 0, 0, 13, 1, 0 },
+                { 2865, 0, 0, 13, 1, 0 }, { 2866, 0, 0, 13, 1, 0 }, { 2867, 0, 0, 13, 1, 0 }, { 2868, 0, 0, 13, 1, 0 },
+                { 2869, 0, 0, 13, 1, 0 }, { 2870, 0, 0, 13, 1, 0 }, { 2871, 0, 0, 13, 1, 0 }, { 2872, 0, 0, 13, 1, 0 },
+                { 2873, 0, 0, 13, 1, 0 }, { 2874, 0, 0, 13, 1, 0 }, { 2875, 0, 0, 13, 1, 0 }, { 2876, 0, 0, 13, 1, 0 },
+                { 2877, 0, 0, 13, 1, 0 }, { 2878, 0, 0, 13, 1, 0 }, { 2879, 0, 0, 13, 1, 0 }, { 2880, 0, 0, 13, 1, 0 },
+                { 2881, 0, 0, 13, 1, 0 }, { 2882, 0, 0, 13, 1, 0 }, { 2883, 0, 0, 13, 1, 0 }, { 2884, 0, 0, 13, 1, 0 },
+                { 2885, 0, 0, 13, 1, 0 }, { 2886, 0, 0, 13, 1, 0 }, { 2887, 0, 0, 13, 1, 0 }, { 2888, 0, 0, 13, 1, 0 },
+                { 2889, 0, 0, 13, 1, 0 }, { 2890, 0, 0, 13, 1, 0 }, { 2891, 0, 0, 13, 1, 0 }, { 2892, 0, 0, 13, 1, 0 },
+                { 2893, 0, 0, 13, 1, 0 }, { 2894, 0, 0, 13, 1, 0 }, { 2895, 0, 0, 13, 1, 0 }, { 2896, 0, 0, 13, 1, 0 },
+                { 2897, 0, 0, 13, 1, 0 }, { 2898, 0, 0, 13, 1, 0 }, { 2899, 0, 0, 13, 1, 0 }, { 2900, 0, 0, 13, 1, 0 },
+                { 2901, 0, 0, 13, 1, 0 }, { 2902, 0, 0, 13, 1, 0 }, { 2903, 0, 0, 13, 1, 0 }, { 2904, 0, 0, 13, 1, 0 },
+                { 2905, 0, 0, 13, 1, 0 }, { 2906, 0, 0, 13, 1, 0 }, { 2907, 0, 0, 13, 1, 0 }, { 2908, 0, 0, 13, 1, 0 },
+                { 2909, 0, 0, 13, 1, 0 }, { 2910, 0, 0, 13, 1, 0 }, { 2911, 0, 0, 13, 1, 0 }, { 2912, 0, 0, 13, 1, 0 },
+                { 2913, 0, 0, 13, 1, 0 }, { 2914, 0, 0, 13, 1, 0 }, { 2915, 0, 0, 13, 1, 0 }, { 2916, 0, 0, 13, 1, 0 },
+                { 2917, 0, 0, 13, 1, 0 }, { 2918, 0, 0, 13, 1, 0 }, { 2919, 0, 0, 13, 1, 0 }, { 2920, 0, 0, 13, 1, 0 },
+                { 2921, 0, 0, 13, 1, 0 }, { 2922, 0, 0, 13, 1, 0 }, { 2923, 0, 0, 13, 1, 0 }, { 2924, 0, 0, 13, 1, 0 },
+                { 2925, 0, 0, 13, 1, 0 }, { 2926, 0, 0, 13, 1, 0 }, { 2927, 0, 0, 13, 1, 0 }, { 2928, 0, 0, 13, 1, 0 },
+                { 2929, 0, 0, 13, 1, 0 }, { 2930, 0, 0, 13, 1, 0 }, { 2931, 0, 0, 13, 1, 0 }, { 2932, 0, 0, 13, 1, 0 },
+                { 2933, 0, 0, 13, 1, 0 }, { 2934, 0, 0, 13, 1, 0 }, { 2935, 0, 0, 13, 1, 0 }, { 2936, 0, 0, 13, 1, 0 },
+                { 2937, 0, 0, 13, 1, 0 }, { 2938, 0, 0, 13, 1, 0 }, { 2939, 0, 0, 13, 1, 0 }, { 2940, 0, 0, 13, 1, 0 },
+                { 2941, 0, 0, 13, 1, 0 }, { 2942, 0, 0, 13, 1, 0 }, { 2943, 0, 0, 13, 1, 0 }, { 2944, 0, 0, 13, 1, 0 },
+                { 2945, 0, 0, 13, 1, 0 }, { 2946, 0, 0, 13, 1, 0 }, { 2947, 0, 0, 13, 1, 0 }, { 2948, 0, 0, 13, 1, 0 },
+                { 2949, 0, 0, 13, 1, 0 }, { 2950, 0, 0, 13, 1, 0 }, { 2951, 0, 0, 13, 1, 0 }, { 2952, 0, 0, 13, 1, 0 },
+                { 2953, 0, 0, 13, 1, 0 }, { 2954, 0, 0, 13, 1, 0 }, { 2955, 0, 0, 13, 1, 0 }, { 2956, 0, 0, 13, 1, 0 },
+                { 2957, 0, 0, 13, 1, 0 }, { 2958, 0, 0, 13, 1, 0 }, { 2959, 0, 0, 13, 1, 0 }, { 2960, 0, 0, 13, 1, 0 },
+                { 2961, 0, 0, 13, 1, 0 }, { 2962, 0, 0, 13, 1, 0 }, { 2963, 0, 0, 13, 1, 0 }, { 2964, 0, 0, 13, 1, 0 },
+                { 2965, 0, 0, 13, 1, 0 }, { 2966, 0, 0, 13, 1, 0 }, { 2967, 0, 0, 13, 1, 0 }, { 2968, 0, 0, 13, 1, 0 },
+                { 2969, 0, 0, 13, 1, 0 }, { 2970, 0, 0, 13, 1, 0 }, { 2971, 0, 0, 13, 1, 0 }, { 2972, 0, 0, 13, 1, 0 },
+                { 2973, 0, 0, 13, 1, 0 }, { 2974, 0, 0, 13, 1, 0 }, { 2975, 0, 0, 13, 1, 0 }, { 2976, 0, 0, 13, 1, 0 },
+                { 2977, 0, 0, 13, 1, 0 }, { 2978, 0, 0, 13, 1, 0 }, { 2979, 0, 0, 13, 1, 0 }, { 2980, 0, 0, 13, 1, 0 },
+                { 2981, 0, 0, 13, 1, 0 }, { 2982, 0, 0, 13, 1, 0 }, { 2983, 0, 0, 13, 1, 0 }, { 2984, 0, 0, 13, 1, 0 },
+                { 2985, 0, 0, 13, 1, 0 }, { 2986, 0, 0, 13, 1, 0 }, { 2987, 0, 0, 13, 1, 0 }, { 2988, 0, 0, 13, 1, 0 },
+                { 2989, 0, 0, 13, 1, 0 }, { 2990, 0, 0, 13, 1, 0 }, { 2991, 0, 0, 13, 1, 0 }, { 2992, 0, 0, 13, 1, 0 },
+                { 2993, 0, 0, 13, 1, 0 }, { 2994, 0, 0, 13, 1, 0 }, { 2995, 0, 0, 13, 1, 0 }, { 2996, 0, 0, 13, 1, 0 },
+                { 2997, 0, 0, 13, 1, 0 }, { 2998, 0, 0, 13, 1, 0 }, { 2999, 0, 0, 13, 1, 0 }, { 3000, 0, 0, 13, 1, 0 },
+                { 3001, 0, 0, 13, 1, 0 }, { 3002, 0, 0, 13, 1, 0 }, { 3003, 0, 0, 13, 1, 0 }, { 3004, 0, 0, 13, 1, 0 },
+                { 3005, 0, 0, 13, 1, 0 }, { 3006, 0, 0, 13, 1, 0 }, { 3007, 0, 0, 13, 1, 0 }, { 3008, 0, 0, 13, 1, 0 },
+                { 3009, 0, 0, 13, 1, 0 }, { 3010, 0, 0, 13, 1, 0 }, { 3011, 0, 0, 13, 1, 0 }, { 3012, 0, 0, 13, 1, 0 },
+                { 3013, 0, 0, 13, 1, 0 }, { 3014, 0, 0, 13, 1, 0 }, { 3015, 0, 0, 13, 1, 0 }, { 3016, 0, 0, 13, 1, 0 },
+                { 3017, 0, 0, 13, 1, 0 }, { 3018, 0, 0, 13, 1, 0 }, { 3019, 0, 0, 13, 1, 0 }, { 3020, 0, 0, 13, 1, 0 },
+                { 3021, 0, 0, 13, 1, 0 }, { 3022, 0, 0, 13, 1, 0 }, { 3023, 0, 0, 13, 1, 0 }, { 3024, 0, 0, 13, 1, 0 },
+                { 3025, 0, 0, 13, 1, 0 }, { 3026, 0, 0, 13, 1, 0 }, { 3027, 0, 0, 13, 1, 0 }, { 3028, 0, 0, 13, 1, 0 },
+                { 3029, 0, 0, 13, 1, 0 }, { 3030, 0, 0, 13, 1, 0 }, { 3031, 0, 0, 13, 1, 0 }, { 3032, 0, 0, 13, 1, 0 },
+                { 3033, 0, 0, 13, 1, 0 }, { 3034, 0, 0, 13, 1, 0 }, { 3035, 0, 0, 13, 1, 0 }, { 3036, 0, 0, 13, 1, 0 },
+                { 3037, 0, 0, 13, 1, 0 }, { 3038, 0, 0, 13, 1, 0 }, { 3039, 0, 0, 13, 1, 0 }, { 3040, 0, 0, 13, 1, 0 },
+                { 3041, 0, 0, 13, 1, 0 }, { 3042, 0, 0, 13, 1, 0 }, { 3043, 0, 0, 13, 1, 0 }, { 3044, 0, 0, 13, 1, 0 },
+                { 3045, 0, 0, 13, 1, 0 }, { 3046, 0, 0, 13, 1, 0 }, { 3047, 0, 0, 13, 1, 0 }, { 3048, 0, 0, 13, 1, 0 },
+                { 3049, 0, 0, 13, 1, 0 }, { 3050, 0, 0, 13, 1, 0 }, { 3051, 0, 0, 13, 1, 0 }, { 3052, 0, 0, 13, 1, 0 },
+                { 3053, 0, 0, 13, 1, 0 }, { 3054, 0, 0, 13, 1, 0 }, { 3055, 0, 0, 13, 1, 0 }, { 3056, 0, 0, 13, 1, 0 },
+                { 3057, 0, 0, 13, 1, 0 }, { 3058, 0, 0, 13, 1, 0 }, { 3059, 0, 0, 13, 1, 0 }, { 3060, 0, 0, 13, 1, 0 },
+                { 3061, 0, 0, 13, 1, 0 }, { 3062, 0, 0, 13, 1, 0 }, { 3063, 0, 0, 13, 1, 0 }, { 3064, 0, 0, 13, 1, 0 },
+                { 3065, 0, 0, 13, 1, 0 }, { 3066, 0, 0, 13, 1, 0 }, { 3067, 0, 0, 13, 1, 0 }, { 3068, 0, 0, 13, 1, 0 },
+                { 3069, 0, 0, 13, 1, 0 }, { 3070, 0, 0, 13, 1, 0 }, { 3071, 0, 0, 13, 1, 0 }, { 3072, 0, 0, 13, 1, 0 },
+                { 3073, 0, 0, 13, 1, 0 }, { 3074, 0, 0, 13, 1, 0 }, { 3075, 0, 0, 13, 1, 0 }, { 3076, 0, 0, 13, 1, 0 },
+                { 3077, 0, 0, 13, 1, 0 }, { 3078, 0, 0, 13, 1, 0 }, { 3079, 0, 0, 13, 1, 0 }, { 3080, 0, 0, 13, 1, 0 },
+                { 3081, 0, 0, 13, 1, 0 }, { 3082, 0, 0, 13, 1, 0 }, { 3083, 0, 0, 13, 1, 0 }, { 3084, 0, 0, 13, 1, 0 },
+                { 3085, 0, 0, 13, 1, 0 }, { 3086, 0, 0, 13, 1, 0 }, { 3087, 0, 0, 13, 1, 0 }, { 3088, 0, 0, 13, 1, 0 },
+                { 3089, 0, 0, 13, 1, 0 }, { 3090, 0, 0, 13, 1, 0 }, { 3091, 0, 0, 13, 1, 0 }, { 3092, 0, 0, 13, 1, 0 },
+                { 3093, 0, 0, 13, 1, 0 }, { 3094, 0, 0, 13, 1, 0 }, { 3095, 0, 0, 13, 1, 0 }, { 3096, 0, 0, 13, 1, 0 },
+                { 3097, 0, 0, 13, 1, 0 }, { 3098, 0, 0, 13, 1, 0 }, { 3099, 0, 0, 13, 1, 0 }, { 3100, 0, 0, 13, 1, 0 },
+                { 3101, 0, 0, 13, 1, 0 }, { 3102, 0, 0, 13, 1, 0 }, { 3103, 0, 0, 13, 1, 0 }, { 3104, 0, 0, 13, 1, 0 },
+                { 3105, 0, 0, 13, 1, 0 }, { 3106, 0, 0, 13, 1, 0 }, { 3107, 0, 0, 13, 1, 0 }, { 3108, 0, 0, 13, 1, 0 },
+                { 3109, 0, 0, 13, 1, 0 }, { 3110, 0, 0, 13, 1, 0 }, { 3111, 0, 0, 13, 1, 0 }, { 3112, 0, 0, 13, 1, 0 },
+                { 3113, 0, 0, 13, 1, 0 }, { 3114, 0, 0, 13, 1, 0 }, { 3115, 0, 0, 13, 1, 0 }, { 3116, 0, 0, 13, 1, 0 },
+                { 3117, 0, 0, 13, 1, 0 }, { 3118, 0, 0, 13, 1, 0 }, { 3119, 0, 0, 13, 1, 0 }, { 3120, 0, 0, 13, 1, 0 },
+                { 3121, 0, 0, 13, 1, 0 }, { 3122, 0, 0, 13, 1, 0 }, { 3123, 0, 0, 13, 1, 0 }, { 3124, 0, 0, 13, 1, 0 },
+                { 3125, 0, 0, 13, 1, 0 }, { 3126, 0, 0, 13, 1, 0 }, { 3127, 0, 0, 13, 1, 0 }, { 3128, 0, 0, 13, 1, 0 },
+                { 3129, 0, 0, 13, 1, 0 }, { 3130, 0, 0, 13, 1, 0 }, { 3131, 0, 0, 13, 1, 0 }, { 3132, 0, 0, 13, 1, 0 },
+                { 3133, 0, 0, 13, 1, 0 }, { 3134, 0, 0, 13, 1, 0 }, { 3135, 0, 0, 13, 1, 0 }, { 3136, 0, 0, 13, 1, 0 },
+                { 3137, 0, 0, 13, 1, 0 }, { 3138, 0, 0, 13, 1, 0 }, { 3139, 0, 0, 13, 1, 0 }, { 3140, 0, 0, 13, 1, 0 },
+                { 3141, 0, 0, 13, 1, 0 }, { 3142, 0, 0, 13, 1, 0 }, { 3143, 0, 0, 13, 1, 0 }, { 3144, 0, 0, 13, 1, 0 },
+                { 3145, 0, 0, 13, 1, 0 }, { 3146, 0, 0, 13, 1, 0 }, { 3147, 0, 0, 13, 1, 0 }, { 3148, 0, 0, 13, 1, 0 },
+                { 3149, 0, 0, 13, 1, 0 }, { 3150, 0, 0, 13, 1, 0 }, { 3151, 0, 0, 13, 1, 0 }, { 3152, 0, 0, 13, 1, 0 },
+                { 3153, 0, 0, 13, 1, 0 }, { 3154, 0, 0, 13, 1, 0 }, { 3155, 0, 0, 13, 1, 0 }, { 3156, 0, 0, 13, 1, 0 },
+                { 3157, 0, 0, 13, 1, 0 }, { 3158, 0, 0, 13, 1, 0 }, { 3159, 0, 0, 13, 1, 0 }, { 3160, 0, 0, 13, 1, 0 },
+                { 3161, 0, 0, 13, 1, 0 }, { 3162, 0, 0, 13, 1, 0 }, { 3163, 0, 0, 13, 1, 0 }, { 3164, 0, 0, 13, 1, 0 },
+                { 3165, 0, 0, 13, 1, 0 }, { 3166, 0, 0, 13, 1, 0 }, { 3167, 0, 0, 13, 1, 0 }, { 3168, 0, 0, 13, 1, 0 },
+                { 3169, 0, 0, 13, 1, 0 }, { 3170, 0, 0, 13, 1, 0 }, { 3171, 0, 0, 13, 1, 0 }, { 3172, 0, 0, 13, 1, 0 },
+                { 3173, 0, 0, 13, 1, 0 }, { 3174, 0, 0, 13, 1, 0 }, { 3175, 0, 0, 13, 1, 0 }, { 3176, 0, 0, 13, 1, 0 },
+                { 3177, 0, 0, 13, 1, 0 }, { 3178, 0, 0, 13, 1, 0 }, { 3179, 0, 0, 13, 1, 0 }, { 3180, 0, 0, 13, 1, 0 },
+                { 3181, 0, 0, 13, 1, 0 }, { 3182, 0, 0, 13, 1, 0 }, { 3183, 0, 0, 13, 1, 0 }, { 3184, 0, 0, 13, 1, 0 },
+                { 3185, 0, 0, 13, 1, 0 }, { 3186, 0, 0, 13, 1, 0 }, { 3187, 0, 0, 13, 1, 0 }, { 3188, 0, 0, 13, 1, 0 },
+                { 3189, 0, 0, 13, 1, 0 }, { 3190, 0, 0, 13, 1, 0 }, { 3191, 0, 0, 13, 1, 0 }, { 3192, 0, 0, 13, 1, 0 },
+                { 3193, 0, 0, 13, 1, 0 }, { 3194, 0, 0, 13, 1, 0 }, { 3195, 0, 0, 13, 1, 0 }, { 3196, 0, 0, 13, 1, 0 },
+                { 3197, 0, 0, 13, 1, 0 }, { 3198, 0, 0, 13, 1, 0 }, { 3199, 0, 0, 13, 1, 0 }, { 3200, 0, 0, 13, 1, 0 },
+                { 3201, 0, 0, 13, 1, 0 }, { 3202, 0, 0, 13, 1, 0 }, { 3203, 0, 0, 13, 1, 0 }, { 3204, 0, 0, 13, 1, 0 },
+                { 3205, 0, 0, 13, 1, 0 }, { 3206, 0, 0, 13, 1, 0 }, { 3207, 0, 0, 13, 1, 0 }, { 3208, 0, 0, 13, 1, 0 },
+                { 3209, 0, 0, 13, 1, 0 }, { 3210, 0, 0, 13, 1, 0 }, { 3211, 0, 0, 13, 1, 0 }, { 3212, 0, 0, 13, 1, 0 },
+                { 3213, 0, 0, 13, 1, 0 }, { 3214, 0, 0, 13, 1, 0 }, { 3215, 0, 0, 13, 1, 0 }, { 3216, 0, 0, 13, 1, 0 },
+                { 3217, 0, 0, 13, 1, 0 }, { 3218, 0, 0, 13, 1, 0 }, { 3219, 0, 0, 13, 1, 0 }, { 3220, 0, 0, 13, 1, 0 },
+                { 3221, 0, 0, 13, 1, 0 }, { 3222, 0, 0, 13, 1, 0 }, { 3223, 0, 0, 13, 1, 0 }, { 3224, 0, 0, 13, 1, 0 },
+                { 3225, 0, 0, 13, 1, 0 }, { 3226, 0, 0, 13, 1, 0 }, { 3227, 0, 0, 13, 1, 0 }, { 3228, 0, 0, 13, 1, 0 },
+                { 3229, 0, 0, 13, 1, 0 }, { 3230, 0, 0, 13, 1, 0 }, { 3231, 0, 0, 13, 1, 0 }, { 3232, 0, 0, 13, 1, 0 },
+                { 3233, 0, 0, 13, 1, 0 }, { 3234, 0, 0, 13, 1, 0 }, { 3235, 0, 0, 13, 1, 0 }, { 3236, 0, 0, 13, 1, 0 },
+                { 3237, 0, 0, 13, 1, 0 }, { 3238, 0, 0, 13, 1, 0 }, { 3239, 0, 0, 13, 1, 0 }, { 3240, 0, 0, 13, 1, 0 },
+                { 3241, 0, 0, 13, 1, 0 }, { 3242, 0, 0, 13, 1, 0 }, { 3243, 0, 0, 13, 1, 0 }, { 3244, 0, 0, 13, 1, 0 },
+                { 3245, 0, 0, 13, 1, 0 }, { 3246, 0, 0, 13, 1, 0 }, { 3247, 0, 0, 13, 1, 0 }, { 3248, 0, 0, 13, 1, 0 },
+                { 3249, 0, 0, 13, 1, 0 }, { 3250, 0, 0, 13, 1, 0 }, { 3251, 0, 0, 13, 1, 0 }, { 3252, 0, 0, 13, 1, 0 },
+                { 3253, 0, 0, 13, 1, 0 }, { 3254, 0, 0, 13, 1, 0 }, { 3255, 0, 0, 13, 1, 0 }, { 3256, 0, 0, 13, 1, 0 },
+                { 3257, 0, 0, 13, 1, 0 }, { 3258, 0, 0, 13, 1, 0 }, { 3259, 0, 0, 13, 1, 0 }, { 3260, 0, 0, 13, 1, 0 },
+                { 3261, 0, 0, 13, 1, 0 }, { 3262, 0, 0, 13, 1, 0 }, { 3263, 0, 0, 13, 1, 0 }, { 3264, 0, 0, 13, 1, 0 },
+                { 3265, 0, 0, 13, 1, 0 }, { 3266, 0, 0, 13, 1, 0 }, { 3267, 0, 0, 13, 1, 0 }, { 3268, 0, 0, 13, 1, 0 },
+                { 3269, 0, 0, 13, 1, 0 }, { 3270, 0, 0, 13, 1, 0 }, { 3271, 0, 0, 13, 1, 0 }, { 3272, 0, 0, 13, 1, 0 },
+                { 3273, 0, 0, 13, 1, 0 }, { 3274, 0, 0, 13, 1, 0 }, { 3275, 0, 0, 13, 1, 0 }, { 3276, 0, 0, 13, 1, 0 },
+                { 3277, 0, 0, 13, 1, 0 }, { 3278, 0, 0, 13, 1, 0 }, { 3279, 0, 0, 13, 1, 0 }, { 3280, 0, 0, 13, 1, 0 },
+                { 3281, 0, 0, 13, 1, 0 }, { 3282, 0, 0, 13, 1, 0 }, { 3283, 0, 0, 13, 1, 0 }, { 3284, 0, 0, 13, 1, 0 },
+                { 3285, 0, 0, 13, 1, 0 }, { 3286, 0, 0, 13, 1, 0 }, { 3287, 0, 0, 13, 1, 0 }, { 3288, 0, 0, 13, 1, 0 },
+                { 3289, 0, 0, 13, 1, 0 }, { 3290, 0, 0, 13, 1, 0 }, { 3291, 0, 0, 13, 1, 0 }, { 3292, 0, 0, 13, 1, 0 },
+                { 3293, 0, 0, 13, 1, 0 }, { 3294, 0, 0, 13, 1, 0 }, { 3295, 0, 0, 13, 1, 0 }, { 3296, 0, 0, 13, 1, 0 },
+                { 3297, 0, 0, 13, 1, 0 }, { 3298, 0, 0, 13, 1, 0 }, { 3299, 0, 0, 13, 1, 0 }, { 3300, 0, 0, 13, 1, 0 },
+                { 3301, 0, 0, 13, 1, 0 }, { 3302, 0, 0, 13, 1, 0 }, { 3303, 0, 0, 13, 1, 0 }, { 3304, 0, 0, 13, 1, 0 },
+                { 3305, 0, 0, 13, 1, 0 }, { 3306, 0, 0, 13, 1, 0 }, { 3307, 0, 0, 13, 1, 0 }, { 3308, 0, 0, 13, 1, 0 },
+                { 3309, 0, 0, 13, 1, 0 }, { 3310, 0, 0, 13, 1, 0 }, { 3311, 0, 0, 13, 1, 0 }, { 3312, 0, 0, 13, 1, 0 },
+                { 3313, 0, 0, 13, 1, 0 }, { 3314, 0, 0, 13, 1, 0 }, { 3315, 0, 0, 13, 1, 0 }, { 3316, 0, 0, 13, 1, 0 },
+                { 3317, 0, 0, 13, 1, 0 }, { 3318, 0, 0, 13, 1, 0 }, { 3319, 0, 0, 13, 1, 0 }, { 3320, 0, 0, 13, 1, 0 },
+                { 3321, 0, 0, 13, 1, 0 }, { 3322, 0, 0, 13, 1, 0 }, { 3323, 0, 0, 13, 1, 0 }, { 3324, 0, 0, 13, 1, 0 },
+                { 3325, 0, 0, 13, 1, 0 }, { 3326, 0, 0, 13, 1, 0 }, { 3327, 0, 0, 13, 1, 0 }, { 3328, 0, 0, 13, 1, 0 },
+                { 3329, 0, 0, 13, 1, 0 }, { 3330, 0, 0, 13, 1, 0 }, { 3331, 0, 0, 13, 1, 0 }, { 3332, 0, 0, 13, 1, 0 },
+                { 3333, 0, 0, 13, 1, 0 }, { 3334, 0, 0, 13, 1, 0 }, { 3335, 0, 0, 13, 1, 0 }, { 3336, 0, 0, 13, 1, 0 },
+                { 3337, 0, 0, 13, 1, 0 }, { 3338, 0, 0, 13, 1, 0 }, { 3339, 0, 0, 13, 1, 0 }, { 3340, 0, 0, 13, 1, 0 },
+                { 3341, 0, 0, 13, 1, 0 }, { 3342, 0, 0, 13, 1, 0 }, { 3343, 0, 0, 13, 1, 0 }, { 3344, 0, 0, 13, 1, 0 },
+                { 3345, 0, 0, 13, 1, 0 }, { 3346, 0, 0, 13, 1, 0 }, { 3347, 0, 0, 13, 1, 0 }, { 3348, 0, 0, 13, 1, 0 },
+                { 3349, 0, 0, 13, 1, 0 }, { 3350, 0, 0, 13, 1, 0 }, { 3351, 0, 0, 13, 1, 0 }, { 3352, 0, 0, 13, 1, 0 },
+                { 3353, 0, 0, 13, 1, 0 }, { 3354, 0, 0, 13, 1, 0 }, { 3355, 0, 0, 13, 1, 0 }, { 3356, 0, 0, 13, 1, 0 },
+                { 3357, 0, 0, 13, 1, 0 }, { 3358, 0, 0, 13, 1, 0 }, { 3359, 0, 0, 13, 1, 0 }, { 3360, 0, 0, 13, 1, 0 },
+                { 3361, 0, 0, 13, 1, 0 }, { 3362, 0, 0, 13, 1, 0 }, { 3363, 0, 0, 13, 1, 0 }, { 3364, 0, 0, 13, 1, 0 },
+                { 3365, 0, 0, 13, 1, 0 }, { 3366, 0, 0, 13, 1, 0 }, { 3367, 0, 0, 13, 1, 0 }, { 3368, 0, 0, 13, 1, 0 },
+                { 3369, 0, 0, 13, 1, 0 }, { 3370, 0, 0, 13, 1, 0 }, { 3371, 0, 0, 13, 1, 0 }, { 3372, 0, 0, 13, 1, 0 },
+                { 3373, 0, 0, 13, 1, 0 }, { 3374, 0, 0, 13, 1, 0 }, { 3375, 0, 0, 13, 1, 0 }, { 3376, 0, 0, 13, 1, 0 },
+                { 3377, 0, 0, 13, 1, 0 }, { 3378, 0, 0, 13, 1, 0 }, { 3379, 0, 0, 13, 1, 0 }, { 3380, 0, 0, 13, 1, 0 },
+                { 3381, 0, 0, 13, 1, 0 }, { 3382, 0, 0, 13, 1, 0 }, { 3383, 0, 0, 13, 1, 0 }, { 3384, 0, 0, 13, 1, 0 },
+                { 3385, 0, 0, 13, 1, 0 }, { 3386, 0, 0, 13, 1, 0 }, { 3387, 0, 0, 13, 1, 0 }, { 3388, 0, 0, 13, 1, 0 },
+                { 3389, 0, 0, 13, 1, 0 }, { 3390, 0, 0, 13, 1, 0 }, { 3391, 0, 0, 13, 1, 0 }, { 3392, 0, 0, 13, 1, 0 },
+                { 3393, 0, 0, 13, 1, 0 }, { 3394, 0, 0, 13, 1, 0 }, { 3395, 0, 0, 13, 1, 0 }, { 3396, 0, 0, 13, 1, 0 },
+                { 3397, 0, 0, 13, 1, 0 }, { 3398, 0, 0, 13, 1, 0 }, { 3399, 0, 0, 13, 1, 0 }, { 3400, 0, 0, 13, 1, 0 },
+                { 3401, 0, 0, 13, 1, 0 }, { 3402, 0, 0, 13, 1, 0 }, { 3403, 0, 0, 13, 1, 0 }, { 3404, 0, 0, 13, 1, 0 },
+                { 3405, 0, 0, 13, 1, 0 },
+            };
+            char32_t const decompositions[3406] = {
+                0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303,
+                0x0041, 0x0308, 0x0041, 0x030A, 0x0043, 0x0327, 0x0045, 0x0300,
+                0x0045, 0x0301, 0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300,
+                0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308, 0x004E, 0x0303,
+                0x004F, 0x0300, 0x004F, 0x0301, 0x004F, 0x0302, 0x004F, 0x0303,
+                0x004F, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302,
+                0x0055, 0x0308, 0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301,
+                0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A,
+                0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+                0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302,
+                0x0069, 0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+                0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300,
+                0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+                0x0079, 0x0308, 0x0041, 0x0304, 0x0061, 0x0304, 0x0041, 0x0306,
+                0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+                0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307,
+                0x0063, 0x0307, 0x0043, 0x030C, 0x0063, 0x030C, 0x0044, 0x030C,
+                0x0064, 0x030C, 0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306,
+                0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328,
+                0x0065, 0x0328, 0x0045, 0x030C, 0x0065, 0x030C, 0x0047, 0x0302,
+                0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307,
+                0x0067, 0x0307, 0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302,
+                0x0068, 0x0302, 0x0049, 0x0303, 0x0069, 0x0303, 0x0049, 0x0304,
+                0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328,
+                0x0069, 0x0328, 0x0049, 0x0307, 0x004A, 0x0302, 0x006A, 0x0302,
+                0x004B, 0x0327, 0x006B, 0x0327, 0x004C, 0x0301, 0x006C, 0x0301,
+                0x004C, 0x0327, 0x006C, 0x0327, 0x004C, 0x030C, 0x006C, 0x030C,
+                0x004E, 0x0301, 0x006E, 0x0301, 0x004E, 0x0327, 0x006E, 0x0327,
+                0x004E, 0x030C, 0x006E, 0x030C, 0x004F, 0x0304, 0x006F, 0x0304,
+                0x004F, 0x0306, 0x006F, 0x0306, 0x004F, 0x030B, 0x006F, 0x030B,
+                0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327,
+                0x0052, 0x030C, 0x0072, 0x030C, 0x0053, 0x0301, 0x0073, 0x0301,
+                0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327,
+                0x0053, 0x030C, 0x0073, 0x030C, 0x0054, 0x0327, 0x0074, 0x0327,
+                0x0054, 0x030C, 0x0074, 0x030C, 0x0055, 0x0303, 0x0075, 0x0303,
+                0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306, 0x0075, 0x0306,
+                0x0055, 0x030A, 0x0075, 0x030A, 0x0055, 0x030B, 0x0075, 0x030B,
+                0x0055, 0x0328, 0x0075, 0x0328, 0x0057, 0x0302, 0x0077, 0x0302,
+                0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005A, 0x0301,
+                0x007A, 0x0301, 0x005A, 0x0307, 0x007A, 0x0307, 0x005A, 0x030C,
+                0x007A, 0x030C, 0x004F, 0x031B, 0x006F, 0x031B, 0x0055, 0x031B,
+                0x0075, 0x031B, 0x0041, 0x030C, 0x0061, 0x030C, 0x0049, 0x030C,
+                0x0069, 0x030C, 0x004F, 0x030C, 0x006F, 0x030C, 0x0055, 0x030C,
+                0x0075, 0x030C, 0x0055, 0x0308, 0x0304, 0x0075, 0x0308, 0x0304,
+                0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+                0x030C, 0x0075, 0x0308, 0x030C, 0x0055, 0x0308, 0x0300, 0x0075,
+                0x0308, 0x0300, 0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304,
+                0x0041, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304, 0x00C6, 0x0304,
+                0x00E6, 0x0304, 0x0047, 0x030C, 0x0067, 0x030C, 0x004B, 0x030C,
+                0x006B, 0x030C, 0x004F, 0x0328, 0x006F, 0x0328, 0x004F, 0x0328,
+                0x0304, 0x006F, 0x0328, 0x0304, 0x01B7, 0x030C, 0x0292, 0x030C,
+                0x006A, 0x030C, 0x0047, 0x0301, 0x0067, 0x0301, 0x004E, 0x0300,
+                0x006E, 0x0300, 0x0041, 0x030A, 0x0301, 0x0061, 0x030A, 0x0301,
+                0x00C6, 0x0301, 0x00E6, 0x0301, 0x00D8, 0x0301, 0x00F8, 0x0301,
+                0x0041, 0x030F, 0x0061, 0x030F, 0x0041, 0x0311, 0x0061, 0x0311,
+                0x0045, 0x030F, 0x0065, 0x030F, 0x0045, 0x0311, 0x0065, 0x0311,
+                0x0049, 0x030F, 0x0069, 0x030F, 0x0049, 0x0311, 0x0069, 0x0311,
+                0x004F, 0x030F, 0x006F, 0x030F, 0x004F, 0x0311, 0x006F, 0x0311,
+                0x0052, 0x030F, 0x0072, 0x030F, 0x0052, 0x0311, 0x0072, 0x0311,
+                0x0055, 0x030F, 0x0075, 0x030F, 0x0055, 0x0311, 0x0075, 0x0311,
+                0x0053, 0x0326, 0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326,
+                0x0048, 0x030C, 0x0068, 0x030C, 0x0041, 0x0307, 0x0061, 0x0307,
+                0x0045, 0x0327, 0x0065, 0x0327, 0x004F, 0x0308, 0x0304, 0x006F,
+                0x0308, 0x0304, 0x004F, 0x0303, 0x0304, 0x006F, 0x0303, 0x0304,
+                0x004F, 0x0307, 0x006F, 0x0307, 0x004F, 0x0307, 0x0304, 0x006F,
+                0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0300, 0x0301,
+                0x0313, 0x0308, 0x0301, 0x02B9, 0x003B, 0x00A8, 0x0301, 0x0391,
+                0x0301, 0x00B7, 0x0395, 0x0301, 0x0397, 0x0301, 0x0399, 0x0301,
+                0x039F, 0x0301, 0x03A5, 0x0301, 0x03A9, 0x0301, 0x03B9, 0x0308,
+                0x0301, 0x0399, 0x0308, 0x03A5, 0x0308, 0x03B1, 0x0301, 0x03B5,
+                0x0301, 0x03B7, 0x0301, 0x03B9, 0x0301, 0x03C5, 0x0308, 0x0301,
+                0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301,
+                0x03C9, 0x0301, 0x03D2, 0x0301, 0x03D2, 0x0308, 0x0415, 0x0300,
+                0x0415, 0x0308, 0x0413, 0x0301, 0x0406, 0x0308, 0x041A, 0x0301,
+                0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306,
+                0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308,
+                0x043A, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030F,
+                0x0475, 0x030F, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306,
+                0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306,
+                0x0435, 0x0306, 0x04D8, 0x0308, 0x04D9, 0x0308, 0x0416, 0x0308,
+                0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304,
+                0x0438, 0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041E, 0x0308,
+                0x043E, 0x0308, 0x04E8, 0x0308, 0x04E9, 0x0308, 0x042D, 0x0308,
+                0x044D, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308,
+                0x0443, 0x0308, 0x0423, 0x030B, 0x0443, 0x030B, 0x0427, 0x0308,
+                0x0447, 0x0308, 0x042B, 0x0308, 0x044B, 0x0308, 0x0627, 0x0653,
+                0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A, 0x0654,
+                0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928, 0x093C,
+                0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C,
+                0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922, 0x093C,
+                0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7,
+                0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C,
+                0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C,
+                0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57,
+                0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE,
+                0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5,
+                0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2,
+                0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9,
+                0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF,
+                0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56, 0x0FB7,
+                0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71, 0x0F74,
+                0x0FB2, 0x0F80, 0x0FB3, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7,
+                0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7,
+                0x0F90, 0x0FB5, 0x1025, 0x102E, 0x1B05, 0x1B35, 0x1B07, 0x1B35,
+                0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35,
+                0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35,
+                0x1B42, 0x1B35, 0x0041, 0x0325, 0x0061, 0x0325, 0x0042, 0x0307,
+                0x0062, 0x0307, 0x0042, 0x0323, 0x0062, 0x0323, 0x0042, 0x0331,
+                0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063, 0x0327, 0x0301,
+                0x0044, 0x0307, 0x0064, 0x0307, 0x0044, 0x0323, 0x0064, 0x0323,
+                0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327, 0x0064, 0x0327,
+                0x0044, 0x032D, 0x0064, 0x032D, 0x0045, 0x0304, 0x0300, 0x0065,
+                0x0304, 0x0300, 0x0045, 0x0304, 0x0301, 0x0065, 0x0304, 0x0301,
+                0x0045, 0x032D, 0x0065, 0x032D, 0x0045, 0x0330, 0x0065, 0x0330,
+                0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0046, 0x0307,
+                0x0066, 0x0307, 0x0047, 0x0304, 0x0067, 0x0304, 0x0048, 0x0307,
+                0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323, 0x0048, 0x0308,
+                0x0068, 0x0308, 0x0048, 0x0327, 0x0068, 0x0327, 0x0048, 0x032E,
+                0x0068, 0x032E, 0x0049, 0x0330, 0x0069, 0x0330, 0x0049, 0x0308,
+                0x0301, 0x0069, 0x0308, 0x0301, 0x004B, 0x0301, 0x006B, 0x0301,
+                0x004B, 0x0323, 0x006B, 0x0323, 0x004B, 0x0331, 0x006B, 0x0331,
+                0x004C, 0x0323, 0x006C, 0x0323, 0x004C, 0x0323, 0x0304, 0x006C,
+                0x0323, 0x0304, 0x004C, 0x0331, 0x006C, 0x0331, 0x004C, 0x032D,
+                0x006C, 0x032D, 0x004D, 0x0301, 0x006D, 0x0301, 0x004D, 0x0307,
+                0x006D, 0x0307, 0x004D, 0x0323, 0x006D, 0x0323, 0x004E, 0x0307,
+                0x006E, 0x0307, 0x004E, 0x0323, 0x006E, 0x0323, 0x004E, 0x0331,
+                0x006E, 0x0331, 0x004E, 0x032D, 0x006E, 0x032D, 0x004F, 0x0303,
+                0x0301, 0x006F, 0x0303, 0x0301, 0x004F, 0x0303, 0x0308, 0x006F,
+                0x0303, 0x0308, 0x004F, 0x0304, 0x0300, 0x006F, 0x0304, 0x0300,
+                0x004F, 0x0304, 0x0301, 0x006F, 0x0304, 0x0301, 0x0050, 0x0301,
+                0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307, 0x0052, 0x0307,
+                0x0072, 0x0307, 0x0052, 0x0323, 0x0072, 0x0323, 0x0052, 0x0323,
+                0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331, 0x0072, 0x0331,
+                0x0053, 0x0307, 0x0073, 0x0307, 0x0053, 0x0323, 0x0073, 0x0323,
+                0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0053, 0x030C,
+                0x0307, 0x0073, 0x030C, 0x0307, 0x0053, 0x0323, 0x0307, 0x0073,
+                0x0323, 0x0307, 0x0054, 0x0307, 0x0074, 0x0307, 0x0054, 0x0323,
+                0x0074, 0x0323, 0x0054, 0x0331, 0x0074, 0x0331, 0x0054, 0x032D,
+                0x0074, 0x032D, 0x0055, 0x0324, 0x0075, 0x0324, 0x0055, 0x0330,
+                0x0075, 0x0330, 0x0055, 0x032D, 0x0075, 0x032D, 0x0055, 0x0303,
+                0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308, 0x0075,
+                0x0304, 0x0308, 0x0056, 0x0303, 0x0076, 0x0303, 0x0056, 0x0323,
+                0x0076, 0x0323, 0x0057, 0x0300, 0x0077, 0x0300, 0x0057, 0x0301,
+                0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308, 0x0057, 0x0307,
+                0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323, 0x0058, 0x0307,
+                0x0078, 0x0307, 0x0058, 0x0308, 0x0078, 0x0308, 0x0059, 0x0307,
+                0x0079, 0x0307, 0x005A, 0x0302, 0x007A, 0x0302, 0x005A, 0x0323,
+                0x007A, 0x0323, 0x005A, 0x0331, 0x007A, 0x0331, 0x0068, 0x0331,
+                0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A, 0x017F, 0x0307,
+                0x0041, 0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309,
+                0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302,
+                0x0300, 0x0061, 0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x0061,
+                0x0302, 0x0309, 0x0041, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303,
+                0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0041, 0x0306,
+                0x0301, 0x0061, 0x0306, 0x0301, 0x0041, 0x0306, 0x0300, 0x0061,
+                0x0306, 0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309,
+                0x0041, 0x0306, 0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323,
+                0x0306, 0x0061, 0x0323, 0x0306, 0x0045, 0x0323, 0x0065, 0x0323,
+                0x0045, 0x0309, 0x0065, 0x0309, 0x0045, 0x0303, 0x0065, 0x0303,
+                0x0045, 0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302,
+                0x0300, 0x0065, 0x0302, 0x0300, 0x0045, 0x0302, 0x0309, 0x0065,
+                0x0302, 0x0309, 0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303,
+                0x0045, 0x0323, 0x0302, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309,
+                0x0069, 0x0309, 0x0049, 0x0323, 0x0069, 0x0323, 0x004F, 0x0323,
+                0x006F, 0x0323, 0x004F, 0x0309, 0x006F, 0x0309, 0x004F, 0x0302,
+                0x0301, 0x006F, 0x0302, 0x0301, 0x004F, 0x0302, 0x0300, 0x006F,
+                0x0302, 0x0300, 0x004F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0309,
+                0x004F, 0x0302, 0x0303, 0x006F, 0x0302, 0x0303, 0x004F, 0x0323,
+                0x0302, 0x006F, 0x0323, 0x0302, 0x004F, 0x031B, 0x0301, 0x006F,
+                0x031B, 0x0301, 0x004F, 0x031B, 0x0300, 0x006F, 0x031B, 0x0300,
+                0x004F, 0x031B, 0x0309, 0x006F, 0x031B, 0x0309, 0x004F, 0x031B,
+                0x0303, 0x006F, 0x031B, 0x0303, 0x004F, 0x031B, 0x0323, 0x006F,
+                0x031B, 0x0323, 0x0055, 0x0323, 0x0075, 0x0323, 0x0055, 0x0309,
+                0x0075, 0x0309, 0x0055, 0x031B, 0x0301, 0x0075, 0x031B, 0x0301,
+                0x0055, 0x031B, 0x0300, 0x0075, 0x031B, 0x0300, 0x0055, 0x031B,
+                0x0309, 0x0075, 0x031B, 0x0309, 0x0055, 0x031B, 0x0303, 0x0075,
+                0x031B, 0x0303, 0x0055, 0x031B, 0x0323, 0x0075, 0x031B, 0x0323,
+                0x0059, 0x0300, 0x0079, 0x0300, 0x0059, 0x0323, 0x0079, 0x0323,
+                0x0059, 0x0309, 0x0079, 0x0309, 0x0059, 0x0303, 0x0079, 0x0303,
+                0x03B1, 0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1,
+                0x0314, 0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301,
+                0x03B1, 0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x0391, 0x0313,
+                0x0391, 0x0314, 0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300,
+                0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313,
+                0x0342, 0x0391, 0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314,
+                0x03B5, 0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313,
+                0x0301, 0x03B5, 0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314,
+                0x0395, 0x0313, 0x0300, 0x0395, 0x0314, 0x0300, 0x0395, 0x0313,
+                0x0301, 0x0395, 0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314,
+                0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313,
+                0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7,
+                0x0314, 0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313,
+                0x0300, 0x0397, 0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397,
+                0x0314, 0x0301, 0x0397, 0x0313, 0x0342, 0x0397, 0x0314, 0x0342,
+                0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9,
+                0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301,
+                0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x0399, 0x0313,
+                0x0399, 0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300,
+                0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313,
+                0x0342, 0x0399, 0x0314, 0x0342, 0x03BF, 0x0313, 0x03BF, 0x0314,
+                0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313,
+                0x0301, 0x03BF, 0x0314, 0x0301, 0x039F, 0x0313, 0x039F, 0x0314,
+                0x039F, 0x0313, 0x0300, 0x039F, 0x0314, 0x0300, 0x039F, 0x0313,
+                0x0301, 0x039F, 0x0314, 0x0301, 0x03C5, 0x0313, 0x03C5, 0x0314,
+                0x03C5, 0x0313, 0x0300, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313,
+                0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5,
+                0x0314, 0x0342, 0x03A5, 0x0314, 0x03A5, 0x0314, 0x0300, 0x03A5,
+                0x0314, 0x0301, 0x03A5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9,
+                0x0314, 0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9,
+                0x0313, 0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342,
+                0x03C9, 0x0314, 0x0342, 0x03A9, 0x0313, 0x03A9, 0x0314, 0x03A9,
+                0x0313, 0x0300, 0x03A9, 0x0314, 0x0300, 0x03A9, 0x0313, 0x0301,
+                0x03A9, 0x0314, 0x0301, 0x03A9, 0x0313, 0x0342, 0x03A9, 0x0314,
+                0x0342, 0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B5, 0x0300, 0x03B5,
+                0x0301, 0x03B7, 0x0300, 0x03B7, 0x0301, 0x03B9, 0x0300, 0x03B9,
+                0x0301, 0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C5, 0x0300, 0x03C5,
+                0x0301, 0x03C9, 0x0300, 0x03C9, 0x0301, 0x03B1, 0x0313, 0x0345,
+                0x03B1, 0x0314, 0x0345, 0x03B1, 0x0313, 0x0300, 0x0345, 0x03B1,
+                0x0314, 0x0300, 0x0345, 0x03B1, 0x0313, 0x0301, 0x0345, 0x03B1,
+                0x0314, 0x0301, 0x0345, 0x03B1, 0x0313, 0x0342, 0x0345, 0x03B1,
+                0x0314, 0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314,
+                0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300,
+                0x0345, 0x0391, 0x0313, 0x0301, 0x0345, 0x0391, 0x0314, 0x0301,
+                0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391, 0x0314, 0x0342,
+                0x0345, 0x03B7, 0x0313, 0x0345, 0x03B7, 0x0314, 0x0345, 0x03B7,
+                0x0313, 0x0300, 0x0345, 0x03B7, 0x0314, 0x0300, 0x0345, 0x03B7,
+                0x0313, 0x0301, 0x0345, 0x03B7, 0x0314, 0x0301, 0x0345, 0x03B7,
+                0x0313, 0x0342, 0x0345, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0397,
+                0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300,
+                0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301,
+                0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342,
+                0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03C9, 0x0313, 0x0345,
+                0x03C9, 0x0314, 0x0345, 0x03C9, 0x0313, 0x0300, 0x0345, 0x03C9,
+                0x0314, 0x0300, 0x0345, 0x03C9, 0x0313, 0x0301, 0x0345, 0x03C9,
+                0x0314, 0x0301, 0x0345, 0x03C9, 0x0313, 0x0342, 0x0345, 0x03C9,
+                0x0314, 0x0342, 0x0345, 0x03A9, 0x0313, 0x0345, 0x03A9, 0x0314,
+                0x0345, 0x03A9, 0x0313, 0x0300, 0x0345, 0x03A9, 0x0314, 0x0300,
+                0x0345, 0x03A9, 0x0313, 0x0301, 0x0345, 0x03A9, 0x0314, 0x0301,
+                0x0345, 0x03A9, 0x0313, 0x0342, 0x0345, 0x03A9, 0x0314, 0x0342,
+                0x0345, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x0345,
+                0x03B1, 0x0345, 0x03B1, 0x0301, 0x0345, 0x03B1, 0x0342, 0x03B1,
+                0x0342, 0x0345, 0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300,
+                0x0391, 0x0301, 0x0391, 0x0345, 0x03B9, 0x00A8, 0x0342, 0x03B7,
+                0x0300, 0x0345, 0x03B7, 0x0345, 0x03B7, 0x0301, 0x0345, 0x03B7,
+                0x0342, 0x03B7, 0x0342, 0x0345, 0x0395, 0x0300, 0x0395, 0x0301,
+                0x0397, 0x0300, 0x0397, 0x0301, 0x0397, 0x0345, 0x1FBF, 0x0300,
+                0x1FBF, 0x0301, 0x1FBF, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304,
+                0x03B9, 0x0308, 0x0300, 0x03B9, 0x0308, 0x0301, 0x03B9, 0x0342,
+                0x03B9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399,
+                0x0300, 0x0399, 0x0301, 0x1FFE, 0x0300, 0x1FFE, 0x0301, 0x1FFE,
+                0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308, 0x0300,
+                0x03C5, 0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1, 0x0314, 0x03C5,
+                0x0342, 0x03C5, 0x0308, 0x0342, 0x03A5, 0x0306, 0x03A5, 0x0304,
+                0x03A5, 0x0300, 0x03A5, 0x0301, 0x03A1, 0x0314, 0x00A8, 0x0300,
+                0x00A8, 0x0301, 0x0060, 0x03C9, 0x0300, 0x0345, 0x03C9, 0x0345,
+                0x03C9, 0x0301, 0x0345, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x0345,
+                0x039F, 0x0300, 0x039F, 0x0301, 0x03A9, 0x0300, 0x03A9, 0x0301,
+                0x03A9, 0x0345, 0x00B4, 0x2002, 0x2003, 0x03A9, 0x004B, 0x0041,
+                0x030A, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338, 0x21D0,
+                0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338, 0x2208,
+                0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x223C,
+                0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x003D,
+                0x0338, 0x2261, 0x0338, 0x224D, 0x0338, 0x003C, 0x0338, 0x003E,
+                0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338, 0x2273,
+                0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227A, 0x0338, 0x227B,
+                0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287,
+                0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338, 0x22A9, 0x0338, 0x22AB,
+                0x0338, 0x227C, 0x0338, 0x227D, 0x0338, 0x2291, 0x0338, 0x2292,
+                0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338, 0x22B4, 0x0338, 0x22B5,
+                0x0338, 0x3008, 0x3009, 0x2ADD, 0x0338, 0x304B, 0x3099, 0x304D,
+                0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055,
+                0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D,
+                0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+                0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072,
+                0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078,
+                0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046,
+                0x3099, 0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF,
+                0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7,
+                0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF,
+                0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8,
+                0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2,
+                0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8,
+                0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF,
+                0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD,
+                0x3099, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5,
+                0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669,
+                0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9,
+                0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B,
+                0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8,
+                0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7,
+                0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C,
+                0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9,
+                0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262,
+                0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F,
+                0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C,
+                0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39,
+                0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+                0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449,
+                0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565,
+                0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF,
+                0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD,
+                0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74,
+                0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+                0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD,
+                0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E,
+                0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469,
+                0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE,
+                0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599,
+                0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E,
+                0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B,
+                0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA,
+                0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F,
+                0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79,
+                0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0,
+                0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8,
+                0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336,
+                0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4,
+                0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A,
+                0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F,
+                0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF,
+                0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+                0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8,
+                0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2,
+                0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422,
+                0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D,
+                0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72,
+                0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01,
+                0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B,
+                0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145,
+                0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A,
+                0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69,
+                0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234,
+                0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756,
+                0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E,
+                0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D,
+                0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1,
+                0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF,
+                0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01,
+                0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199,
+                0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B,
+                0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039,
+                0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x05D9, 0x05B4, 0x05F2,
+                0x05B7, 0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9, 0x05BC, 0x05C1,
+                0x05E9, 0x05BC, 0x05C2, 0x05D0, 0x05B7, 0x05D0, 0x05B8, 0x05D0,
+                0x05BC, 0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3, 0x05BC, 0x05D4,
+                0x05BC, 0x05D5, 0x05BC, 0x05D6, 0x05BC, 0x05D8, 0x05BC, 0x05D9,
+                0x05BC, 0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC, 0x05BC, 0x05DE,
+                0x05BC, 0x05E0, 0x05BC, 0x05E1, 0x05BC, 0x05E3, 0x05BC, 0x05E4,
+                0x05BC, 0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8, 0x05BC, 0x05E9,
+                0x05BC, 0x05EA, 0x05BC, 0x05D5, 0x05B9, 0x05D1, 0x05BF, 0x05DB,
+                0x05BF, 0x05E4, 0x05BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+                0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347,
+                0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8,
+                0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158,
+                0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+                0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+                0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+                0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F,
+                0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB, 0x5002,
+                0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154,
+                0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B, 0x5197,
+                0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF,
+                0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4,
+                0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373,
+                0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF,
+                0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468,
+                0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599,
+                0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674,
+                0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831,
+                0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922, 0x5962,
+                0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE,
+                0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7,
+                0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60,
+                0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B,
+                0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69,
+                0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392,
+                0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22, 0x38C7, 0x232B8,
+                0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9,
+                0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148, 0x614C,
+                0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF, 0x61DE,
+                0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350,
+                0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422,
+                0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C,
+                0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691,
+                0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9,
+                0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA,
+                0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D,
+                0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21,
+                0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D,
+                0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16,
+                0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34,
+                0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E,
+                0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A,
+                0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C, 0x243AB,
+                0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814,
+                0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C,
+                0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92,
+                0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008,
+                0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x771F,
+                0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C,
+                0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5, 0x798F, 0x79EB,
+                0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE,
+                0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0,
+                0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02,
+                0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E,
+                0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070,
+                0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7,
+                0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291,
+                0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C,
+                0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457,
+                0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B,
+                0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561,
+                0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669, 0x86A9,
+                0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7,
+                0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7, 0x88DE,
+                0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0,
+                0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77,
+                0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38,
+                0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238,
+                0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995,
+                0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A,
+                0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x980B,
+                0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE,
+                0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67,
+                0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56, 0x9EF9,
+                0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+            };
+            composition const compositions[941] = {
+                { 0x0338, 0x226E }, { 0x0338, 0x2260 }, { 0x0338, 0x226F }, { 0x0300, 0x00C0 },
+                { 0x0301, 0x00C1 }, { 0x0302, 0x00C2 }, { 0x0303, 0x00C3 }, { 0x0304, 0x0100 },
+                { 0x0306, 0x0102 }, { 0x0307, 0x0226 }, { 0x0308, 0x00C4 }, { 0x0309, 0x1EA2 },
+                { 0x030A, 0x00C5 }, { 0x030C, 0x01CD }, { 0x030F, 0x0200 }, { 0x0311, 0x0202 },
+                { 0x0323, 0x1EA0 }, { 0x0325, 0x1E00 }, { 0x0328, 0x0104 }, { 0x0307, 0x1E02 },
+                { 0x0323, 0x1E04 }, { 0x0331, 0x1E06 }, { 0x0301, 0x0106 }, { 0x0302, 0x0108 },
+                { 0x0307, 0x010A }, { 0x030C, 0x010C }, { 0x0327, 0x00C7 }, { 0x0307, 0x1E0A },
+                { 0x030C, 0x010E }, { 0x0323, 0x1E0C }, { 0x0327, 0x1E10 }, { 0x032D, 0x1E12 },
+                { 0x0331, 0x1E0E }, { 0x0300, 0x00C8 }, { 0x0301, 0x00C9 }, { 0x0302, 0x00CA },
+                { 0x0303, 0x1EBC }, { 0x0304, 0x0112 }, { 0x0306, 0x0114 }, { 0x0307, 0x0116 },
+                { 0x0308, 0x00CB }, { 0x0309, 0x1EBA }, { 0x030C, 0x011A }, { 0x030F, 0x0204 },
+                { 0x0311, 0x0206 }, { 0x0323, 0x1EB8 }, { 0x0327, 0x0228 }, { 0x0328, 0x0118 },
+                { 0x032D, 0x1E18 }, { 0x0330, 0x1E1A }, { 0x0307, 0x1E1E }, { 0x0301, 0x01F4 },
+                { 0x0302, 0x011C }, { 0x0304, 0x1E20 }, { 0x0306, 0x011E }, { 0x0307, 0x0120 },
+                { 0x030C, 0x01E6 }, { 0x0327, 0x0122 }, { 0x0302, 0x0124 }, { 0x0307, 0x1E22 },
+                { 0x0308, 0x1E26 }, { 0x030C, 0x021E }, { 0x0323, 0x1E24 }, { 0x0327, 0x1E28 },
+                { 0x032E, 0x1E2A }, { 0x0300, 0x00CC }, { 0x0301, 0x00CD }, { 0x0302, 0x00CE },
+                { 0x0303, 0x0128 }, { 0x0304, 0x012A }, { 0x0306, 0x012C }, { 0x0307, 0x0130 },
+                { 0x0308, 0x00CF }, { 0x0309, 0x1EC8 }, { 0x030C, 0x01CF }, { 0x030F, 0x0208 },
+                { 0x0311, 0x020A }, { 0x0323, 0x1ECA }, { 0x0328, 0x012E }, { 0x0330, 0x1E2C },
+                { 0x0302, 0x0134 }, { 0x0301, 0x1E30 }, { 0x030C, 0x01E8 }, { 0x0323, 0x1E32 },
+                { 0x0327, 0x0136 }, { 0x0331, 0x1E34 }, { 0x0301, 0x0139 }, { 0x030C, 0x013D },
+                { 0x0323, 0x1E36 }, { 0x0327, 0x013B }, { 0x032D, 0x1E3C }, { 0x0331, 0x1E3A },
+                { 0x0301, 0x1E3E }, { 0x0307, 0x1E40 }, { 0x0323, 0x1E42 }, { 0x0300, 0x01F8 },
+                { 0x0301, 0x0143 }, { 0x0303, 0x00D1 }, { 0x0307, 0x1E44 }, { 0x030C, 0x0147 },
+                { 0x0323, 0x1E46 }, { 0x0327, 0x0145 }, { 0x032D, 0x1E4A }, { 0x0331, 0x1E48 },
+                { 0x0300, 0x00D2 }, { 0x0301, 0x00D3 }, { 0x0302, 0x00D4 }, { 0x0303, 0x00D5 },
+                { 0x0304, 0x014C }, { 0x0306, 0x014E }, { 0x0307, 0x022E }, { 0x0308, 0x00D6 },
+                { 0x0309, 0x1ECE }, { 0x030B, 0x0150 }, { 0x030C, 0x01D1 }, { 0x030F, 0x020C },
+                { 0x0311, 0x020E }, { 0x031B, 0x01A0 }, { 0x0323, 0x1ECC }, { 0x0328, 0x01EA },
+                { 0x0301, 0x1E54 }, { 0x0307, 0x1E56 }, { 0x0301, 0x0154 }, { 0x0307, 0x1E58 },
+                { 0x030C, 0x0158 }, { 0x030F, 0x0210 }, { 0x0311, 0x0212 }, { 0x0323, 0x1E5A },
+                { 0x0327, 0x0156 }, { 0x0331, 0x1E5E }, { 0x0301, 0x015A }, { 0x0302, 0x015C },
+                { 0x0307, 0x1E60 }, { 0x030C, 0x0160 }, { 0x0323, 0x1E62 }, { 0x0326, 0x0218 },
+                { 0x0327, 0x015E }, { 0x0307, 0x1E6A }, { 0x030C, 0x0164 }, { 0x0323, 0x1E6C },
+                { 0x0326, 0x021A }, { 0x0327, 0x0162 }, { 0x032D, 0x1E70 }, { 0x0331, 0x1E6E },
+                { 0x0300, 0x00D9 }, { 0x0301, 0x00DA }, { 0x0302, 0x00DB }, { 0x0303, 0x0168 },
+                { 0x0304, 0x016A }, { 0x0306, 0x016C }, { 0x0308, 0x00DC }, { 0x0309, 0x1EE6 },
+                { 0x030A, 0x016E }, { 0x030B, 0x0170 }, { 0x030C, 0x01D3 }, { 0x030F, 0x0214 },
+                { 0x0311, 0x0216 }, { 0x031B, 0x01AF }, { 0x0323, 0x1EE4 }, { 0x0324, 0x1E72 },
+                { 0x0328, 0x0172 }, { 0x032D, 0x1E76 }, { 0x0330, 0x1E74 }, { 0x0303, 0x1E7C },
+                { 0x0323, 0x1E7E }, { 0x0300, 0x1E80 }, { 0x0301, 0x1E82 }, { 0x0302, 0x0174 },
+                { 0x0307, 0x1E86 }, { 0x0308, 0x1E84 }, { 0x0323, 0x1E88 }, { 0x0307, 0x1E8A },
+                { 0x0308, 0x1E8C }, { 0x0300, 0x1EF2 }, { 0x0301, 0x00DD }, { 0x0302, 0x0176 },
+                { 0x0303, 0x1EF8 }, { 0x0304, 0x0232 }, { 0x0307, 0x1E8E }, { 0x0308, 0x0178 },
+                { 0x0309, 0x1EF6 }, { 0x0323, 0x1EF4 }, { 0x0301, 0x0179 }, { 0x0302, 0x1E90 },
+                { 0x0307, 0x017B }, { 0x030C, 0x017D }, { 0x0323, 0x1E92 }, { 0x0331, 0x1E94 },
+                { 0x0300, 0x00E0 }, { 0x0301, 0x00E1 }, { 0x0302, 0x00E2 }, { 0x0303, 0x00E3 },
+                { 0x0304, 0x0101 }, { 0x0306, 0x0103 }, { 0x0307, 0x0227 }, { 0x0308, 0x00E4 },
+                { 0x0309, 0x1EA3 }, { 0x030A, 0x00E5 }, { 0x030C, 0x01CE }, { 0x030F, 0x0201 },
+                { 0x0311, 0x0203 }, { 0x0323, 0x1EA1 }, { 0x0325, 0x1E01 }, { 0x0328, 0x0105 },
+                { 0x0307, 0x1E03 }, { 0x0323, 0x1E05 }, { 0x0331, 0x1E07 }, { 0x0301, 0x0107 },
+                { 0x0302, 0x0109 }, { 0x0307, 0x010B }, { 0x030C, 0x010D }, { 0x0327, 0x00E7 },
+                { 0x0307, 0x1E0B }, { 0x030C, 0x010F }, { 0x0323, 0x1E0D }, { 0x0327, 0x1E11 },
+                { 0x032D, 0x1E13 }, { 0x0331, 0x1E0F }, { 0x0300, 0x00E8 }, { 0x0301, 0x00E9 },
+                { 0x0302, 0x00EA }, { 0x0303, 0x1EBD }, { 0x0304, 0x0113 }, { 0x0306, 0x0115 },
+                { 0x0307, 0x0117 }, { 0x0308, 0x00EB }, { 0x0309, 0x1EBB }, { 0x030C, 0x011B },
+                { 0x030F, 0x0205 }, { 0x0311, 0x0207 }, { 0x0323, 0x1EB9 }, { 0x0327, 0x0229 },
+                { 0x0328, 0x0119 }, { 0x032D, 0x1E19 }, { 0x0330, 0x1E1B }, { 0x0307, 0x1E1F },
+                { 0x0301, 0x01F5 }, { 0x0302, 0x011D }, { 0x0304, 0x1E21 }, { 0x0306, 0x011F },
+                { 0x0307, 0x0121 }, { 0x030C, 0x01E7 }, { 0x0327, 0x0123 }, { 0x0302, 0x0125 },
+                { 0x0307, 0x1E23 }, { 0x0308, 0x1E27 }, { 0x030C, 0x021F }, { 0x0323, 0x1E25 },
+                { 0x0327, 0x1E29 }, { 0x032E, 0x1E2B }, { 0x0331, 0x1E96 }, { 0x0300, 0x00EC },
+                { 0x0301, 0x00ED }, { 0x0302, 0x00EE }, { 0x0303, 0x0129 }, { 0x0304, 0x012B },
+                { 0x0306, 0x012D }, { 0x0308, 0x00EF }, { 0x0309, 0x1EC9 }, { 0x030C, 0x01D0 },
+                { 0x030F, 0x0209 }, { 0x0311, 0x020B }, { 0x0323, 0x1ECB }, { 0x0328, 0x012F },
+                { 0x0330, 0x1E2D }, { 0x0302, 0x0135 }, { 0x030C, 0x01F0 }, { 0x0301, 0x1E31 },
+                { 0x030C, 0x01E9 }, { 0x0323, 0x1E33 }, { 0x0327, 0x0137 }, { 0x0331, 0x1E35 },
+                { 0x0301, 0x013A }, { 0x030C, 0x013E }, { 0x0323, 0x1E37 }, { 0x0327, 0x013C },
+                { 0x032D, 0x1E3D }, { 0x0331, 0x1E3B }, { 0x0301, 0x1E3F }, { 0x0307, 0x1E41 },
+                { 0x0323, 0x1E43 }, { 0x0300, 0x01F9 }, { 0x0301, 0x0144 }, { 0x0303, 0x00F1 },
+                { 0x0307, 0x1E45 }, { 0x030C, 0x0148 }, { 0x0323, 0x1E47 }, { 0x0327, 0x0146 },
+                { 0x032D, 0x1E4B }, { 0x0331, 0x1E49 }, { 0x0300, 0x00F2 }, { 0x0301, 0x00F3 },
+                { 0x0302, 0x00F4 }, { 0x0303, 0x00F5 }, { 0x0304, 0x014D }, { 0x0306, 0x014F },
+                { 0x0307, 0x022F }, { 0x0308, 0x00F6 }, { 0x0309, 0x1ECF }, { 0x030B, 0x0151 },
+                { 0x030C, 0x01D2 }, { 0x030F, 0x020D }, { 0x0311, 0x020F }, { 0x031B, 0x01A1 },
+                { 0x0323, 0x1ECD }, { 0x0328, 0x01EB }, { 0x0301, 0x1E55 }, { 0x0307, 0x1E57 },
+                { 0x0301, 0x0155 }, { 0x0307, 0x1E59 }, { 0x030C, 0x0159 }, { 0x030F, 0x0211 },
+                { 0x0311, 0x0213 }, { 0x0323, 0x1E5B }, { 0x0327, 0x0157 }, { 0x0331, 0x1E5F },
+                { 0x0301, 0x015B }, { 0x0302, 0x015D }, { 0x0307, 0x1E61 }, { 0x030C, 0x0161 },
+                { 0x0323, 0x1E63 }, { 0x0326, 0x0219 }, { 0x0327, 0x015F }, { 0x0307, 0x1E6B },
+                { 0x0308, 0x1E97 }, { 0x030C, 0x0165 }, { 0x0323, 0x1E6D }, { 0x0326, 0x021B },
+                { 0x0327, 0x0163 }, { 0x032D, 0x1E71 }, { 0x0331, 0x1E6F }, { 0x0300, 0x00F9 },
+                { 0x0301, 0x00FA }, { 0x0302, 0x00FB }, { 0x0303, 0x0169 }, { 0x0304, 0x016B },
+                { 0x0306, 0x016D }, { 0x0308, 0x00FC }, { 0x0309, 0x1EE7 }, { 0x030A, 0x016F },
+                { 0x030B, 0x0171 }, { 0x030C, 0x01D4 }, { 0x030F, 0x0215 }, { 0x0311, 0x0217 },
+                { 0x031B, 0x01B0 }, { 0x0323, 0x1EE5 }, { 0x0324, 0x1E73 }, { 0x0328, 0x0173 },
+                { 0x032D, 0x1E77 }, { 0x0330, 0x1E75 }, { 0x0303, 0x1E7D }, { 0x0323, 0x1E7F },
+                { 0x0300, 0x1E81 }, { 0x0301, 0x1E83 }, { 0x0302, 0x0175 }, { 0x0307, 0x1E87 },
+                { 0x0308, 0x1E85 }, { 0x030A, 0x1E98 }, { 0x0323, 0x1E89 }, { 0x0307, 0x1E8B },
+                { 0x0308, 0x1E8D }, { 0x0300, 0x1EF3 }, { 0x0301, 0x00FD }, { 0x0302, 0x0177 },
+                { 0x0303, 0x1EF9 }, { 0x0304, 0x0233 }, { 0x0307, 0x1E8F }, { 0x0308, 0x00FF },
+                { 0x0309, 0x1EF7 }, { 0x030A, 0x1E99 }, { 0x0323, 0x1EF5 }, { 0x0301, 0x017A },
+                { 0x0302, 0x1E91 }, { 0x0307, 0x017C }, { 0x030C, 0x017E }, { 0x0323, 0x1E93 },
+                { 0x0331, 0x1E95 }, { 0x0300, 0x1FED }, { 0x0301, 0x0385 }, { 0x0342, 0x1FC1 },
+                { 0x0300, 0x1EA6 }, { 0x0301, 0x1EA4 }, { 0x0303, 0x1EAA }, { 0x0309, 0x1EA8 },
+                { 0x0304, 0x01DE }, { 0x0301, 0x01FA }, { 0x0301, 0x01FC }, { 0x0304, 0x01E2 },
+                { 0x0301, 0x1E08 }, { 0x0300, 0x1EC0 }, { 0x0301, 0x1EBE }, { 0x0303, 0x1EC4 },
+                { 0x0309, 0x1EC2 }, { 0x0301, 0x1E2E }, { 0x0300, 0x1ED2 }, { 0x0301, 0x1ED0 },
+                { 0x0303, 0x1ED6 }, { 0x0309, 0x1ED4 }, { 0x0301, 0x1E4C }, { 0x0304, 0x022C },
+                { 0x0308, 0x1E4E }, { 0x0304, 0x022A }, { 0x0301, 0x01FE }, { 0x0300, 0x01DB },
+                { 0x0301, 0x01D7 }, { 0x0304, 0x01D5 }, { 0x030C, 0x01D9 }, { 0x0300, 0x1EA7 },
+                { 0x0301, 0x1EA5 }, { 0x0303, 0x1EAB }, { 0x0309, 0x1EA9 }, { 0x0304, 0x01DF },
+                { 0x0301, 0x01FB }, { 0x0301, 0x01FD }, { 0x0304, 0x01E3 }, { 0x0301, 0x1E09 },
+                { 0x0300, 0x1EC1 }, { 0x0301, 0x1EBF }, { 0x0303, 0x1EC5 }, { 0x0309, 0x1EC3 },
+                { 0x0301, 0x1E2F }, { 0x0300, 0x1ED3 }, { 0x0301, 0x1ED1 }, { 0x0303, 0x1ED7 },
+                { 0x0309, 0x1ED5 }, { 0x0301, 0x1E4D }, { 0x0304, 0x022D }, { 0x0308, 0x1E4F },
+                { 0x0304, 0x022B }, { 0x0301, 0x01FF }, { 0x0300, 0x01DC }, { 0x0301, 0x01D8 },
+                { 0x0304, 0x01D6 }, { 0x030C, 0x01DA }, { 0x0300, 0x1EB0 }, { 0x0301, 0x1EAE },
+                { 0x0303, 0x1EB4 }, { 0x0309, 0x1EB2 }, { 0x0300, 0x1EB1 }, { 0x0301, 0x1EAF },
+                { 0x0303, 0x1EB5 }, { 0x0309, 0x1EB3 }, { 0x0300, 0x1E14 }, { 0x0301, 0x1E16 },
+                { 0x0300, 0x1E15 }, { 0x0301, 0x1E17 }, { 0x0300, 0x1E50 }, { 0x0301, 0x1E52 },
+                { 0x0300, 0x1E51 }, { 0x0301, 0x1E53 }, { 0x0307, 0x1E64 }, { 0x0307, 0x1E65 },
+                { 0x0307, 0x1E66 }, { 0x0307, 0x1E67 }, { 0x0301, 0x1E78 }, { 0x0301, 0x1E79 },
+                { 0x0308, 0x1E7A }, { 0x0308, 0x1E7B }, { 0x0307, 0x1E9B }, { 0x0300, 0x1EDC },
+                { 0x0301, 0x1EDA }, { 0x0303, 0x1EE0 }, { 0x0309, 0x1EDE }, { 0x0323, 0x1EE2 },
+                { 0x0300, 0x1EDD }, { 0x0301, 0x1EDB }, { 0x0303, 0x1EE1 }, { 0x0309, 0x1EDF },
+                { 0x0323, 0x1EE3 }, { 0x0300, 0x1EEA }, { 0x0301, 0x1EE8 }, { 0x0303, 0x1EEE },
+                { 0x0309, 0x1EEC }, { 0x0323, 0x1EF0 }, { 0x0300, 0x1EEB }, { 0x0301, 0x1EE9 },
+                { 0x0303, 0x1EEF }, { 0x0309, 0x1EED }, { 0x0323, 0x1EF1 }, { 0x030C, 0x01EE },
+                { 0x0304, 0x01EC }, { 0x0304, 0x01ED }, { 0x0304, 0x01E0 }, { 0x0304, 0x01E1 },
+                { 0x0306, 0x1E1C }, { 0x0306, 0x1E1D }, { 0x0304, 0x0230 }, { 0x0304, 0x0231 },
+                { 0x030C, 0x01EF }, { 0x0300, 0x1FBA }, { 0x0301, 0x0386 }, { 0x0304, 0x1FB9 },
+                { 0x0306, 0x1FB8 }, { 0x0313, 0x1F08 }, { 0x0314, 0x1F09 }, { 0x0345, 0x1FBC },
+                { 0x0300, 0x1FC8 }, { 0x0301, 0x0388 }, { 0x0313, 0x1F18 }, { 0x0314, 0x1F19 },
+                { 0x0300, 0x1FCA }, { 0x0301, 0x0389 }, { 0x0313, 0x1F28 }, { 0x0314, 0x1F29 },
+                { 0x0345, 0x1FCC }, { 0x0300, 0x1FDA }, { 0x0301, 0x038A }, { 0x0304, 0x1FD9 },
+                { 0x0306, 0x1FD8 }, { 0x0308, 0x03AA }, { 0x0313, 0x1F38 }, { 0x0314, 0x1F39 },
+                { 0x0300, 0x1FF8 }, { 0x0301, 0x038C }, { 0x0313, 0x1F48 }, { 0x0314, 0x1F49 },
+                { 0x0314, 0x1FEC }, { 0x0300, 0x1FEA }, { 0x0301, 0x038E }, { 0x0304, 0x1FE9 },
+                { 0x0306, 0x1FE8 }, { 0x0308, 0x03AB }, { 0x0314, 0x1F59 }, { 0x0300, 0x1FFA },
+                { 0x0301, 0x038F }, { 0x0313, 0x1F68 }, { 0x0314, 0x1F69 }, { 0x0345, 0x1FFC },
+                { 0x0345, 0x1FB4 }, { 0x0345, 0x1FC4 }, { 0x0300, 0x1F70 }, { 0x0301, 0x03AC },
+                { 0x0304, 0x1FB1 }, { 0x0306, 0x1FB0 }, { 0x0313, 0x1F00 }, { 0x0314, 0x1F01 },
+                { 0x0342, 0x1FB6 }, { 0x0345, 0x1FB3 }, { 0x0300, 0x1F72 }, { 0x0301, 0x03AD },
+                { 0x0313, 0x1F10 }, { 0x0314, 0x1F11 }, { 0x0300, 0x1F74 }, { 0x0301, 0x03AE },
+                { 0x0313, 0x1F20 }, { 0x0314, 0x1F21 }, { 0x0342, 0x1FC6 }, { 0x0345, 0x1FC3 },
+                { 0x0300, 0x1F76 }, { 0x0301, 0x03AF }, { 0x0304, 0x1FD1 }, { 0x0306, 0x1FD0 },
+                { 0x0308, 0x03CA }, { 0x0313, 0x1F30 }, { 0x0314, 0x1F31 }, { 0x0342, 0x1FD6 },
+                { 0x0300, 0x1F78 }, { 0x0301, 0x03CC }, { 0x0313, 0x1F40 }, { 0x0314, 0x1F41 },
+                { 0x0313, 0x1FE4 }, { 0x0314, 0x1FE5 }, { 0x0300, 0x1F7A }, { 0x0301, 0x03CD },
+                { 0x0304, 0x1FE1 }, { 0x0306, 0x1FE0 }, { 0x0308, 0x03CB }, { 0x0313, 0x1F50 },
+                { 0x0314, 0x1F51 }, { 0x0342, 0x1FE6 }, { 0x0300, 0x1F7C }, { 0x0301, 0x03CE },
+                { 0x0313, 0x1F60 }, { 0x0314, 0x1F61 }, { 0x0342, 0x1FF6 }, { 0x0345, 0x1FF3 },
+                { 0x0300, 0x1FD2 }, { 0x0301, 0x0390 }, { 0x0342, 0x1FD7 }, { 0x0300, 0x1FE2 },
+                { 0x0301, 0x03B0 }, { 0x0342, 0x1FE7 }, { 0x0345, 0x1FF4 }, { 0x0301, 0x03D3 },
+                { 0x0308, 0x03D4 }, { 0x0308, 0x0407 }, { 0x0306, 0x04D0 }, { 0x0308, 0x04D2 },
+                { 0x0301, 0x0403 }, { 0x0300, 0x0400 }, { 0x0306, 0x04D6 }, { 0x0308, 0x0401 },
+                { 0x0306, 0x04C1 }, { 0x0308, 0x04DC }, { 0x0308, 0x04DE }, { 0x0300, 0x040D },
+                { 0x0304, 0x04E2 }, { 0x0306, 0x0419 }, { 0x0308, 0x04E4 }, { 0x0301, 0x040C },
+                { 0x0308, 0x04E6 }, { 0x0304, 0x04EE }, { 0x0306, 0x040E }, { 0x0308, 0x04F0 },
+                { 0x030B, 0x04F2 }, { 0x0308, 0x04F4 }, { 0x0308, 0x04F8 }, { 0x0308, 0x04EC },
+                { 0x0306, 0x04D1 }, { 0x0308, 0x04D3 }, { 0x0301, 0x0453 }, { 0x0300, 0x0450 },
+                { 0x0306, 0x04D7 }, { 0x0308, 0x0451 }, { 0x0306, 0x04C2 }, { 0x0308, 0x04DD },
+                { 0x0308, 0x04DF }, { 0x0300, 0x045D }, { 0x0304, 0x04E3 }, { 0x0306, 0x0439 },
+                { 0x0308, 0x04E5 }, { 0x0301, 0x045C }, { 0x0308, 0x04E7 }, { 0x0304, 0x04EF },
+                { 0x0306, 0x045E }, { 0x0308, 0x04F1 }, { 0x030B, 0x04F3 }, { 0x0308, 0x04F5 },
+                { 0x0308, 0x04F9 }, { 0x0308, 0x04ED }, { 0x0308, 0x0457 }, { 0x030F, 0x0476 },
+                { 0x030F, 0x0477 }, { 0x0308, 0x04DA }, { 0x0308, 0x04DB }, { 0x0308, 0x04EA },
+                { 0x0308, 0x04EB }, { 0x0653, 0x0622 }, { 0x0654, 0x0623 }, { 0x0655, 0x0625 },
+                { 0x0654, 0x0624 }, { 0x0654, 0x0626 }, { 0x0654, 0x06C2 }, { 0x0654, 0x06D3 },
+                { 0x0654, 0x06C0 }, { 0x093C, 0x0929 }, { 0x093C, 0x0931 }, { 0x093C, 0x0934 },
+                { 0x09BE, 0x09CB }, { 0x09D7, 0x09CC }, { 0x0B3E, 0x0B4B }, { 0x0B56, 0x0B48 },
+                { 0x0B57, 0x0B4C }, { 0x0BD7, 0x0B94 }, { 0x0BBE, 0x0BCA }, { 0x0BD7, 0x0BCC },
+                { 0x0BBE, 0x0BCB }, { 0x0C56, 0x0C48 }, { 0x0CD5, 0x0CC0 }, { 0x0CC2, 0x0CCA },
+                { 0x0CD5, 0x0CC7 }, { 0x0CD6, 0x0CC8 }, { 0x0CD5, 0x0CCB }, { 0x0D3E, 0x0D4A },
+                { 0x0D57, 0x0D4C }, { 0x0D3E, 0x0D4B }, { 0x0DCA, 0x0DDA }, { 0x0DCF, 0x0DDC },
+                { 0x0DDF, 0x0DDE }, { 0x0DCA, 0x0DDD }, { 0x102E, 0x1026 }, { 0x1B35, 0x1B06 },
+                { 0x1B35, 0x1B08 }, { 0x1B35, 0x1B0A }, { 0x1B35, 0x1B0C }, { 0x1B35, 0x1B0E },
+                { 0x1B35, 0x1B12 }, { 0x1B35, 0x1B3B }, { 0x1B35, 0x1B3D }, { 0x1B35, 0x1B40 },
+                { 0x1B35, 0x1B41 }, { 0x1B35, 0x1B43 }, { 0x0304, 0x1E38 }, { 0x0304, 0x1E39 },
+                { 0x0304, 0x1E5C }, { 0x0304, 0x1E5D }, { 0x0307, 0x1E68 }, { 0x0307, 0x1E69 },
+                { 0x0302, 0x1EAC }, { 0x0306, 0x1EB6 }, { 0x0302, 0x1EAD }, { 0x0306, 0x1EB7 },
+                { 0x0302, 0x1EC6 }, { 0x0302, 0x1EC7 }, { 0x0302, 0x1ED8 }, { 0x0302, 0x1ED9 },
+                { 0x0300, 0x1F02 }, { 0x0301, 0x1F04 }, { 0x0342, 0x1F06 }, { 0x0345, 0x1F80 },
+                { 0x0300, 0x1F03 }, { 0x0301, 0x1F05 }, { 0x0342, 0x1F07 }, { 0x0345, 0x1F81 },
+                { 0x0345, 0x1F82 }, { 0x0345, 0x1F83 }, { 0x0345, 0x1F84 }, { 0x0345, 0x1F85 },
+                { 0x0345, 0x1F86 }, { 0x0345, 0x1F87 }, { 0x0300, 0x1F0A }, { 0x0301, 0x1F0C },
+                { 0x0342, 0x1F0E }, { 0x0345, 0x1F88 }, { 0x0300, 0x1F0B }, { 0x0301, 0x1F0D },
+                { 0x0342, 0x1F0F }, { 0x0345, 0x1F89 }, { 0x0345, 0x1F8A }, { 0x0345, 0x1F8B },
+                { 0x0345, 0x1F8C }, { 0x0345, 0x1F8D }, { 0x0345, 0x1F8E }, { 0x0345, 0x1F8F },
+                { 0x0300, 0x1F12 }, { 0x0301, 0x1F14 }, { 0x0300, 0x1F13 }, { 0x0301, 0x1F15 },
+                { 0x0300, 0x1F1A }, { 0x0301, 0x1F1C }, { 0x0300, 0x1F1B }, { 0x0301, 0x1F1D },
+                { 0x0300, 0x1F22 }, { 0x0301, 0x1F24 }, { 0x0342, 0x1F26 }, { 0x0345, 0x1F90 },
+                { 0x0300, 0x1F23 }, { 0x0301, 0x1F25 }, { 0x0342, 0x1F27 }, { 0x0345, 0x1F91 },
+                { 0x0345, 0x1F92 }, { 0x0345, 0x1F93 }, { 0x0345, 0x1F94 }, { 0x0345, 0x1F95 },
+                { 0x0345, 0x1F96 }, { 0x0345, 0x1F97 }, { 0x0300, 0x1F2A }, { 0x0301, 0x1F2C },
+                { 0x0342, 0x1F2E }, { 0x0345, 0x1F98 }, { 0x0300, 0x1F2B }, { 0x0301, 0x1F2D },
+                { 0x0342, 0x1F2F }, { 0x0345, 0x1F99 }, { 0x0345, 0x1F9A }, { 0x0345, 0x1F9B },
+                { 0x0345, 0x1F9C }, { 0x0345, 0x1F9D }, { 0x0345, 0x1F9E }, { 0x0345, 0x1F9F },
+                { 0x0300, 0x1F32 }, { 0x0301, 0x1F34 }, { 0x0342, 0x1F36 }, { 0x0300, 0x1F33 },
+                { 0x0301, 0x1F35 }, { 0x0342, 0x1F37 }, { 0x0300, 0x1F3A }, { 0x0301, 0x1F3C },
+                { 0x0342, 0x1F3E }, { 0x0300, 0x1F3B }, { 0x0301, 0x1F3D }, { 0x0342, 0x1F3F },
+                { 0x0300, 0x1F42 }, { 0x0301, 0x1F44 }, { 0x0300, 0x1F43 }, { 0x0301, 0x1F45 },
+                { 0x0300, 0x1F4A }, { 0x0301, 0x1F4C }, { 0x0300, 0x1F4B }, { 0x0301, 0x1F4D },
+                { 0x0300, 0x1F52 }, { 0x0301, 0x1F54 }, { 0x0342, 0x1F56 }, { 0x0300, 0x1F53 },
+                { 0x0301, 0x1F55 }, { 0x0342, 0x1F57 }, { 0x0300, 0x1F5B }, { 0x0301, 0x1F5D },
+                { 0x0342, 0x1F5F }, { 0x0300, 0x1F62 }, { 0x0301, 0x1F64 }, { 0x0342, 0x1F66 },
+                { 0x0345, 0x1FA0 }, { 0x0300, 0x1F63 }, { 0x0301, 0x1F65 }, { 0x0342, 0x1F67 },
+                { 0x0345, 0x1FA1 }, { 0x0345, 0x1FA2 }, { 0x0345, 0x1FA3 }, { 0x0345, 0x1FA4 },
+                { 0x0345, 0x1FA5 }, { 0x0345, 0x1FA6 }, { 0x0345, 0x1FA7 }, { 0x0300, 0x1F6A },
+                { 0x0301, 0x1F6C }, { 0x0342, 0x1F6E }, { 0x0345, 0x1FA8 }, { 0x0300, 0x1F6B },
+                { 0x0301, 0x1F6D }, { 0x0342, 0x1F6F }, { 0x0345, 0x1FA9 }, { 0x0345, 0x1FAA },
+                { 0x0345, 0x1FAB }, { 0x0345, 0x1FAC }, { 0x0345, 0x1FAD }, { 0x0345, 0x1FAE },
+                { 0x0345, 0x1FAF }, { 0x0345, 0x1FB2 }, { 0x0345, 0x1FC2 }, { 0x0345, 0x1FF2 },
+                { 0x0345, 0x1FB7 }, { 0x0300, 0x1FCD }, { 0x0301, 0x1FCE }, { 0x0342, 0x1FCF },
+                { 0x0345, 0x1FC7 }, { 0x0345, 0x1FF7 }, { 0x0300, 0x1FDD }, { 0x0301, 0x1FDE },
+                { 0x0342, 0x1FDF }, { 0x0338, 0x219A }, { 0x0338, 0x219B }, { 0x0338, 0x21AE },
+                { 0x0338, 0x21CD }, { 0x0338, 0x21CF }, { 0x0338, 0x21CE }, { 0x0338, 0x2204 },
+                { 0x0338, 0x2209 }, { 0x0338, 0x220C }, { 0x0338, 0x2224 }, { 0x0338, 0x2226 },
+                { 0x0338, 0x2241 }, { 0x0338, 0x2244 }, { 0x0338, 0x2247 }, { 0x0338, 0x2249 },
+                { 0x0338, 0x226D }, { 0x0338, 0x2262 }, { 0x0338, 0x2270 }, { 0x0338, 0x2271 },
+                { 0x0338, 0x2274 }, { 0x0338, 0x2275 }, { 0x0338, 0x2278 }, { 0x0338, 0x2279 },
+                { 0x0338, 0x2280 }, { 0x0338, 0x2281 }, { 0x0338, 0x22E0 }, { 0x0338, 0x22E1 },
+                { 0x0338, 0x2284 }, { 0x0338, 0x2285 }, { 0x0338, 0x2288 }, { 0x0338, 0x2289 },
+                { 0x0338, 0x22E2 }, { 0x0338, 0x22E3 }, { 0x0338, 0x22AC }, { 0x0338, 0x22AD },
+                { 0x0338, 0x22AE }, { 0x0338, 0x22AF }, { 0x0338, 0x22EA }, { 0x0338, 0x22EB },
+                { 0x0338, 0x22EC }, { 0x0338, 0x22ED }, { 0x3099, 0x3094 }, { 0x3099, 0x304C },
+                { 0x3099, 0x304E }, { 0x3099, 0x3050 }, { 0x3099, 0x3052 }, { 0x3099, 0x3054 },
+                { 0x3099, 0x3056 }, { 0x3099, 0x3058 }, { 0x3099, 0x305A }, { 0x3099, 0x305C },
+                { 0x3099, 0x305E }, { 0x3099, 0x3060 }, { 0x3099, 0x3062 }, { 0x3099, 0x3065 },
+                { 0x3099, 0x3067 }, { 0x3099, 0x3069 }, { 0x3099, 0x3070 }, { 0x309A, 0x3071 },
+                { 0x3099, 0x3073 }, { 0x309A, 0x3074 }, { 0x3099, 0x3076 }, { 0x309A, 0x3077 },
+                { 0x3099, 0x3079 }, { 0x309A, 0x307A }, { 0x3099, 0x307C }, { 0x309A, 0x307D },
+                { 0x3099, 0x309E }, { 0x3099, 0x30F4 }, { 0x3099, 0x30AC }, { 0x3099, 0x30AE },
+                { 0x3099, 0x30B0 }, { 0x3099, 0x30B2 }, { 0x3099, 0x30B4 }, { 0x3099, 0x30B6 },
+                { 0x3099, 0x30B8 }, { 0x3099, 0x30BA }, { 0x3099, 0x30BC }, { 0x3099, 0x30BE },
+                { 0x3099, 0x30C0 }, { 0x3099, 0x30C2 }, { 0x3099, 0x30C5 }, { 0x3099, 0x30C7 },
+                { 0x3099, 0x30C9 }, { 0x3099, 0x30D0 }, { 0x309A, 0x30D1 }, { 0x3099, 0x30D3 },
+                { 0x309A, 0x30D4 }, { 0x3099, 0x30D6 }, { 0x309A, 0x30D7 }, { 0x3099, 0x30D9 },
+                { 0x309A, 0x30DA }, { 0x3099, 0x30DC }, { 0x309A, 0x30DD }, { 0x3099, 0x30F7 },
+                { 0x3099, 0x30F8 }, { 0x3099, 0x30F9 }, { 0x3099, 0x30FA }, { 0x3099, 0x30FE },
+                { 0x110BA, 0x1109A }, { 0x110BA, 0x1109C }, { 0x110BA, 0x110AB }, { 0x11127, 0x1112E },
+                { 0x11127, 0x1112F }, { 0x1133E, 0x1134B }, { 0x11357, 0x1134C }, { 0x114B0, 0x114BC },
+                { 0x114BA, 0x114BB }, { 0x114BD, 0x114BE }, { 0x115AF, 0x115BA }, { 0x115AF, 0x115BB },
+                { 0x11930, 0x11938 },
+            };
+        } // namespace ucd
+    } // namespace detail
+} // namespace seq
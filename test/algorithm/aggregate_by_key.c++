@@ -0,0 +1,93 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/aggregate_by_key.h++>
+
+#include <taussig/algorithms/aggregate_by_key.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    int mod_1000(int x) { return x % 1000; }
+    int count_one(int n, int) { return n + 1; }
+    int add(int a, int b) { return a + b; }
+
+    template <typename K, typename T>
+    std::map<K, T> as_map(std::vector<std::pair<K, T>> const& v) {
+        return { v.begin(), v.end() };
+    }
+} // namespace
+
+TEST_CASE("aggregate_by_key", "aggregate_by_key tests") {
+    std::vector<std::string> words { "a", "rose", "is", "a", "rose", "is", "a", "rose" };
+    auto counts = seq::aggregate_by_key(seq::as_sequence(words), [](std::string const& w) { return w; }, 0,
+                                        [](int n, std::string const&) { return n + 1; });
+    CHECK(counts.size() == 3u);
+    CHECK((as_map(counts) == std::map<std::string, int> { { "a", 3 }, { "is", 2 }, { "rose", 3 } }));
+
+    // many keys grow the table several times over
+    std::vector<int> v;
+    for(int i = 0; i < 100000; ++i) v.push_back((i * 7919) % 50021);
+    std::map<int, int> expected;
+    for(auto x : v) ++expected[x % 1000];
+    auto sums = seq::aggregate_by_key(seq::as_sequence(v), mod_1000, 0, count_one);
+    CHECK(sums.size() == expected.size());
+    CHECK(as_map(sums) == expected);
+
+    // elements with the same key are folded in order
+    std::vector<int> small { 3, 13, 4, 23, 14 };
+    auto lists = seq::aggregate_by_key(seq::as_sequence(small), [](int x) { return x % 10; }, std::vector<int>{},
+                                       [](std::vector<int> l, int x) { l.push_back(x); return l; });
+    CHECK((as_map(lists) == std::map<int, std::vector<int>> { { 3, { 3, 13, 23 } }, { 4, { 4, 14 } } }));
+
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &small]() mutable { return i < small.size()? wheels::some(small[i++]) : wheels::none; });
+    CHECK((as_map(seq::aggregate_by_key(generated, [](int x) { return x % 10; }, 0, add))
+           == std::map<int, int> { { 3, 39 }, { 4, 18 } }));
+
+    CHECK(seq::aggregate_by_key(seq::as_sequence(std::vector<int>{}), mod_1000, 0, count_one).empty());
+}
+
+TEST_CASE("aggregate_by_key/parallel", "parallel aggregate_by_key tests") {
+    std::vector<int> v;
+    for(int i = 0; i < 200000; ++i) v.push_back((i * 7919) % 50021);
+
+    auto sequential = seq::aggregate_by_key(seq::as_sequence(v), mod_1000, 0, count_one);
+    seq::parallel_policy policy { 4, 1 << 10 };
+    auto parallel = seq::aggregate_by_key(seq::as_sequence(v), mod_1000, 0, count_one, add, policy);
+    CHECK(parallel.size() == sequential.size());
+    CHECK(as_map(parallel) == as_map(sequential));
+
+    // more partitions than keys leaves some of them empty
+    auto few = seq::aggregate_by_key(seq::as_sequence(v), [](int x) { return x % 3; }, 0ll,
+                                     [](long long a, int x) { return a + x; }, std::plus<long long>{}, policy);
+    CHECK(few.size() == 3u);
+    long long total = 0;
+    for(auto& p : few) total += p.second;
+    long long expected = 0;
+    for(auto x : v) expected += x;
+    CHECK(total == expected);
+
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &v]() mutable { return i < v.size()? wheels::some(v[i++]) : wheels::none; });
+    CHECK(as_map(seq::aggregate_by_key(generated, mod_1000, 0, count_one, add, seq::parallel)) == as_map(sequential));
+}
@@ -0,0 +1,32 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/any_of.h++>
+
+#include <taussig/algorithms/any_of.h++>
+#include <taussig/primitives.h++>
+
+#include <catch.hpp>
+
+#include <vector>
+
+TEST_CASE("any_of", "any_of, all_of, and none_of tests") {
+    std::vector<int> v { 2, 4, 6, 7 };
+    auto even = [](int x) { return x % 2 == 0; };
+    auto big = [](int x) { return x > 10; };
+    auto s = seq::as_sequence(v);
+    CHECK(seq::any_of(s, even));
+    CHECK(!seq::all_of(s, even));
+    CHECK(!seq::none_of(s, even));
+    CHECK(!seq::any_of(s, big));
+    CHECK(seq::none_of(s, big));
+    CHECK(seq::all_of(s, [](int x) { return x > 0; }));
+}
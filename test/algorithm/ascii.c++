@@ -0,0 +1,51 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/ascii.h++>
+
+#include <taussig/algorithms/ascii.h++>
+#include <taussig/algorithms/count.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <catch.hpp>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("ascii_lower", "ascii case folding adaptors") {
+    std::string lower = seq::materialize(seq::ascii_lower(seq::as_sequence("Content-Type: \xC3\x89T\xC3\x89")));
+    CHECK(lower == "content-type: \xC3\x89t\xC3\x89");
+    std::u16string upper = seq::materialize(seq::ascii_upper(seq::as_sequence(u"x-forwarded-for é")));
+    CHECK(upper == u"X-FORWARDED-FOR é");
+    CHECK(seq::count_if(seq::as_sequence("a1 b2\tc3"), seq::ascii_is_digit{}) == 3u);
+    CHECK(seq::count_if(seq::as_sequence("a1 b2\tc3"), seq::ascii_is_space{}) == 2u);
+}
+TEST_CASE("iequal", "iequal tests") {
+    SECTION("contiguous", "contiguous character sequences") {
+        std::string a = "Accept-Encoding: GZIP, deflate; q=0.5 [@`{]";
+        std::string b = "accept-encoding: gzip, DEFLATE; Q=0.5 [@`{]";
+        CHECK(seq::iequal(seq::as_sequence(a), seq::as_sequence(b)));
+        for(auto i = 0u; i < a.size(); ++i) {
+            std::string c = b;
+            c[i] ^= 0x40;
+            CHECK(!seq::iequal(seq::as_sequence(a), seq::as_sequence(c)));
+        }
+        CHECK(!seq::iequal(seq::as_sequence(a), seq::as_sequence(b.substr(1))));
+        CHECK(seq::iequal(seq::as_sequence(u"HOST: Éxample.org Éxample"), seq::as_sequence(u"host: ÉXAMPLE.ORG ÉXAMPLE")));
+        CHECK(!seq::iequal(seq::as_sequence(u"ÉXAMPLE.ORG ÉXAMPLE"), seq::as_sequence(u"éxample.org éxample")));
+    }
+    SECTION("generic", "other sequences") {
+        std::vector<char> a { 'H', 'o', 'S', 't' };
+        CHECK(seq::iequal(seq::ascii_upper(seq::as_sequence(a)), seq::as_sequence("hOsT")));
+        CHECK(!seq::iequal(seq::ascii_upper(seq::as_sequence(a)), seq::as_sequence("hOsTs")));
+    }
+}
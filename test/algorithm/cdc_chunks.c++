@@ -0,0 +1,86 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/cdc_chunks.h++>
+
+#include <taussig/algorithms/cdc_chunks.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+    std::string random_bytes(std::size_t n, std::uint32_t seed) {
+        std::string s(n, '\0');
+        for(auto& c : s) {
+            seed = seed * 1664525u + 1013904223u;
+            c = static_cast<char>(seed >> 24);
+        }
+        return s;
+    }
+
+    template <typename S>
+    std::vector<std::string> chunks_of(S s) {
+        std::vector<std::string> result;
+        for(; !seq::empty(s); seq::pop_front(s)) {
+            result.push_back(seq::materialize<std::string>(seq::front(s)));
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("cdc_chunks", "content-defined chunking tests") {
+    seq::cdc_params const params { 256, 1024, 4096 };
+    auto const data = random_bytes(1 << 18, 42);
+
+    auto chunks = chunks_of(seq::cdc_chunks(seq::as_sequence(data), params));
+    REQUIRE(chunks.size() > 1u);
+    std::string joined;
+    for(std::size_t i = 0; i < chunks.size(); ++i) {
+        joined += chunks[i];
+        CHECK(chunks[i].size() <= params.max_size);
+        if(i + 1 < chunks.size()) CHECK(chunks[i].size() >= params.min_size);
+    }
+    CHECK(joined == data);
+    // normalized chunking keeps sizes close to the average
+    auto const average = data.size() / chunks.size();
+    CHECK(average > params.avg_size / 2);
+    CHECK(average < params.avg_size * 2);
+
+    // streaming sources are cut at the same places
+    std::list<char> streamed(data.begin(), data.end());
+    CHECK(chunks_of(seq::cdc_chunks(seq::as_sequence(streamed), params)) == chunks);
+
+    // contiguous chunks are views into the source
+    auto s = seq::cdc_chunks(seq::as_sequence(data), params);
+    seq::pop_front(s);
+    CHECK(&*seq::front(s).first == data.data() + chunks[0].size());
+
+    // boundaries depend on content, so an insertion only changes the chunks around it
+    auto edited = data;
+    edited.insert(1000, "inserted");
+    auto edited_chunks = chunks_of(seq::cdc_chunks(seq::as_sequence(edited), params));
+    std::set<std::string> original(chunks.begin(), chunks.end());
+    std::size_t shared = 0;
+    for(auto const& c : edited_chunks) shared += original.count(c);
+    CHECK((shared + 3 >= edited_chunks.size()));
+
+    std::string empty;
+    CHECK(seq::empty(seq::cdc_chunks(seq::as_sequence(empty), params)));
+    std::string small = "tiny";
+    CHECK((chunks_of(seq::cdc_chunks(seq::as_sequence(small), params)) == std::vector<std::string> { "tiny" }));
+}
@@ -0,0 +1,91 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/chunk.h++>
+
+#include <taussig/algorithms/chunk.h++>
+#include <taussig/algorithms/count.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include "../allocations.h++"
+
+#include <catch.hpp>
+
+#include <numeric>
+#include <vector>
+
+namespace {
+    template <typename S>
+    std::vector<std::vector<int>> batches(S s) {
+        std::vector<std::vector<int>> result;
+        for(; !seq::empty(s); seq::pop_front(s)) {
+            result.push_back(seq::materialize<std::vector<int>>(seq::front(s)));
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("chunk", "chunk tests") {
+    for(int n = 0; n < 10; ++n) {
+        std::vector<int> v(n);
+        std::iota(v.begin(), v.end(), 0);
+        std::vector<std::vector<int>> expected;
+        for(int i = 0; i < n; i += 3) expected.emplace_back(v.begin() + i, v.begin() + std::min(i + 3, n));
+
+        CHECK(batches(seq::chunk(seq::as_sequence(v), 3)) == expected);
+
+        int k = 0;
+        auto generated = seq::generate([k, n]() mutable { return k < n? wheels::some(k++) : wheels::none; });
+        CHECK(batches(seq::chunk(generated, 3)) == expected);
+    }
+
+    // random-access chunks are views into the source
+    std::vector<int> v { 1, 2, 3, 4, 5 };
+    auto s = seq::chunk(seq::as_sequence(v), 2);
+    seq::pop_front(s);
+    CHECK(&*seq::front(s).first == &v[2]);
+
+    // chunks are sequences that terminals can process in bulk
+    std::vector<int> ones(100, 1);
+    std::size_t total = 0;
+    for(auto t = seq::chunk(seq::as_sequence(ones), 16); !seq::empty(t); seq::pop_front(t)) {
+        total += seq::count(seq::front(t), 1);
+    }
+    CHECK(total == 100u);
+}
+
+TEST_CASE("chunk allocations", "chunk reuses one buffer") {
+    std::vector<int> v(100, 1);
+    int total = 0;
+    auto sliced = allocations::after_warm_up([&] {
+        total = 0;
+        for(auto s = seq::chunk(seq::as_sequence(v), 8); !seq::empty(s); seq::pop_front(s)) {
+            total += static_cast<int>(seq::count(seq::front(s), 1));
+        }
+    });
+    CHECK(total == 100);
+    CHECK(sliced.allocations == 0u);
+
+    auto buffered = allocations::after_warm_up([&] {
+        int n = 0;
+        total = 0;
+        auto generated = seq::generate([n]() mutable { return n < 100? wheels::some(n++) : wheels::none; });
+        for(auto s = seq::chunk(generated, 8); !seq::empty(s); seq::pop_front(s)) {
+            total += static_cast<int>(seq::count(seq::front(s), 1));
+        }
+    });
+    CHECK(total == 1);
+    CHECK(buffered.allocations == 1u);
+}
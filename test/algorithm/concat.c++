@@ -0,0 +1,103 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/concat.h++>
+
+#include <taussig/algorithms/concat.h++>
+#include <taussig/algorithms/count.h++>
+#include <taussig/algorithms/fold.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/algorithms/map.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <functional>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+    struct segment_sizes {
+        template <typename S>
+        void operator()(S s) const {
+            std::size_t n = 0;
+            for(; !seq::empty(s); seq::pop_front(s)) ++n;
+            sizes.push_back(n);
+        }
+
+        std::vector<std::size_t>& sizes;
+    };
+} // namespace
+
+TEST_CASE("concat", "concat tests") {
+    std::vector<int> a { 1, 2, 3 };
+    std::list<int> b { 4, 5 };
+    std::vector<int> empty;
+    int n = 6;
+    auto c = [n]() mutable { return n < 9? wheels::some(n++) : wheels::none; };
+
+    auto s = seq::concat(seq::as_sequence(empty), seq::as_sequence(a), seq::as_sequence(empty),
+                         seq::as_sequence(b), seq::generate(c), seq::as_sequence(empty));
+    auto result = seq::materialize<std::vector<int>>(s);
+    CHECK((result == std::vector<int> { 1, 2, 3, 4, 5, 6, 7, 8 }));
+
+    CHECK(seq::empty(seq::concat(seq::as_sequence(empty), seq::as_sequence(empty))));
+
+    // the same reference types are kept, mixed ones become values
+    auto same = seq::concat(seq::as_sequence(a), seq::as_sequence(a));
+    static_assert(std::is_same<seq::ReferenceType<decltype(same)>, int&>(), "concat must keep common references");
+    seq::front(same) = 10;
+    CHECK(a[0] == 10);
+    auto doubled = seq::map([](int x) { return x * 2.5; }, seq::as_sequence(b));
+    auto mixed = seq::concat(seq::as_sequence(a), doubled);
+    static_assert(std::is_same<seq::ReferenceType<decltype(mixed)>, double>(), "concat must use common types for mixed references");
+    CHECK((seq::materialize<std::vector<double>>(mixed) == std::vector<double> { 10, 2, 3, 10, 12.5 }));
+}
+
+TEST_CASE("concat segments", "segment-aware terminals") {
+    std::vector<int> a { 1, 2, 3, 1 };
+    std::list<int> b { 1, 5 };
+    std::vector<int> c(100, 1);
+
+    auto s = seq::concat(seq::as_sequence(a), seq::as_sequence(b), seq::as_sequence(c));
+    std::vector<std::size_t> sizes;
+    seq::for_each_segment(s, segment_sizes { sizes });
+    CHECK((sizes == std::vector<std::size_t> { 4, 2, 100 }));
+
+    seq::pop_front(s);
+    seq::pop_front(s);
+    seq::pop_front(s);
+    seq::pop_front(s);
+    seq::pop_front(s);
+    sizes.clear();
+    seq::for_each_segment(s, segment_sizes { sizes });
+    CHECK((sizes == std::vector<std::size_t> { 0, 1, 100 }));
+
+    auto t = seq::concat(seq::as_sequence(a), seq::as_sequence(b), seq::as_sequence(c));
+    CHECK(seq::count(t, 1) == 103u);
+    CHECK(seq::fold(t, 0, std::plus<int>()) == 113);
+    CHECK(seq::fold(t, 1000, std::minus<int>()) == 887);
+    CHECK(seq::reduce(t, 0, std::plus<int>()) == 113);
+
+    // nested concatenations are segmented too
+    auto nested = seq::concat(t, seq::as_sequence(a));
+    CHECK(seq::count(nested, 1) == 105u);
+    CHECK(seq::fold(nested, 0, std::plus<int>()) == 120);
+
+    std::vector<std::size_t> one;
+    seq::for_each_segment(seq::as_sequence(a), segment_sizes { one });
+    CHECK((one == std::vector<std::size_t> { 4 }));
+}
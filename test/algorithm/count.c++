@@ -0,0 +1,62 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/count.h++>
+
+#include <taussig/algorithms/count.h++>
+#include <taussig/algorithms/map.h++>
+#include <taussig/primitives.h++>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+TEST_CASE("count", "count tests") {
+    SECTION("bytes", "counting delimiters in a buffer") {
+        std::string str;
+        std::size_t expected = 0;
+        for(auto i = 0u; i < 1000; ++i) {
+            bool delim = (i * 7) % 13 < 3;
+            str.push_back(delim? ',' : 'a' + i % 26);
+            expected += delim;
+        }
+        for(auto start = 0u; start < 40; ++start) {
+            auto s = seq::as_sequence(str);
+            s.first += start;
+            std::size_t naive = 0;
+            for(auto c : str.substr(start)) naive += c == ',';
+            CHECK(seq::count(s, ',') == naive);
+        }
+        CHECK(seq::count(seq::as_sequence(str), ',') == expected);
+    }
+    SECTION("wide", "contiguous wider integers") {
+        std::vector<std::uint16_t> v16(301);
+        std::vector<std::uint64_t> v64(301);
+        for(auto i = 0u; i < 301; ++i) {
+            v16[i] = i % 5;
+            v64[i] = i % 5;
+        }
+        CHECK(seq::count(seq::as_sequence(v16), 3) == 60u);
+        CHECK(seq::count(seq::as_sequence(v64), std::uint64_t(3)) == 60u);
+        CHECK(seq::count(seq::as_sequence(v16), -1) == 0u);
+    }
+    SECTION("generic", "non-contiguous sequences") {
+        std::vector<int> v { 1, 2, 3, 4, 5, 6 };
+        auto m = seq::map([](int x) { return x % 3; }, seq::as_sequence(v));
+        CHECK(seq::count(m, 0) == 2u);
+    }
+}
+TEST_CASE("count_if", "count_if tests") {
+    std::vector<int> v { 1, 2, 3, 4, 5, 6 };
+    CHECK(seq::count_if(seq::as_sequence(v), [](int x) { return x > 2; }) == 4u);
+}
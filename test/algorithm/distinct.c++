@@ -0,0 +1,78 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/distinct.h++>
+
+#include <taussig/algorithms/distinct.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+TEST_CASE("distinct", "distinct tests") {
+    std::vector<int> v { 3, 1, 3, 2, 1, 4, 4, 3 };
+    CHECK((seq::materialize<std::vector<int>>(seq::distinct(seq::as_sequence(v))) == std::vector<int> { 3, 1, 2, 4 }));
+    CHECK(seq::empty(seq::distinct(seq::as_sequence(std::vector<int>{}))));
+
+    std::vector<std::string> words { "b", "a", "b", "c", "a" };
+    CHECK((seq::materialize<std::vector<std::string>>(seq::distinct(seq::as_sequence(words)))
+           == std::vector<std::string> { "b", "a", "c" }));
+
+    // the elements are yielded, not the keys
+    std::vector<int> numbers { 12, 15, 31, 18, 7, 33 };
+    auto by_tens = seq::distinct_by(seq::as_sequence(numbers), [](int x) { return x / 10; });
+    CHECK((seq::materialize<std::vector<int>>(by_tens) == std::vector<int> { 12, 31, 7 }));
+
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &v]() mutable { return i < v.size()? wheels::some(v[i++]) : wheels::none; });
+    CHECK((seq::materialize<std::vector<int>>(seq::distinct(generated)) == std::vector<int> { 3, 1, 2, 4 }));
+
+    // copies remember the keys seen so far, but not each other's
+    auto first = seq::distinct(seq::as_sequence(v));
+    seq::pop_front(first);
+    auto second = first;
+    CHECK((seq::materialize<std::vector<int>>(first) == std::vector<int> { 1, 2, 4 }));
+    CHECK((seq::materialize<std::vector<int>>(second) == std::vector<int> { 1, 2, 4 }));
+
+    // many keys grow the table several times over
+    std::vector<int> many;
+    for(int j = 0; j < 50000; ++j) many.push_back((j * 7919) % 10007);
+    auto unique = seq::materialize<std::vector<int>>(seq::distinct(seq::as_sequence(many)));
+    CHECK(unique.size() == 10007u);
+    CHECK(std::set<int>(unique.begin(), unique.end()).size() == 10007u);
+}
+
+TEST_CASE("distinct/approximate", "approximate distinct tests") {
+    std::vector<int> v { 3, 1, 3, 2, 1, 4, 4, 3 };
+    CHECK((seq::materialize<std::vector<int>>(seq::distinct(seq::as_sequence(v), seq::approximate(1 << 12)))
+           == std::vector<int> { 3, 1, 2, 4 }));
+
+    std::vector<int> many;
+    for(int j = 0; j < 50000; ++j) many.push_back((j * 7919) % 10007);
+
+    // two bytes per key misses few of them, and never repeats one
+    auto ample = seq::materialize<std::vector<int>>(seq::distinct(seq::as_sequence(many), seq::approximate(20000)));
+    CHECK(std::set<int>(ample.begin(), ample.end()).size() == ample.size());
+    CHECK(ample.size() <= 10007u);
+    CHECK(ample.size() >= 9980u);
+
+    // a filter that is far too small still never repeats a key
+    auto starved = seq::materialize<std::vector<int>>(seq::distinct_by(seq::as_sequence(many), [](int x) { return x; }, seq::approximate(64)));
+    CHECK(std::set<int>(starved.begin(), starved.end()).size() == starved.size());
+    CHECK(starved.size() < 1000u);
+}
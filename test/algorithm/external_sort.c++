@@ -0,0 +1,110 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/external_sort.h++>
+
+#include <taussig/algorithms/external_sort.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace {
+    std::vector<std::uint32_t> shuffled(std::size_t n) {
+        std::vector<std::uint32_t> v(n);
+        std::uint32_t x = 7;
+        for(auto& e : v) {
+            x = x * 1664525u + 1013904223u;
+            e = x >> 12;
+        }
+        return v;
+    }
+
+    struct record {
+        std::uint32_t key;
+        double payload;
+    };
+    bool by_key(record const& a, record const& b) { return a.key < b.key; }
+} // namespace
+
+TEST_CASE("external_sort", "external_sort tests") {
+    auto v = shuffled(20000);
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+
+    // everything fits in memory
+    auto in_memory = seq::external_sort(seq::as_sequence(v), std::less<std::uint32_t>(), 1 << 20);
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(in_memory) == expected);
+
+    // 1000 elements per run, in the system's temporary directory and in the current one
+    auto spilled = seq::external_sort(seq::as_sequence(v), std::less<std::uint32_t>(), 4000);
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(spilled) == expected);
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::external_sort(seq::as_sequence(v), std::less<std::uint32_t>(), 4000, "."))
+          == expected);
+
+    // the last run is shorter than the others
+    std::vector<std::uint32_t> uneven(v.begin(), v.begin() + 2500);
+    auto uneven_expected = uneven;
+    std::sort(uneven_expected.begin(), uneven_expected.end(), std::greater<std::uint32_t>());
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::external_sort(seq::as_sequence(uneven), std::greater<std::uint32_t>(), 4000))
+          == uneven_expected);
+
+    // runs sorted in slices on several threads
+    seq::parallel_policy policy { 3, 64 };
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::external_sort(seq::as_sequence(v), std::less<std::uint32_t>(), 4000, "", policy))
+          == expected);
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::external_sort(seq::as_sequence(v), std::less<std::uint32_t>(), 1 << 20, "", policy))
+          == expected);
+
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &v]() mutable { return i < v.size()? wheels::some(v[i++]) : wheels::none; });
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::external_sort(generated, std::less<std::uint32_t>(), 4000)) == expected);
+
+    CHECK(seq::empty(seq::external_sort(seq::as_sequence(std::vector<int>{}), std::less<int>(), 4000)));
+}
+
+TEST_CASE("external_sort/threads", "external_sort only uses other threads when asked to") {
+    auto v = shuffled(100000);
+    auto const caller = std::this_thread::get_id();
+    bool other_thread = false;
+    auto checked_less = [caller, &other_thread](std::uint32_t a, std::uint32_t b) {
+        if(std::this_thread::get_id() != caller) other_thread = true;
+        return a < b;
+    };
+    auto sorted = seq::materialize<std::vector<std::uint32_t>>(seq::external_sort(seq::as_sequence(v), checked_less, 1 << 20));
+    CHECK(std::is_sorted(sorted.begin(), sorted.end()));
+    CHECK_FALSE(other_thread);
+}
+
+TEST_CASE("external_sort/copies", "external_sort copies read independently") {
+    std::vector<record> records;
+    for(auto k : shuffled(5000)) records.push_back(record { k % 1000, k / 1000.0 });
+
+    auto sorted = seq::external_sort(seq::as_sequence(records), by_key, 100 * sizeof(record));
+    for(int j = 0; j < 1234; ++j) seq::pop_front(sorted);
+    auto copy = sorted;
+
+    std::vector<std::uint32_t> keys, copy_keys;
+    for(; !seq::empty(sorted); seq::pop_front(sorted)) keys.push_back(seq::front(sorted).key);
+    for(; !seq::empty(copy); seq::pop_front(copy)) copy_keys.push_back(seq::front(copy).key);
+    CHECK(keys.size() == 5000u - 1234u);
+    CHECK(std::is_sorted(keys.begin(), keys.end()));
+    CHECK(keys == copy_keys);
+}
@@ -0,0 +1,79 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/find.h++>
+
+#include <taussig/algorithms/find.h++>
+#include <taussig/algorithms/map.h++>
+#include <taussig/algorithms/equal.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+TEST_CASE("find", "find tests") {
+    SECTION("generic", "non-contiguous sequences are searched element-wise") {
+        std::vector<int> v { 1, 2, 3, 4, 5 };
+        auto m = seq::map([](int x) { return x * 10; }, seq::as_sequence(v));
+        auto r = seq::find(m, 30);
+        REQUIRE(!seq::empty(r));
+        CHECK(seq::front(r) == 30);
+        std::vector<int> rest = seq::materialize(r);
+        CHECK(rest.size() == 3u);
+        CHECK(seq::empty(seq::find(m, 31)));
+    }
+    SECTION("bytes", "contiguous bytes") {
+        std::string str(1000, 'a');
+        for(auto i = 0u; i < str.size(); ++i) {
+            str[i] = 'x';
+            auto r = seq::find(seq::as_sequence(str), 'x');
+            REQUIRE(!seq::empty(r));
+            CHECK(&seq::front(r) == &str[i]);
+            str[i] = 'a';
+        }
+        CHECK(seq::empty(seq::find(seq::as_sequence(str), 'x')));
+        CHECK(seq::empty(seq::find(seq::as_sequence(str), 'a' + 256)));
+    }
+    SECTION("wide", "contiguous wider integers") {
+        std::vector<std::uint16_t> v16(300, 7);
+        std::vector<std::uint32_t> v32(300, 7);
+        std::vector<std::uint64_t> v64(300, 7);
+        for(auto i = 0u; i < 300; i += 7) {
+            v16[i] = 42; v32[i] = 42; v64[i] = 42;
+            auto s16 = seq::as_sequence(v16);
+            auto s32 = seq::as_sequence(v32);
+            auto s64 = seq::as_sequence(v64);
+            auto i16 = seq::find(s16, 42).first - s16.first;
+            auto i32 = seq::find(s32, 42u).first - s32.first;
+            auto i64 = seq::find(s64, std::uint64_t(42)).first - s64.first;
+            CHECK(i16 == i);
+            CHECK(i32 == i);
+            CHECK(i64 == i);
+            v16[i] = 7; v32[i] = 7; v64[i] = 7;
+        }
+    }
+    SECTION("utf16", "null-terminated UTF-16 strings") {
+        auto r = seq::find(seq::as_sequence(u"\U00010000abcdefghijklmnopqrstuvwxyz"), u'q');
+        REQUIRE(!seq::empty(r));
+        CHECK(seq::equal(r, seq::as_sequence(u"qrstuvwxyz")));
+    }
+}
+TEST_CASE("find_if", "find_if tests") {
+    std::vector<int> v { 1, 3, 5, 6, 7 };
+    auto r = seq::find_if(seq::as_sequence(v), [](int x) { return x % 2 == 0; });
+    REQUIRE(!seq::empty(r));
+    CHECK(seq::front(r) == 6);
+    CHECK(seq::empty(seq::find_if(seq::as_sequence(v), [](int x) { return x > 10; })));
+}
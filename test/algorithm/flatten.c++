@@ -15,6 +15,8 @@
 #include <taussig/primitives.h++>
 #include <taussig/interop.h++>
 
+#include "../allocations.h++"
+
 #include <catch.hpp>
 
 #include <vector>
@@ -40,3 +42,33 @@ TEST_CASE("flatten", "flatten tests") {
 }
 
 
+TEST_CASE("flatten allocations", "flatten allocation budget") {
+    std::vector<std::vector<int>> v { { 1, 2, 3 }, {}, { 4, 5 }, { 6 } };
+    auto sum = [](seq::result_of::flatten<seq::result_of::as_sequence<std::vector<std::vector<int>>&>> f) {
+        int total = 0;
+        for(; !seq::empty(f); seq::pop_front(f)) total += seq::front(f);
+        return total;
+    };
+    SECTION("views", "flattening sequences of views does not allocate") {
+        std::vector<decltype(seq::as_sequence(v[0]))> views;
+        for(auto& x : v) views.push_back(seq::as_sequence(x));
+        int total = 0;
+        auto counted = allocations::after_warm_up([&] {
+            total = 0;
+            for(auto f = seq::flatten(seq::as_sequence(views)); !seq::empty(f); seq::pop_front(f)) total += seq::front(f);
+        });
+        CHECK(total == 21);
+        CHECK(counted.allocations == 0u);
+    }
+    SECTION("containers", "flattening containers copies each one") {
+        int total = 0;
+        auto counted = allocations::after_warm_up([&] {
+            total = sum(seq::flatten(seq::as_sequence(v)));
+        });
+        CHECK(total == 21);
+        // one copy per non-empty inner vector, all released
+        CHECK(counted.allocations == 3u);
+        CHECK(counted.deallocations == 3u);
+        CHECK(counted.bytes == 6 * sizeof(int));
+    }
+}
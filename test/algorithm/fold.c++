@@ -0,0 +1,103 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/fold.h++>
+
+#include <taussig/algorithms/fold.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+TEST_CASE("fold", "fold tests") {
+    for(int n = 0; n < 40; ++n) {
+        std::vector<int> v(n);
+        std::iota(v.begin(), v.end(), 1);
+        CHECK(seq::fold(seq::as_sequence(v), 5, std::plus<int>()) == std::accumulate(v.begin(), v.end(), 5));
+        CHECK(seq::fold(seq::as_sequence(v), 0u, std::bit_xor<unsigned>()) == std::accumulate(v.begin(), v.end(), 0u, std::bit_xor<unsigned>()));
+        CHECK(seq::reduce(seq::as_sequence(v), 5, std::plus<int>()) == std::accumulate(v.begin(), v.end(), 5));
+    }
+
+    std::vector<int> v { 1, 2, 3, 4 };
+    // folds keep the order of non-associative operations
+    CHECK(seq::fold(seq::as_sequence(v), 100, std::minus<int>()) == 90);
+    CHECK(seq::fold(seq::as_sequence(v), std::string(">"), [](std::string s, int x) { return s + char('0' + x); }) == ">1234");
+
+    // an integral accumulator truncates each partial sum of floating-point elements
+    std::vector<double> d(16, 0.0);
+    d[0] = -1;
+    d[1] = 0.5;
+    CHECK(seq::fold(seq::as_sequence(d), 0, std::plus<double>()) == std::accumulate(d.begin(), d.end(), 0, std::plus<double>()));
+    CHECK(seq::fold(seq::as_sequence(d), 0, std::plus<double>()) == 0);
+
+    // a bool accumulator keeps only whether each partial sum is nonzero
+    std::vector<int> signs(16, 0);
+    signs[1] = 1;
+    signs[8] = -1;
+    CHECK(seq::fold(seq::as_sequence(signs), false, std::plus<int>()) == std::accumulate(signs.begin(), signs.end(), false, std::plus<int>()));
+    CHECK_FALSE(seq::fold(seq::as_sequence(signs), false, std::plus<int>()));
+}
+
+TEST_CASE("reduce", "reduce tests") {
+    std::vector<int> empty;
+    CHECK(!seq::reduce(seq::as_sequence(empty), std::plus<int>()));
+
+    std::vector<int> v { 3, 1, 4, 1, 5, 9, 2, 6 };
+    auto sum = seq::reduce(seq::as_sequence(v), std::plus<int>());
+    REQUIRE(sum);
+    CHECK(*sum == 31);
+    auto max = seq::reduce(seq::as_sequence(v), [](int a, int b) { return a < b? b : a; });
+    REQUIRE(max);
+    CHECK(*max == 9);
+
+    std::vector<double> d(1000);
+    for(std::size_t i = 0; i < d.size(); ++i) d[i] = 1.0 / double(i + 1);
+    CHECK(seq::reduce(seq::as_sequence(d), 0.0, std::plus<double>()) == Approx(std::accumulate(d.begin(), d.end(), 0.0)));
+
+    int n = 0;
+    auto generated = seq::generate([n]() mutable { return n < 10? wheels::some(n++) : wheels::none; });
+    CHECK(seq::reduce(generated, 0, std::plus<int>()) == 45);
+}
+
+TEST_CASE("parallel reduce", "parallel reduce tests") {
+    seq::parallel_policy const policy { 4, 16 };
+    for(int n : { 0, 1, 15, 16, 63, 64, 1000, 100003 }) {
+        std::vector<long> v(n);
+        std::iota(v.begin(), v.end(), -50);
+        auto expected = std::accumulate(v.begin(), v.end(), 7L);
+        CHECK(seq::reduce(seq::as_sequence(v), 7L, std::plus<long>(), policy) == expected);
+        CHECK(seq::reduce(seq::as_sequence(v), 7L, std::plus<long>(), seq::parallel) == expected);
+        auto sum = seq::reduce(seq::as_sequence(v), std::plus<long>(), policy);
+        CHECK(bool(sum) == (n > 0));
+        if(sum) CHECK(*sum == expected - 7);
+    }
+
+    // the partial results are combined in order
+    std::vector<std::string> words;
+    std::string expected;
+    for(int i = 0; i < 200; ++i) {
+        words.push_back(std::to_string(i));
+        expected += words.back();
+    }
+    CHECK(seq::reduce(seq::as_sequence(words), std::string(), std::plus<std::string>(), policy) == expected);
+
+    int n = 0;
+    auto generated = seq::generate([n]() mutable { return n < 100? wheels::some(n++) : wheels::none; });
+    CHECK(seq::reduce(generated, 0, std::plus<int>(), policy) == 4950);
+}
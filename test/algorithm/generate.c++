@@ -17,6 +17,8 @@
 
 #include <wheels/optional.h++>
 
+#include "../allocations.h++"
+
 #include <catch.hpp>
 
 #include <vector>
@@ -38,3 +40,15 @@ TEST_CASE("generate", "generate tests") {
     }
 }
 
+TEST_CASE("generate allocations", "generate does not allocate") {
+    int total = 0;
+    auto counted = allocations::after_warm_up([&] {
+        int n = 0;
+        total = 0;
+        for(auto s = seq::generate([n]() mutable { return n < 100? wheels::some(n++) : wheels::none; }); !seq::empty(s); seq::pop_front(s)) {
+            total += seq::front(s);
+        }
+    });
+    CHECK(total == 4950);
+    CHECK(counted.allocations == 0u);
+}
@@ -0,0 +1,87 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/group_by.h++>
+
+#include <taussig/algorithms/group_by.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    int tens(int x) { return x / 10; }
+
+    template <typename S>
+    std::vector<std::pair<int, std::vector<int>>> groups_of(S s) {
+        std::vector<std::pair<int, std::vector<int>>> result;
+        for(; !seq::empty(s); seq::pop_front(s)) {
+            auto group = seq::front(s);
+            result.emplace_back(group.first, seq::materialize<std::vector<int>>(group.second));
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("group_by", "group_by tests") {
+    std::vector<int> v { 1, 5, 12, 13, 17, 31, 2, 3 };
+    std::vector<std::pair<int, std::vector<int>>> expected {
+        { 0, { 1, 5 } }, { 1, { 12, 13, 17 } }, { 3, { 31 } }, { 0, { 2, 3 } },
+    };
+
+    CHECK(groups_of(seq::group_by(seq::as_sequence(v), tens)) == expected);
+
+    // multi-pass runs are slices of the source
+    auto sliced = seq::group_by(seq::as_sequence(v), tens);
+    seq::pop_front(sliced);
+    CHECK(&*seq::front(sliced).second.first == &v[2]);
+
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &v]() mutable { return i < v.size()? wheels::some(v[i++]) : wheels::none; });
+    CHECK(groups_of(seq::group_by(generated, tens)) == expected);
+
+    // single-pass runs that are not read to the end are skipped
+    std::size_t j = 0;
+    auto streamed = seq::group_by(seq::generate([j, &v]() mutable { return j < v.size()? wheels::some(v[j++]) : wheels::none; }), tens);
+    std::vector<int> firsts;
+    for(; !seq::empty(streamed); seq::pop_front(streamed)) {
+        firsts.push_back(seq::front(seq::front(streamed).second));
+    }
+    CHECK((firsts == std::vector<int> { 1, 12, 31, 2 }));
+
+    std::vector<int> empty;
+    CHECK(seq::empty(seq::group_by(seq::as_sequence(empty), tens)));
+}
+
+TEST_CASE("group_reduce", "group_reduce tests") {
+    std::vector<std::pair<std::string, int>> sales {
+        { "apples", 3 }, { "apples", 4 }, { "pears", 1 }, { "plums", 2 }, { "plums", 5 }, { "plums", 1 },
+    };
+    auto totals = seq::group_reduce(seq::as_sequence(sales),
+                                    [](std::pair<std::string, int> const& p) { return p.first; },
+                                    0,
+                                    [](int acc, std::pair<std::string, int> const& p) { return acc + p.second; });
+    auto result = seq::materialize<std::vector<std::pair<std::string, int>>>(totals);
+    CHECK((result == std::vector<std::pair<std::string, int>> { { "apples", 7 }, { "pears", 1 }, { "plums", 8 } }));
+
+    int n = 0;
+    auto counts = seq::group_reduce(seq::generate([n]() mutable { return n < 25? wheels::some(n++) : wheels::none; }),
+                                    tens, 0, [](int acc, int) { return acc + 1; });
+    auto counted = seq::materialize<std::vector<std::pair<int, int>>>(counts);
+    CHECK((counted == std::vector<std::pair<int, int>> { { 0, 10 }, { 1, 10 }, { 2, 5 } }));
+}
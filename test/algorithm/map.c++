@@ -15,6 +15,8 @@
 #include <taussig/primitives.h++>
 #include <taussig/interop.h++>
 
+#include "../allocations.h++"
+
 #include <catch.hpp>
 
 #include <vector>
@@ -32,3 +34,16 @@ TEST_CASE("map", "map tests") {
     }
 }
 
+TEST_CASE("map allocations", "map does not allocate") {
+    std::vector<int> v { 1, 2, 3, 4, 5 };
+    int total = 0;
+    auto counted = allocations::after_warm_up([&] {
+        total = 0;
+        auto s = seq::map([](int x) { return 2*x; }, seq::as_sequence(v));
+        for(auto t = seq::map([](int x) { return x + 1; }, s); !seq::empty(t); seq::pop_front(t)) {
+            total += seq::front(t);
+        }
+    });
+    CHECK(total == 35);
+    CHECK(counted.allocations == 0u);
+}
@@ -0,0 +1,82 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/match_all.h++>
+
+#include <taussig/algorithms/match_all.h++>
+#include <taussig/algorithms/flatten.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    template <typename Seq, typename Char>
+    std::vector<std::pair<std::size_t, std::size_t>> all_matches(Seq&& s, seq::aho_corasick<Char> const& ac) {
+        std::vector<std::pair<std::size_t, std::size_t>> result;
+        for(auto m = seq::match_all(std::forward<Seq>(s), ac); !seq::empty(m); seq::pop_front(m)) {
+            result.emplace_back(seq::front(m).pattern, seq::front(m).offset);
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("match_all", "match_all tests") {
+    using matches = std::vector<std::pair<std::size_t, std::size_t>>;
+    SECTION("classic", "overlapping patterns") {
+        std::vector<std::string> patterns { "he", "she", "his", "hers" };
+        seq::aho_corasick<char> ac(patterns);
+        CHECK(ac.pattern_count() == 4u);
+        CHECK(all_matches(seq::as_sequence("ushers"), ac) == (matches { { 1, 1 }, { 0, 2 }, { 3, 2 } }));
+        CHECK(all_matches(seq::as_sequence("xyz"), ac).empty());
+    }
+    SECTION("naive", "agrees with a naive scan, with dense and sparse states") {
+        std::vector<std::string> patterns;
+        for(auto i = 0u; i < 200; ++i) {
+            std::string p;
+            for(auto j = 0u; j < 2 + i % 5; ++j) p.push_back("abcd"[(i * 7 + j * 3 + i / 4) % 4]);
+            patterns.push_back(p);
+        }
+        std::string text;
+        for(auto i = 0u; i < 3000; ++i) text.push_back("abcde"[(i * 13 + i / 7) % 5]);
+
+        matches expected;
+        for(auto end = 1u; end <= text.size(); ++end) {
+            std::vector<std::pair<std::size_t, std::size_t>> here;
+            for(auto id = 0u; id < patterns.size(); ++id) {
+                auto const& p = patterns[id];
+                if(p.size() <= end && text.compare(end - p.size(), p.size(), p) == 0) {
+                    here.emplace_back(id, end - p.size());
+                }
+            }
+            std::sort(here.begin(), here.end(), [](std::pair<std::size_t, std::size_t> a, std::pair<std::size_t, std::size_t> b) {
+                return a.second < b.second || (a.second == b.second && a.first < b.first);
+            });
+            expected.insert(expected.end(), here.begin(), here.end());
+        }
+        for(auto limit : { std::size_t(1), std::size_t(64), std::size_t(1) << 16 }) {
+            seq::aho_corasick<char> ac(patterns, limit);
+            CHECK(all_matches(seq::as_sequence(text), ac) == expected);
+        }
+    }
+    SECTION("flatten", "non-contiguous UTF-16 input") {
+        std::vector<std::u16string> patterns { u"été", u"té" };
+        seq::aho_corasick<char16_t> ac(patterns);
+        std::vector<std::u16string> chunks { u"l'é", u"", u"té é" };
+        auto text = seq::flatten(seq::as_sequence(chunks));
+        CHECK(all_matches(text, ac) == (matches { { 0, 2 }, { 1, 3 } }));
+    }
+}
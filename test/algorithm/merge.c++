@@ -0,0 +1,134 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/merge.h++>
+
+#include <taussig/algorithms/merge.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+    struct first_less {
+        bool operator()(std::pair<int, int> const& a, std::pair<int, int> const& b) const { return a.first < b.first; }
+    };
+
+    std::vector<std::vector<int>> sorted_runs(std::size_t k, std::size_t n) {
+        std::mt19937 rng(42);
+        std::vector<std::vector<int>> runs(k);
+        for(std::size_t i = 0; i < k; ++i) {
+            for(std::size_t j = 0; j < n + i % 3; ++j) runs[i].push_back(int(rng() % 100));
+            std::sort(runs[i].begin(), runs[i].end());
+        }
+        return runs;
+    }
+
+    std::vector<int> sorted_all(std::vector<std::vector<int>> const& runs) {
+        std::vector<int> all;
+        for(auto const& r : runs) all.insert(all.end(), r.begin(), r.end());
+        std::sort(all.begin(), all.end());
+        return all;
+    }
+} // namespace
+
+TEST_CASE("merge", "merge tests") {
+    std::vector<int> a { 1, 3, 5, 7, 9 };
+    std::vector<int> b { 2, 3, 4, 10 };
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(a, b)) == std::vector<int> { 1, 2, 3, 3, 4, 5, 7, 9, 10 }));
+
+    std::vector<int> none;
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(a, none)) == a));
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(none, b)) == b));
+    CHECK(seq::empty(seq::merge(none, none)));
+
+    // mixed sources yield values of the common type
+    std::list<long> l { 0, 6, 11 };
+    CHECK((seq::materialize<std::vector<long>>(seq::merge(a, l)) == std::vector<long> { 0, 1, 3, 5, 6, 7, 9, 11 }));
+
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &b]() mutable { return i < b.size()? wheels::some(b[i++]) : wheels::none; });
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(a, generated)) == std::vector<int> { 1, 2, 3, 3, 4, 5, 7, 9, 10 }));
+
+    // same sources yield the elements themselves, and equal ones come from the first
+    auto merged = seq::merge(a, b);
+    seq::pop_front(merged);
+    seq::pop_front(merged);
+    CHECK(&seq::front(merged) == &a[1]);
+    seq::pop_front(merged);
+    CHECK(&seq::front(merged) == &b[1]);
+
+    auto runs = sorted_runs(2, 500);
+    CHECK(seq::materialize<std::vector<int>>(seq::merge(runs[0], runs[1])) == sorted_all(runs));
+
+    std::vector<int> ra(a.rbegin(), a.rend());
+    std::vector<int> rb(b.rbegin(), b.rend());
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(ra, rb, std::greater<int>{})) == std::vector<int> { 10, 9, 7, 5, 4, 3, 3, 2, 1 }));
+    auto by_last_digit = [](int x, int y) { return x % 10 < y % 10; };
+    std::vector<int> c { 20, 31, 45 };
+    std::vector<int> d { 11, 2, 35, 9 };
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(c, d, by_last_digit)) == std::vector<int> { 20, 31, 11, 2, 45, 35, 9 }));
+}
+
+TEST_CASE("merge/k-way", "merge of many sources") {
+    std::vector<int> a { 1, 4, 7 };
+    std::vector<int> b { 2, 5, 8 };
+    std::vector<int> c { 0, 3, 6, 9 };
+    std::vector<int> none;
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(a, b, c)) == std::vector<int> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(none, a, none, b, c, none)) == std::vector<int> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+    CHECK(seq::empty(seq::merge(none, none, none)));
+
+    // a trailing comparator
+    std::vector<int> ra(a.rbegin(), a.rend());
+    std::vector<int> rb(b.rbegin(), b.rend());
+    std::vector<int> rc(c.rbegin(), c.rend());
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(ra, rb, rc, std::greater<int>{})) == std::vector<int> { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }));
+    CHECK((seq::materialize<std::vector<int>>(seq::merge(ra, none, rb, rc, std::greater<int>{})) == std::vector<int> { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }));
+
+    for(std::size_t k : { 1, 2, 3, 5, 8, 13 }) {
+        auto runs = sorted_runs(k, 200);
+        CHECK(seq::materialize<std::vector<int>>(seq::merge_all(runs)) == sorted_all(runs));
+    }
+    CHECK(seq::empty(seq::merge_all(std::vector<std::vector<int>>{})));
+
+    auto runs = sorted_runs(7, 100);
+    for(auto& r : runs) std::reverse(r.begin(), r.end());
+    auto all = sorted_all(runs);
+    std::reverse(all.begin(), all.end());
+    CHECK(seq::materialize<std::vector<int>>(seq::merge_all(runs, std::greater<int>{})) == all);
+}
+
+TEST_CASE("merge/stable", "merges keep equal elements in source order") {
+    std::vector<std::vector<std::pair<int, int>>> runs(6);
+    for(int i = 0; i < 6; ++i) {
+        for(int key = 0; key < 20; key += 1 + i % 2) runs[i].emplace_back(key, i);
+    }
+    auto merged = seq::materialize<std::vector<std::pair<int, int>>>(seq::merge_all(runs, first_less{}));
+    auto expected = merged;
+    std::sort(expected.begin(), expected.end());
+    CHECK(merged == expected);
+
+    std::vector<std::pair<int, int>> x { { 1, 0 }, { 2, 0 } };
+    std::vector<std::pair<int, int>> y { { 1, 1 }, { 2, 1 } };
+    CHECK((seq::materialize<std::vector<std::pair<int, int>>>(seq::merge_all(std::vector<std::vector<std::pair<int, int>>> { y, x }, first_less{}))
+           == std::vector<std::pair<int, int>> { { 1, 1 }, { 1, 0 }, { 2, 1 }, { 2, 0 } }));
+}
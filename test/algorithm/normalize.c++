@@ -0,0 +1,49 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/normalize.h++>
+
+#include <taussig/algorithms/normalize.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <catch.hpp>
+
+#include <string>
+
+namespace {
+    std::u32string nfc(std::u32string const& s) { return seq::materialize(seq::nfc(seq::as_sequence(s))); }
+    std::u32string nfd(std::u32string const& s) { return seq::materialize(seq::nfd(seq::as_sequence(s))); }
+} // namespace
+
+TEST_CASE("nfd", "nfd tests") {
+    CHECK(nfd(U"") == U"");
+    CHECK(nfd(U"plain ascii") == U"plain ascii");
+    CHECK(nfd(U"\u00E9t\u00E9") == U"e\u0301te\u0301");
+    CHECK(nfd(U"\u1E69") == U"s\u0323\u0307"); // recursive decomposition
+    CHECK(nfd(U"q\u0307\u0323") == U"q\u0323\u0307"); // canonical reordering
+    CHECK(nfd(U"\u212B") == U"A\u030A"); // singleton
+    CHECK(nfd(U"\uAC01") == U"\u1100\u1161\u11A8"); // hangul
+    CHECK(nfd(U"\u0F73x") == U"\u0F71\u0F72x"); // starter decomposing to non-starters
+    CHECK(nfd(U"\u0301a") == U"\u0301a"); // defective combining sequence
+}
+TEST_CASE("nfc", "nfc tests") {
+    CHECK(nfc(U"") == U"");
+    CHECK(nfc(U"plain ascii") == U"plain ascii");
+    CHECK(nfc(U"e\u0301te\u0301") == U"\u00E9t\u00E9");
+    CHECK(nfc(U"s\u0307\u0323") == U"\u1E69");
+    CHECK(nfc(U"\u212B") == U"\u00C5");
+    CHECK(nfc(U"\u1100\u1161\u11A8 \uAC00\u11A8") == U"\uAC01 \uAC01"); // hangul
+    CHECK(nfc(U"a\u0328\u0301") == U"\u0105\u0301"); // partial composition
+    CHECK(nfc(U"\u0958") == U"\u0915\u093C"); // composition exclusion
+    CHECK(nfc(U"\u0B47\u0B3E") == U"\u0B4B"); // starter + starter
+    CHECK(nfc(U"\u0301a\u0301") == U"\u0301\u00E1");
+}
@@ -0,0 +1,99 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/probe.h++>
+
+#include <taussig/algorithms/probe.h++>
+#include <taussig/algorithms/map.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include "../allocations.h++"
+
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("probe", "probe tests") {
+    std::vector<int> v { 1, 2, 3, 4, 5 };
+    seq::reset_probes();
+
+    SECTION("elements", "probes do not change the elements") {
+        auto s = seq::probe(seq::map([](int x) { return x * 2; }, seq::probe(seq::as_sequence(v), "probe.source")), "probe.map");
+        auto result = seq::materialize<std::vector<int>>(s);
+        std::vector<int> expected { 2, 4, 6, 8, 10 };
+        CHECK(result == expected);
+    }
+#if defined(TAUSSIG_NO_PROBES)
+    SECTION("disabled", "disabled probes are plain copies") {
+        CHECK((std::is_same<seq::result_of::probe<decltype(seq::as_sequence(v))>, decltype(seq::as_sequence(v))>()));
+        // names longer than a short string buffer are not copied
+        auto counted = allocations::during([&] {
+            auto s = seq::probe(seq::as_sequence(v), "a probe name that is too long for any short string buffer");
+            seq::empty(s);
+            auto t = seq::probe(seq::as_sequence(v), "a probe name that is too long for any short string buffer", seq::sample_ticks);
+            seq::empty(t);
+        });
+        CHECK(counted.allocations == 0u);
+    }
+#else
+    SECTION("counts", "probes count calls by name") {
+        {
+            auto s = seq::probe(seq::as_sequence(v), "probe.counts");
+            int total = 0;
+            for(; !seq::empty(s); seq::pop_front(s)) total += seq::front(s);
+            CHECK(total == 15);
+            auto copy = s; // copies start counting from zero
+            CHECK(seq::empty(copy));
+        }
+        auto& stats = seq::probe_stats_for("probe.counts");
+#if defined(NDEBUG)
+        CHECK(stats.empty_calls == 7u);
+#else
+        CHECK(stats.empty_calls == 12u); // seq::pop_front asserts !empty
+#endif
+        CHECK(stats.front_calls == 5u);
+        CHECK(stats.pop_front_calls == 5u);
+        CHECK(stats.sampled == 0u);
+    }
+    SECTION("timed", "timed probes sample some calls") {
+        {
+            std::vector<int> w(1000, 1);
+            auto s = seq::probe(seq::as_sequence(w), "probe.timed", seq::sample_ticks);
+            while(!seq::empty(s)) seq::pop_front(s);
+        }
+        auto& stats = seq::probe_stats_for("probe.timed");
+        CHECK(stats.pop_front_calls == 1000u);
+        CHECK(stats.sampled > 0u);
+        CHECK(stats.sampled < 100u);
+    }
+    SECTION("dump", "dumps list every probe") {
+        {
+            auto s = seq::probe(seq::as_sequence(v), "probe.dump");
+            seq::empty(s);
+            std::vector<int> w(1000, 1);
+            auto t = seq::probe(seq::as_sequence(w), "probe.dump.timed", seq::sample_ticks);
+            while(!seq::empty(t)) seq::pop_front(t);
+        }
+        std::ostringstream os;
+        os.precision(3);
+        auto const flags = os.flags();
+        seq::dump_probes(os);
+        CHECK(os.str().find("probe.dump") != std::string::npos);
+        // the stream's formatting is left as it was
+        CHECK(os.flags() == flags);
+        CHECK(os.precision() == 3);
+    }
+#endif
+}
@@ -0,0 +1,147 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/scan.h++>
+
+#include <taussig/algorithms/scan.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+    template <typename T>
+    std::vector<T> exclusive_sums(std::vector<T> const& v, T init) {
+        std::vector<T> result;
+        for(auto x : v) {
+            result.push_back(init);
+            init += x;
+        }
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> inclusive_sums(std::vector<T> const& v) {
+        std::vector<T> result(v.size());
+        std::partial_sum(v.begin(), v.end(), result.begin());
+        return result;
+    }
+} // namespace
+
+TEST_CASE("scan", "lazy scan tests") {
+    std::vector<int> v { 3, 1, 4, 1, 5 };
+
+    auto inclusive = seq::materialize<std::vector<int>>(seq::inclusive_scan(seq::as_sequence(v), std::plus<int>()));
+    CHECK((inclusive == std::vector<int> { 3, 4, 8, 9, 14 }));
+    auto seeded = seq::materialize<std::vector<int>>(seq::inclusive_scan(seq::as_sequence(v), 10, std::plus<int>()));
+    CHECK((seeded == std::vector<int> { 13, 14, 18, 19, 24 }));
+    auto exclusive = seq::materialize<std::vector<int>>(seq::exclusive_scan(seq::as_sequence(v), 0, std::plus<int>()));
+    CHECK((exclusive == std::vector<int> { 0, 3, 4, 8, 9 }));
+
+    std::vector<int> empty;
+    CHECK(seq::empty(seq::inclusive_scan(seq::as_sequence(empty), std::plus<int>())));
+    CHECK(seq::empty(seq::exclusive_scan(seq::as_sequence(empty), 0, std::plus<int>())));
+
+    // streaming sources are scanned as they are consumed
+    int n = 0;
+    auto lengths = seq::generate([n]() mutable { return n < 4? wheels::some(n++) : wheels::none; });
+    auto names = seq::materialize<std::vector<std::string>>(
+                    seq::inclusive_scan(lengths, std::string(), [](std::string s, int x) { return s + char('a' + x); }));
+    CHECK((names == std::vector<std::string> { "a", "ab", "abc", "abcd" }));
+}
+
+TEST_CASE("scan_into", "eager scan tests") {
+    for(int n = 0; n < 70; ++n) {
+        std::vector<std::int32_t> v32(n);
+        std::vector<std::int64_t> v64(n);
+        std::vector<std::int16_t> v16(n);
+        for(int i = 0; i < n; ++i) {
+            v32[i] = (i * 7919) % 1000 - 300;
+            v64[i] = std::int64_t(i) << 33;
+            v16[i] = std::int16_t(i % 50);
+        }
+
+        std::vector<std::int32_t> out32(n);
+        CHECK(seq::inclusive_scan_into(seq::as_sequence(v32), out32.begin(), std::plus<std::int32_t>()) == out32.end());
+        CHECK(out32 == inclusive_sums(v32));
+        CHECK(seq::exclusive_scan_into(seq::as_sequence(v32), out32.data(), 5, std::plus<std::int32_t>()) == out32.data() + n);
+        CHECK(out32 == exclusive_sums(v32, 5));
+
+        std::vector<std::int64_t> out64(n);
+        seq::inclusive_scan_into(seq::as_sequence(v64), out64.begin(), std::plus<std::int64_t>());
+        CHECK(out64 == inclusive_sums(v64));
+        seq::exclusive_scan_into(seq::as_sequence(v64), out64.begin(), std::int64_t(-1), std::plus<std::int64_t>());
+        CHECK(out64 == exclusive_sums(v64, std::int64_t(-1)));
+
+        std::vector<std::int16_t> out16(n);
+        seq::inclusive_scan_into(seq::as_sequence(v16), out16.begin(), std::plus<std::int16_t>());
+        CHECK(out16 == inclusive_sums(v16));
+
+        // in place
+        auto copy = v32;
+        seq::inclusive_scan_into(seq::as_sequence(copy), copy.begin(), std::plus<std::int32_t>());
+        CHECK(copy == inclusive_sums(v32));
+    }
+
+    std::vector<unsigned> lengths { 10, 20, 5 };
+    std::list<unsigned> offsets;
+    seq::exclusive_scan_into(seq::as_sequence(lengths), std::back_inserter(offsets), 0u, std::plus<unsigned>());
+    CHECK((offsets == std::list<unsigned> { 0, 10, 30 }));
+
+    std::vector<int> v { 2, 3, 4 };
+    std::vector<int> products;
+    seq::inclusive_scan_into(seq::as_sequence(v), std::back_inserter(products), std::multiplies<int>());
+    CHECK((products == std::vector<int> { 2, 6, 24 }));
+}
+
+TEST_CASE("parallel scan_into", "parallel eager scan tests") {
+    seq::parallel_policy const policy { 4, 16 };
+    for(int n : { 0, 1, 15, 16, 63, 64, 1000, 100003 }) {
+        std::vector<std::int64_t> v(n);
+        std::iota(v.begin(), v.end(), -500);
+        std::vector<std::int64_t> out(n);
+        CHECK(seq::inclusive_scan_into(seq::as_sequence(v), out.begin(), std::plus<std::int64_t>(), policy) == out.end());
+        CHECK(out == inclusive_sums(v));
+        CHECK(seq::exclusive_scan_into(seq::as_sequence(v), out.begin(), std::int64_t(7), std::plus<std::int64_t>(), policy) == out.end());
+        CHECK(out == exclusive_sums(v, std::int64_t(7)));
+        seq::exclusive_scan_into(seq::as_sequence(v), out.begin(), std::int64_t(7), std::plus<std::int64_t>(), seq::parallel);
+        CHECK(out == exclusive_sums(v, std::int64_t(7)));
+    }
+
+    // slices are combined in order
+    std::vector<std::string> words;
+    for(int i = 0; i < 100; ++i) words.push_back(std::to_string(i % 10));
+    std::vector<std::string> prefixes(words.size());
+    seq::inclusive_scan_into(seq::as_sequence(words), prefixes.begin(), std::plus<std::string>(), policy);
+    std::string expected;
+    for(std::size_t i = 0; i < words.size(); ++i) {
+        expected += words[i];
+        CHECK(prefixes[i] == expected);
+    }
+
+    // output iterators that are not random-access fall back to one thread
+    std::vector<int> v(1000, 1);
+    std::vector<int> out;
+    seq::inclusive_scan_into(seq::as_sequence(v), std::back_inserter(out), std::plus<int>(), policy);
+    REQUIRE(out.size() == v.size());
+    CHECK(out.back() == 1000);
+}
@@ -0,0 +1,82 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/search.h++>
+
+#include <taussig/algorithms/search.h++>
+#include <taussig/algorithms/map.h++>
+#include <taussig/algorithms/equal.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace {
+    template <typename Hay, typename Needle>
+    std::ptrdiff_t reference_search(Hay const& h, Needle const& n) {
+        return std::search(h.begin(), h.end(), n.begin(), n.end()) - h.begin();
+    }
+    template <typename Hay, typename Needle>
+    std::ptrdiff_t offset_of(Hay const& h, Needle const& n) {
+        auto s = seq::as_sequence(h);
+        return seq::search(s, seq::as_sequence(n)).first - s.first;
+    }
+} // namespace
+
+TEST_CASE("search", "search tests") {
+    SECTION("bytes", "contiguous byte sequences") {
+        std::string hay;
+        for(auto i = 0u; i < 2000; ++i) hay.push_back("abcab"[(i * 7 + i / 3) % 5]);
+        std::vector<std::string> needles { "", "a", "ab", "cab", "abcabcab", "bcaabcab", "zz", "<marker>" };
+        hay.replace(1500, 8, "<marker>");
+        for(auto const& n : needles) {
+            CHECK(offset_of(hay, n) == reference_search(hay, n));
+        }
+    }
+    SECTION("periodic", "periodic needles and the degenerate fallback") {
+        std::string hay(5000, 'a');
+        hay += "b";
+        std::string needle(40, 'a');
+        needle += "b";
+        CHECK(offset_of(hay, needle) == reference_search(hay, needle));
+        std::string miss(40, 'a');
+        miss += "c";
+        CHECK(offset_of(hay, miss) == reference_search(hay, miss));
+    }
+    SECTION("utf16", "null-terminated UTF-16 strings") {
+        auto r = seq::search(seq::as_sequence(u"\U00010000 header: X-Marker: yes"), seq::as_sequence(u"X-Marker"));
+        CHECK(seq::equal(r, seq::as_sequence(u"X-Marker: yes")));
+        CHECK(seq::empty(seq::search(seq::as_sequence(u"abcdef"), seq::as_sequence(u"abd"))));
+    }
+    SECTION("random_access", "non-contiguous random-access sequences use Two-Way") {
+        std::deque<int> hay;
+        for(auto i = 0; i < 500; ++i) hay.push_back(i % 7 == 3? 1 : i % 3);
+        std::vector<int> needle { 1, 1, 2 };
+        std::deque<int> needle_deque(needle.begin(), needle.end());
+        CHECK(offset_of(hay, needle) == reference_search(hay, needle));
+        CHECK(offset_of(hay, needle_deque) == reference_search(hay, needle));
+    }
+    SECTION("generic", "single-pass sequences") {
+        std::vector<int> v { 1, 2, 1, 2, 1, 2, 3, 4 };
+        auto m = seq::map([](int x) { return x * 2; }, seq::as_sequence(v));
+        std::vector<int> needle { 2, 4, 2, 4, 6 };
+        auto r = seq::search(m, seq::as_sequence(needle));
+        std::vector<int> rest = seq::materialize(r);
+        CHECK(rest == (std::vector<int> { 2, 4, 2, 4, 6, 8 }));
+        std::vector<int> miss { 4, 4 };
+        CHECK(seq::empty(seq::search(m, seq::as_sequence(miss))));
+    }
+}
@@ -0,0 +1,162 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/set_operations.h++>
+
+#include <taussig/algorithms/set_operations.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace {
+    template <typename T>
+    std::vector<T> sorted_sample(std::size_t n, T range, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::vector<T> v(n);
+        for(auto& x : v) x = T(rng() % range);
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+
+    template <typename T>
+    std::vector<T> unique_sample(std::size_t n, T range, unsigned seed) {
+        auto v = sorted_sample(n, range, seed);
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        return v;
+    }
+
+    template <typename T>
+    std::vector<T> std_union(std::vector<T> const& a, std::vector<T> const& b) {
+        std::vector<T> r;
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(r));
+        return r;
+    }
+    template <typename T>
+    std::vector<T> std_intersection(std::vector<T> const& a, std::vector<T> const& b) {
+        std::vector<T> r;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(r));
+        return r;
+    }
+    template <typename T>
+    std::vector<T> std_difference(std::vector<T> const& a, std::vector<T> const& b) {
+        std::vector<T> r;
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(r));
+        return r;
+    }
+} // namespace
+
+TEST_CASE("set_union", "set_union tests") {
+    std::vector<int> a { 1, 2, 2, 4, 6 };
+    std::vector<int> b { 2, 3, 4, 4, 7 };
+    std::vector<int> none;
+    CHECK((seq::materialize<std::vector<int>>(seq::set_union(a, b)) == std::vector<int> { 1, 2, 2, 3, 4, 4, 6, 7 }));
+    CHECK((seq::materialize<std::vector<int>>(seq::set_union(a, none)) == a));
+    CHECK((seq::materialize<std::vector<int>>(seq::set_union(none, b)) == b));
+    CHECK(seq::empty(seq::set_union(none, none)));
+
+    std::list<long> l { 0, 2, 5 };
+    CHECK((seq::materialize<std::vector<long>>(seq::set_union(a, l)) == std::vector<long> { 0, 1, 2, 2, 4, 5, 6 }));
+
+    auto x = sorted_sample<int>(300, 100, 1);
+    auto y = sorted_sample<int>(200, 100, 2);
+    CHECK(seq::materialize<std::vector<int>>(seq::set_union(x, y)) == std_union(x, y));
+}
+
+TEST_CASE("set_intersection", "set_intersection tests") {
+    std::vector<int> a { 1, 2, 2, 4, 6 };
+    std::vector<int> b { 2, 3, 4, 4, 7 };
+    std::vector<int> none;
+    CHECK((seq::materialize<std::vector<int>>(seq::set_intersection(a, b)) == std::vector<int> { 2, 4 }));
+    CHECK(seq::empty(seq::set_intersection(a, none)));
+    CHECK(seq::empty(seq::set_intersection(none, b)));
+
+    // the elements come from the first sequence
+    CHECK(&seq::front(seq::set_intersection(a, b)) == &a[1]);
+
+    std::list<int> l(b.begin(), b.end());
+    CHECK((seq::materialize<std::vector<int>>(seq::set_intersection(l, a)) == std::vector<int> { 2, 4 }));
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &b]() mutable { return i < b.size()? wheels::some(b[i++]) : wheels::none; });
+    CHECK((seq::materialize<std::vector<int>>(seq::set_intersection(generated, a)) == std::vector<int> { 2, 4 }));
+
+    // galloping over skewed lengths, both ways round
+    auto x = sorted_sample<int>(5000, 20000, 3);
+    auto y = sorted_sample<int>(40, 20000, 4);
+    CHECK(seq::materialize<std::vector<int>>(seq::set_intersection(x, y)) == std_intersection(x, y));
+    CHECK(seq::materialize<std::vector<int>>(seq::set_intersection(y, x)) == std_intersection(y, x));
+    std::list<int> ly(y.begin(), y.end());
+    CHECK(seq::materialize<std::vector<int>>(seq::set_intersection(x, ly)) == std_intersection(x, y));
+
+    auto dx = sorted_sample<int>(1000, 50, 5);
+    auto dy = sorted_sample<int>(700, 50, 6);
+    CHECK(seq::materialize<std::vector<int>>(seq::set_intersection(dx, dy)) == std_intersection(dx, dy));
+
+    std::vector<int> rx(x.rbegin(), x.rend());
+    std::vector<int> ry(y.rbegin(), y.rend());
+    auto expected = std_intersection(x, y);
+    std::reverse(expected.begin(), expected.end());
+    CHECK(seq::materialize<std::vector<int>>(seq::set_intersection(rx, ry, std::greater<int>{})) == expected);
+}
+
+TEST_CASE("set_intersection/blocks", "set_intersection of sorted uint32_t arrays") {
+    // every alignment of the common elements within and across blocks
+    for(unsigned seed = 0; seed < 20; ++seed) {
+        auto x = unique_sample<std::uint32_t>(1000 + seed, 4000, seed);
+        auto y = unique_sample<std::uint32_t>(900 + seed * 7, 4000, seed + 100);
+        CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::set_intersection(x, y)) == std_intersection(x, y));
+        CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::set_intersection(y, x, std::less<std::uint32_t>{}))
+              == std_intersection(y, x));
+    }
+
+    std::vector<std::uint32_t> evens, odds, all;
+    for(std::uint32_t i = 0; i < 1000; ++i) (i % 2? odds : evens).push_back(i), all.push_back(i);
+    CHECK(seq::empty(seq::set_intersection(evens, odds)));
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::set_intersection(all, evens)) == evens);
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::set_intersection(odds, all)) == odds);
+
+    // duplicates are matched one for one
+    auto dx = sorted_sample<std::uint32_t>(1000, 200, 7);
+    auto dy = sorted_sample<std::uint32_t>(1000, 200, 8);
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::set_intersection(dx, dy)) == std_intersection(dx, dy));
+    std::vector<std::uint32_t> sevens(13, 7);
+    std::vector<std::uint32_t> some_sevens { 1, 7, 7, 7, 7, 7, 9, 9, 9, 10 };
+    CHECK(seq::materialize<std::vector<std::uint32_t>>(seq::set_intersection(sevens, some_sevens)) == std::vector<std::uint32_t>(5, 7));
+}
+
+TEST_CASE("set_difference", "set_difference tests") {
+    std::vector<int> a { 1, 2, 2, 4, 6 };
+    std::vector<int> b { 2, 3, 4, 4, 7 };
+    std::vector<int> none;
+    CHECK((seq::materialize<std::vector<int>>(seq::set_difference(a, b)) == std::vector<int> { 1, 2, 6 }));
+    CHECK((seq::materialize<std::vector<int>>(seq::set_difference(b, a)) == std::vector<int> { 3, 4, 7 }));
+    CHECK((seq::materialize<std::vector<int>>(seq::set_difference(a, none)) == a));
+    CHECK(seq::empty(seq::set_difference(none, b)));
+
+    std::list<int> l(b.begin(), b.end());
+    CHECK((seq::materialize<std::vector<int>>(seq::set_difference(a, l)) == std::vector<int> { 1, 2, 6 }));
+
+    auto x = sorted_sample<int>(300, 1000, 9);
+    auto y = sorted_sample<int>(5000, 1000, 10);
+    CHECK(seq::materialize<std::vector<int>>(seq::set_difference(x, y)) == std_difference(x, y));
+    CHECK(seq::materialize<std::vector<int>>(seq::set_difference(y, x)) == std_difference(y, x));
+}
@@ -0,0 +1,103 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/unique.h++>
+
+#include <taussig/algorithms/unique.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    template <typename T>
+    std::vector<std::pair<T, std::size_t>> runs_of(std::vector<T> const& v) {
+        std::vector<std::pair<T, std::size_t>> result;
+        for(auto const& x : v) {
+            if(!result.empty() && result.back().first == x) ++result.back().second;
+            else result.emplace_back(x, 1);
+        }
+        return result;
+    }
+
+    // runs around the block widths of the kernels
+    template <typename T>
+    std::vector<T> stepped() {
+        std::vector<T> v;
+        std::size_t const lengths[] = { 1, 1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 100, 1, 3 };
+        T x = 0;
+        for(auto n : lengths) {
+            for(std::size_t i = 0; i < n; ++i) v.push_back(x);
+            x = T(x + 1);
+        }
+        return v;
+    }
+} // namespace
+
+TEST_CASE("unique", "unique tests") {
+    std::vector<int> v { 1, 1, 2, 3, 3, 3, 1, 4, 4 };
+    CHECK((seq::materialize<std::vector<int>>(seq::unique(seq::as_sequence(v))) == std::vector<int> { 1, 2, 3, 1, 4 }));
+    CHECK(seq::empty(seq::unique(seq::as_sequence(std::vector<int>{}))));
+
+    std::list<std::string> words { "a", "a", "b", "a" };
+    CHECK((seq::materialize<std::vector<std::string>>(seq::unique(seq::as_sequence(words)))
+           == std::vector<std::string> { "a", "b", "a" }));
+
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &v]() mutable { return i < v.size()? wheels::some(v[i++]) : wheels::none; });
+    CHECK((seq::materialize<std::vector<int>>(seq::unique(generated)) == std::vector<int> { 1, 2, 3, 1, 4 }));
+
+    // multi-pass sequences yield the elements themselves
+    CHECK(&seq::front(seq::unique(seq::as_sequence(v))) == &v[0]);
+
+    auto bytes = stepped<std::uint8_t>();
+    std::vector<std::uint8_t> expected;
+    for(auto const& run : runs_of(bytes)) expected.push_back(run.first);
+    CHECK(seq::materialize<std::vector<std::uint8_t>>(seq::unique(seq::as_sequence(bytes))) == expected);
+}
+
+TEST_CASE("rle", "rle tests") {
+    std::vector<int> v { 1, 1, 2, 3, 3, 3, 1, 4, 4 };
+    std::vector<std::pair<int, std::size_t>> expected { { 1, 2 }, { 2, 1 }, { 3, 3 }, { 1, 1 }, { 4, 2 } };
+    CHECK((seq::materialize<std::vector<std::pair<int, std::size_t>>>(seq::rle(seq::as_sequence(v))) == expected));
+
+    std::size_t i = 0;
+    auto generated = seq::generate([i, &v]() mutable { return i < v.size()? wheels::some(v[i++]) : wheels::none; });
+    CHECK((seq::materialize<std::vector<std::pair<int, std::size_t>>>(seq::rle(generated)) == expected));
+
+    std::list<int> l(v.begin(), v.end());
+    CHECK((seq::materialize<std::vector<std::pair<int, std::size_t>>>(seq::rle(seq::as_sequence(l))) == expected));
+
+    auto bytes = stepped<std::int8_t>();
+    CHECK((seq::materialize<std::vector<std::pair<std::int8_t, std::size_t>>>(seq::rle(seq::as_sequence(bytes))) == runs_of(bytes)));
+    auto shorts = stepped<std::uint16_t>();
+    CHECK((seq::materialize<std::vector<std::pair<std::uint16_t, std::size_t>>>(seq::rle(seq::as_sequence(shorts))) == runs_of(shorts)));
+    auto ints = stepped<std::int32_t>();
+    CHECK((seq::materialize<std::vector<std::pair<std::int32_t, std::size_t>>>(seq::rle(seq::as_sequence(ints))) == runs_of(ints)));
+    auto longs = stepped<std::uint64_t>();
+    CHECK((seq::materialize<std::vector<std::pair<std::uint64_t, std::size_t>>>(seq::rle(seq::as_sequence(longs))) == runs_of(longs)));
+
+    // a single run that spans many blocks
+    std::vector<std::uint32_t> same(1000, 7);
+    auto whole = seq::rle(seq::as_sequence(same));
+    CHECK(seq::front(whole).second == 1000u);
+    seq::pop_front(whole);
+    CHECK(seq::empty(whole));
+}
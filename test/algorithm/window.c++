@@ -0,0 +1,79 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/window.h++>
+
+#include <taussig/algorithms/window.h++>
+#include <taussig/algorithms/fold.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include "../allocations.h++"
+
+#include <catch.hpp>
+
+#include <functional>
+#include <numeric>
+#include <vector>
+
+namespace {
+    template <typename S>
+    std::vector<std::vector<int>> windows(S s) {
+        std::vector<std::vector<int>> result;
+        for(; !seq::empty(s); seq::pop_front(s)) {
+            result.push_back(seq::materialize<std::vector<int>>(seq::front(s)));
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("window", "window tests") {
+    for(int n = 0; n < 12; ++n) {
+        for(int k = 1; k < 5; ++k) {
+            std::vector<int> v(n);
+            std::iota(v.begin(), v.end(), 0);
+            std::vector<std::vector<int>> expected;
+            for(int i = 0; i + k <= n; ++i) expected.emplace_back(v.begin() + i, v.begin() + i + k);
+
+            CHECK(windows(seq::window(seq::as_sequence(v), k)) == expected);
+
+            int j = 0;
+            auto generated = seq::generate([j, n]() mutable { return j < n? wheels::some(j++) : wheels::none; });
+            CHECK(windows(seq::window(generated, k)) == expected);
+        }
+    }
+
+    // random-access windows are views into the source
+    std::vector<int> v { 1, 2, 3, 4, 5 };
+    auto s = seq::window(seq::as_sequence(v), 3);
+    seq::pop_front(s);
+    CHECK(&*seq::front(s).first == &v[1]);
+}
+
+TEST_CASE("window allocations", "window buffers are allocated once") {
+    std::vector<int> sums;
+    sums.reserve(100);
+    auto counted = allocations::after_warm_up([&] {
+        int n = 0;
+        sums.clear();
+        auto generated = seq::generate([n]() mutable { return n < 100? wheels::some(n++) : wheels::none; });
+        for(auto s = seq::window(generated, 4); !seq::empty(s); seq::pop_front(s)) {
+            sums.push_back(seq::fold(seq::front(s), 0, std::plus<int>()));
+        }
+    });
+    REQUIRE(sums.size() == 97u);
+    CHECK(sums.front() == 6);
+    CHECK(sums.back() == 96 + 97 + 98 + 99);
+    CHECK(counted.allocations == 1u);
+}
@@ -0,0 +1,79 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Tests for <taussig/algorithms/zip.h++> and <taussig/interop/materialize_soa.h++>
+
+#include <taussig/algorithms/zip.h++>
+#include <taussig/algorithms/map.h++>
+#include <taussig/algorithms/generate.h++>
+#include <taussig/primitives.h++>
+#include <taussig/interop.h++>
+
+#include <wheels/optional.h++>
+
+#include "../allocations.h++"
+
+#include <catch.hpp>
+
+#include <list>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("zip", "zip tests") {
+    std::vector<int> numbers { 1, 2, 3, 4 };
+    std::list<std::string> names { "one", "two", "three" };
+
+    auto z = seq::zip(seq::as_sequence(numbers), seq::as_sequence(names));
+    static_assert(std::is_same<seq::ReferenceType<decltype(z)>, std::tuple<int&, std::string&>>(),
+                  "zip must yield references to the elements");
+
+    int count = 0;
+    for(; !seq::empty(z); seq::pop_front(z)) {
+        auto row = seq::front(z);
+        CHECK(std::get<0>(row) == count + 1);
+        std::get<1>(row) += "!";
+        ++count;
+    }
+    CHECK(count == 3);
+    CHECK(names.front() == "one!");
+    CHECK(names.back() == "three!");
+
+    std::vector<int> empty;
+    CHECK(seq::empty(seq::zip(seq::as_sequence(numbers), seq::as_sequence(empty))));
+
+    auto single = seq::zip(seq::as_sequence(numbers));
+    CHECK(std::get<0>(seq::front(single)) == 1);
+}
+
+TEST_CASE("materialize_soa", "materialize_soa tests") {
+    std::vector<int> ids { 1, 2, 3, 4, 5 };
+    std::vector<double> weights { 0.5, 1.5, 2.5 };
+    std::vector<char> flags { 'a', 'b', 'c', 'd' };
+
+    std::tuple<std::vector<int>, std::vector<double>, std::vector<char>> columns;
+    auto counted = allocations::during([&] {
+        columns = seq::materialize_soa(seq::zip(seq::as_sequence(ids), seq::as_sequence(weights), seq::as_sequence(flags)));
+    });
+    // random-access columns are copied whole, so each allocates once
+    CHECK(counted.allocations == 3u);
+    CHECK((std::get<0>(columns) == std::vector<int> { 1, 2, 3 }));
+    CHECK((std::get<1>(columns) == std::vector<double> { 0.5, 1.5, 2.5 }));
+    CHECK((std::get<2>(columns) == std::vector<char> { 'a', 'b', 'c' }));
+
+    int n = 0;
+    auto generated = seq::generate([n]() mutable { return n < 4? wheels::some(n++) : wheels::none; });
+    auto squares = seq::map([](int x) { return x * x; }, seq::as_sequence(ids));
+    auto mixed = seq::materialize_soa(seq::zip(generated, squares));
+    CHECK((std::get<0>(mixed) == std::vector<int> { 0, 1, 2, 3 }));
+    CHECK((std::get<1>(mixed) == std::vector<int> { 1, 4, 9, 16 }));
+}
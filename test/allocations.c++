@@ -0,0 +1,71 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Counting replacements for the global allocation functions
+
+#include "allocations.h++"
+
+#include <atomic>
+#include <cstdlib> // malloc, free
+#include <new> // bad_alloc, nothrow_t
+
+namespace allocations {
+    namespace {
+        // zero-initialized before any dynamic initialization can allocate
+        std::atomic<std::size_t> allocation_count;
+        std::atomic<std::size_t> deallocation_count;
+        std::atomic<std::size_t> allocated_bytes;
+
+        void* allocate(std::size_t size) noexcept {
+            allocation_count.fetch_add(1, std::memory_order_relaxed);
+            allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+            return std::malloc(size? size : 1);
+        }
+        void deallocate(void* p) noexcept {
+            if(!p) return;
+            deallocation_count.fetch_add(1, std::memory_order_relaxed);
+            std::free(p);
+        }
+    } // namespace
+
+    counts total() {
+        return { allocation_count.load(std::memory_order_relaxed),
+                 deallocation_count.load(std::memory_order_relaxed),
+                 allocated_bytes.load(std::memory_order_relaxed) };
+    }
+} // namespace allocations
+
+void* operator new(std::size_t size) {
+    if(auto p = allocations::allocate(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+    if(auto p = allocations::allocate(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept {
+    return allocations::allocate(size);
+}
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept {
+    return allocations::allocate(size);
+}
+void operator delete(void* p) noexcept {
+    allocations::deallocate(p);
+}
+void operator delete[](void* p) noexcept {
+    allocations::deallocate(p);
+}
+void operator delete(void* p, std::nothrow_t const&) noexcept {
+    allocations::deallocate(p);
+}
+void operator delete[](void* p, std::nothrow_t const&) noexcept {
+    allocations::deallocate(p);
+}
@@ -0,0 +1,71 @@
+// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Allocation tracking for tests and benchmarks
+//
+// Linking allocations.c++ into a program replaces the global allocation functions with ones that
+// count every call; the tests and the benchmark runner both link it.
+
+#ifndef TAUSSIG_TEST_ALLOCATIONS_HPP
+#define TAUSSIG_TEST_ALLOCATIONS_HPP
+
+#include <cstddef> // size_t
+
+namespace allocations {
+    //! {class}
+    //! Allocation totals, either since program start or over some region.
+    struct counts {
+        std::size_t allocations;
+        std::size_t deallocations;
+        std::size_t bytes; // requested by the allocations
+    };
+
+    //! {function}
+    //! *Returns*: the totals since program start, across all threads.
+    counts total();
+
+    //! {class}
+    //! Counts the allocations made between its construction and each call to `counted()`.
+    struct scope {
+        scope() : start(total()) {}
+
+        counts counted() const {
+            auto now = total();
+            return { now.allocations - start.allocations,
+                     now.deallocations - start.deallocations,
+                     now.bytes - start.bytes };
+        }
+
+    private:
+        counts start;
+    };
+
+    //! {function}
+    //! *Effects*: calls `f()` once.
+    //! *Returns*: the allocations made by that call.
+    template <typename F>
+    counts during(F&& f) {
+        scope s;
+        f();
+        return s.counted();
+    }
+
+    //! {function}
+    //! *Effects*: calls `f()` twice; the first call warms up any lazily allocated state.
+    //! *Returns*: the allocations made by the second call.
+    template <typename F>
+    counts after_warm_up(F&& f) {
+        f();
+        return during(f);
+    }
+} // namespace allocations
+
+#endif // TAUSSIG_TEST_ALLOCATIONS_HPP
@@ -13,8 +13,12 @@
 
 #include <taussig/taussig.h++>
 
+#include "allocations.h++"
+
 #include <catch.hpp>
 
+#include <vector>
+
 TEST_CASE("sequence", "sequence tests") {
     auto&& str = seq::as_sequence(u"\U00010000ab");
     REQUIRE(!seq::empty(str));
@@ -87,3 +91,24 @@ TEST_CASE("optional", "optional-as-sequence tests") {
         REQUIRE(bool(o) == false);
     }
 }
+TEST_CASE("materialize allocations", "materialize allocation budget") {
+    std::vector<int> v(1000, 7);
+    SECTION("random access", "random access sources are materialized with a single allocation") {
+        std::vector<int> m;
+        auto counted = allocations::during([&] {
+            m = seq::materialize<std::vector<int>>(seq::as_sequence(v));
+        });
+        CHECK(m == v);
+        CHECK(counted.allocations == 1u);
+        CHECK(counted.bytes == v.size() * sizeof(int));
+    }
+    SECTION("input", "input sources grow the container") {
+        std::vector<int> m;
+        auto counted = allocations::during([&] {
+            m = seq::materialize<std::vector<int>>(seq::map([](int x) { return x; }, seq::as_sequence(v)));
+        });
+        CHECK(m == v);
+        CHECK(counted.allocations > 1u);
+        CHECK(counted.deallocations == counted.allocations - 1);
+    }
+}
@@ -0,0 +1,189 @@
+#!/usr/bin/python
+
+# Taussig
+#
+# Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+#
+# To the extent possible under law, the author(s) have dedicated all copyright and related
+# and neighboring rights to this software to the public domain worldwide. This software is
+# distributed without any warranty.
+#
+# You should have received a copy of the CC0 Public Domain Dedication along with this software.
+# If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+# Generates src/unicode_data.c++ from the Unicode Character Database bundled with Python.
+
+import unicodedata
+import argparse
+
+# --- constants
+
+max_code_point = 0x10FFFF
+
+s_base, l_base, v_base, t_base = 0xAC00, 0x1100, 0x1161, 0x11A7
+l_count, v_count, t_count = 19, 21, 28
+s_count = l_count * v_count * t_count
+
+flag_nfc_no = 1
+flag_nfc_maybe = 2
+flag_nfd_no = 4
+flag_nfd_boundary = 8
+
+# --- util functions
+
+def is_surrogate(cp):
+    return 0xD800 <= cp <= 0xDFFF
+
+def is_hangul_syllable(cp):
+    return s_base <= cp < s_base + s_count
+
+def canonical_mapping(cp):
+    if is_surrogate(cp):
+        return None
+    d = unicodedata.decomposition(chr(cp))
+    if not d or d.startswith('<'):
+        return None
+    return [int(x, 16) for x in d.split()]
+
+def full_decomposition(cp):
+    m = canonical_mapping(cp)
+    if m is None:
+        return [cp]
+    return [c for x in m for c in full_decomposition(x)]
+
+def ccc(cp):
+    return 0 if is_surrogate(cp) else unicodedata.combining(chr(cp))
+
+# --- property computation
+
+def compute():
+    decompositions = {}
+    compositions = {}
+    for cp in range(max_code_point + 1):
+        m = canonical_mapping(cp)
+        if m is None:
+            continue
+        decompositions[cp] = full_decomposition(cp)
+        # primary composites are the pair mappings that survive NFC
+        if len(m) == 2 and unicodedata.normalize('NFC', chr(m[0]) + chr(m[1])) == chr(cp):
+            compositions.setdefault(m[0], []).append((m[1], cp))
+
+    seconds = set(second for pairs in compositions.values() for second, _ in pairs)
+    seconds.update(range(v_base, v_base + v_count))
+    seconds.update(range(t_base + 1, t_base + t_count))
+
+    records = []
+    record_index = {}
+    decomposition_data = []
+    composition_data = []
+    values = []
+    for cp in range(max_code_point + 1):
+        c = ccc(cp)
+        flags = 0
+        decomposition = (0, 0)
+        composition = (0, 0)
+        if cp in decompositions:
+            flags |= flag_nfd_no
+            d = decompositions[cp]
+            decomposition = (len(decomposition_data), len(d))
+            decomposition_data.extend(d)
+            if unicodedata.normalize('NFC', chr(cp)) != chr(cp):
+                flags |= flag_nfc_no
+        elif is_hangul_syllable(cp):
+            flags |= flag_nfd_no
+        if cp in seconds:
+            flags |= flag_nfc_maybe
+        if c == 0 and ccc(full_decomposition(cp)[0]) == 0:
+            flags |= flag_nfd_boundary
+        if cp in compositions:
+            pairs = sorted(compositions[cp])
+            composition = (len(composition_data), len(pairs))
+            composition_data.extend(pairs)
+        record = (c, flags) + decomposition + composition
+        if record not in record_index:
+            record_index[record] = len(records)
+            records.append(record)
+        values.append(record_index[record])
+    return records, values, decomposition_data, composition_data
+
+def split_table(values, shift):
+    block = 1 << shift
+    blocks = []
+    block_index = {}
+    stage1 = []
+    for i in range(0, len(values), block):
+        b = tuple(values[i:i + block])
+        if b not in block_index:
+            block_index[b] = len(blocks)
+            blocks.append(b)
+        stage1.append(block_index[b])
+    return stage1, blocks
+
+def rows(items, per_row, indent='    '):
+    items = list(items)
+    return '\n'.join(indent + ', '.join(items[i:i + per_row]) + ','
+                     for i in range(0, len(items), per_row))
+
+# --- output
+
+header = '''// Taussig
+//
+// Written in 2013 by Martinho Fernandes <martinho.fernandes@gmail.com>
+//
+// To the extent possible under law, the author(s) have dedicated all copyright and related
+// and neighboring rights to this software to the public domain worldwide. This software is
+// distributed without any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+
+// Unicode normalization data (Unicode %s)
+//
+// Generated by tools/gen_unicode_data.py; do not edit.
+
+#include <taussig/detail/unicode_data.h++>
+
+namespace seq {
+    namespace detail {
+        namespace ucd {
+'''
+
+footer = '''        } // namespace ucd
+    } // namespace detail
+} // namespace seq
+'''
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--output', default='src/unicode_data.c++', metavar='file', help='output file (default: src/unicode_data.c++)')
+    args = parser.parse_args()
+
+    records, values, decomposition_data, composition_data = compute()
+    shift = 7
+    stage1, blocks = split_table(values, shift)
+    assert len(records) < 0x10000 and len(blocks) < 0x10000
+    assert len(decomposition_data) < 0x10000 and len(composition_data) < 0x10000
+
+    with open(args.output, 'w') as out:
+        out.write(header % unicodedata.unidata_version)
+        ind = ' ' * 12
+        out.write(ind + 'static_assert(block_shift == %d, "generated data does not match block_shift");\n\n' % shift)
+        out.write(ind + 'std::uint16_t const stage1[%d] = {\n' % len(stage1))
+        out.write(rows(('%d' % x for x in stage1), 16, ind + '    ') + '\n')
+        out.write(ind + '};\n')
+        out.write(ind + 'std::uint16_t const stage2[%d] = {\n' % (len(blocks) << shift))
+        out.write(rows(('%d' % x for b in blocks for x in b), 16, ind + '    ') + '\n')
+        out.write(ind + '};\n')
+        out.write(ind + 'record const records[%d] = {\n' % len(records))
+        out.write(rows(('{ %d, %d, %d, %d, %d, %d }' % (r[2], r[4], r[0], r[1], r[3], r[5]) for r in records), 4, ind + '    ') + '\n')
+        out.write(ind + '};\n')
+        out.write(ind + 'char32_t const decompositions[%d] = {\n' % len(decomposition_data))
+        out.write(rows(('0x%04X' % x for x in decomposition_data), 8, ind + '    ') + '\n')
+        out.write(ind + '};\n')
+        out.write(ind + 'composition const compositions[%d] = {\n' % len(composition_data))
+        out.write(rows(('{ 0x%04X, 0x%04X }' % p for p in composition_data), 4, ind + '    ') + '\n')
+        out.write(ind + '};\n')
+        out.write(footer)
+
+if __name__ == '__main__':
+    main()